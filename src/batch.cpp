@@ -0,0 +1,60 @@
+#include "batch.hpp"
+#include "flags.hpp"
+
+// http::RequestBatch: requests = 1
+static void append_entry(std::string& out, const std::string& payload) {
+  out.push_back((1 << 3) | 2);
+
+  uint32_t len = payload.size();
+
+  while(len >= 0x80) {
+    out.push_back((char)(len | 0x80));
+    len >>= 7;
+  }
+
+  out.push_back((char)len);
+  out.append(payload);
+}
+
+Batch::Batch()
+  : flags_(0)
+  , first_()
+  , frame_()
+  , count_(0)
+  , streams_()
+{}
+
+void Batch::add(std::string& payload, uint32_t flags, uint64_t stream) {
+  streams_.push_back(stream);
+
+  if(count_++ == 0) {
+    flags_ = flags;
+    first_.swap(payload);
+    return;
+  }
+
+  if(count_ == 2) {
+    frame_.clear();
+    append_entry(frame_, first_);
+  }
+
+  append_entry(frame_, payload);
+}
+
+void Batch::take(std::string& payload, uint32_t& flags,
+                 std::vector<uint64_t>& streams) {
+  if(count_ == 1) {
+    payload.swap(first_);
+    flags = flags_;
+  } else {
+    payload.swap(frame_);
+    flags = flags_ | eBatch;
+  }
+
+  streams.swap(streams_);
+
+  first_.clear();
+  frame_.clear();
+  streams_.clear();
+  count_ = 0;
+}
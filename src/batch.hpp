@@ -0,0 +1,45 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// Request payloads bound for one destination, gathered over a single
+// loop iteration so they can share one wire::Message. A lone request
+// goes out exactly as it would have unbatched, so a lightly loaded
+// gateway adds neither latency nor framing; only once a second request
+// arrives are they re-framed as an http::RequestBatch.
+class Batch {
+  uint32_t flags_;
+  std::string first_;
+  std::string frame_;
+  int count_;
+  std::vector<uint64_t> streams_;
+
+public:
+  Batch();
+
+  bool empty_p() {
+    return count_ == 0;
+  }
+
+  uint32_t flags() {
+    return flags_;
+  }
+
+  size_t size() {
+    return count_ == 1 ? first_.size() : frame_.size();
+  }
+
+  // payload is taken over (swapped out) rather than copied.
+  void add(std::string& payload, uint32_t flags, uint64_t stream);
+
+  // Hand out what's been gathered as one payload, flagged eBatch if it
+  // holds more than one request, along with the stream of each request.
+  void take(std::string& payload, uint32_t& flags,
+            std::vector<uint64_t>& streams);
+};
+
+#endif
@@ -0,0 +1,151 @@
+#include "breaker.hpp"
+
+#include <string.h>
+
+#include <sstream>
+
+// Failures are only judged once the window holds this many requests.
+static const uint32_t cMinRequests = 20;
+
+// How long an open breaker waits before probing, seconds.
+static const ev_tstamp cOpenTime = 5;
+
+// Probes outstanding at once while half-open, and successes needed to
+// close.
+static const int cProbes = 3;
+
+static const char* state_name(Breaker::State state) {
+  switch(state) {
+  case Breaker::eClosed: return "closed";
+  case Breaker::eOpen: return "open";
+  case Breaker::eHalfOpen: return "half_open";
+  }
+
+  return "unknown";
+}
+
+Breaker::Breaker()
+  : state_(eClosed)
+  , threshold_(50)
+  , open_until_(0)
+  , probes_(0)
+  , succeeded_(0)
+  , trips_(0)
+  , fast_failed_(0)
+{
+  memset(window_, 0, sizeof(window_));
+}
+
+// The bucket for the current second, emptied first if it last held an
+// older one.
+Breaker::Bucket& Breaker::bucket(ev_tstamp now) {
+  int64_t second = (int64_t)now;
+  Bucket& b = window_[second % cBuckets];
+
+  if(b.second != second) {
+    b.second = second;
+    b.requests = 0;
+    b.failures = 0;
+  }
+
+  return b;
+}
+
+void Breaker::totals(ev_tstamp now, uint32_t& requests, uint32_t& failures) {
+  int64_t oldest = (int64_t)now - cBuckets + 1;
+
+  requests = 0;
+  failures = 0;
+
+  for(int i = 0; i < cBuckets; i++) {
+    if(window_[i].second < oldest) continue;
+
+    requests += window_[i].requests;
+    failures += window_[i].failures;
+  }
+}
+
+bool Breaker::allow(ev_tstamp now, bool& probe) {
+  probe = false;
+
+  if(state_ == eOpen && now >= open_until_) {
+    state_ = eHalfOpen;
+    succeeded_ = 0;
+  }
+
+  if(state_ == eClosed) return true;
+
+  if(state_ == eHalfOpen && probes_ + succeeded_ < cProbes) {
+    probes_++;
+    probe = true;
+    return true;
+  }
+
+  fast_failed_++;
+  return false;
+}
+
+void Breaker::record(ev_tstamp now, bool failed, bool probe) {
+  if(probe) {
+    probes_--;
+
+    if(state_ != eHalfOpen) return;
+
+    if(failed) {
+      trip(now);
+    } else if(++succeeded_ >= cProbes) {
+      close();
+    }
+
+    return;
+  }
+
+  // Stragglers from before the breaker opened say nothing new.
+  if(state_ != eClosed) return;
+
+  Bucket& b = bucket(now);
+  b.requests++;
+  if(failed) b.failures++;
+
+  if(!failed) return;
+
+  uint32_t requests, failures;
+  totals(now, requests, failures);
+
+  if(requests >= cMinRequests &&
+     failures * 100 >= requests * (uint32_t)threshold_) {
+    trip(now);
+  }
+}
+
+void Breaker::abandon(bool probe) {
+  if(probe) probes_--;
+}
+
+void Breaker::trip(ev_tstamp now) {
+  state_ = eOpen;
+  open_until_ = now + cOpenTime;
+  trips_++;
+}
+
+void Breaker::close() {
+  state_ = eClosed;
+  memset(window_, 0, sizeof(window_));
+}
+
+std::string Breaker::json(const std::string& destination, ev_tstamp now) {
+  uint32_t requests, failures;
+  totals(now, requests, failures);
+
+  std::stringstream out;
+
+  out << "{\"destination\":\"" << destination << "\""
+      << ",\"state\":\"" << state_name(state_) << "\""
+      << ",\"requests\":" << requests
+      << ",\"failures\":" << failures
+      << ",\"trips\":" << trips_
+      << ",\"fast_failed\":" << fast_failed_
+      << "}";
+
+  return out.str();
+}
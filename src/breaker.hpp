@@ -0,0 +1,77 @@
+#ifndef BREAKER_HPP
+#define BREAKER_HPP
+
+#include <stdint.h>
+
+#include <string>
+
+#include <ev++.h>
+
+// A circuit breaker for one destination. While closed, outcomes go into
+// a sliding window of one second buckets; once enough of the window's
+// requests failed (a 5xx reply or a missed deadline), the breaker opens
+// and requests are answered without going to the broker at all. After a
+// cool-off it lets a few probes through half-open: should they all come
+// back fine it closes again, and any failure opens it for another round.
+class Breaker {
+public:
+  enum State {
+    eClosed,
+    eOpen,
+    eHalfOpen
+  };
+
+  static const int cBuckets = 10;
+
+private:
+  State state_;
+
+  // Percentage of failed requests in the window that opens the breaker.
+  int threshold_;
+
+  struct Bucket {
+    int64_t second;
+    uint32_t requests;
+    uint32_t failures;
+  };
+
+  Bucket window_[cBuckets];
+
+  ev_tstamp open_until_;
+
+  int probes_;      // sent half-open and not yet answered
+  int succeeded_;   // probes answered without failing
+
+  uint64_t trips_;
+  uint64_t fast_failed_;
+
+public:
+  Breaker();
+
+  void set_threshold(int percent) {
+    threshold_ = percent;
+  }
+
+  State state() {
+    return state_;
+  }
+
+  // Whether a request may go through now; probe is set if it's one of
+  // the half-open breaker's probes and so must be passed back to record.
+  bool allow(ev_tstamp now, bool& probe);
+
+  void record(ev_tstamp now, bool failed, bool probe);
+
+  // The request ended with nothing to say about the destination's health.
+  void abandon(bool probe);
+
+  std::string json(const std::string& destination, ev_tstamp now);
+
+private:
+  Bucket& bucket(ev_tstamp now);
+  void totals(ev_tstamp now, uint32_t& requests, uint32_t& failures);
+  void trip(ev_tstamp now);
+  void close();
+};
+
+#endif
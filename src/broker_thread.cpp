@@ -0,0 +1,300 @@
+#include "harq.hpp"
+#include "broker_thread.hpp"
+#include "util.hpp"
+#include "debugs.hpp"
+
+#include "wire.pb.h"
+#include "reply.hpp"
+#include "flags.hpp"
+
+#include <iostream>
+
+#include <assert.h>
+#include <errno.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+
+// Frames are batched into writes of roughly this size.
+static const size_t cBatchSize = 64 * 1024;
+
+BrokerThread::BrokerThread()
+  : loop_(EVFLAG_AUTO)
+  , wakeup_(loop_)
+  , read_w_(loop_)
+  , write_w_(loop_)
+  , sock_(-1)
+  , buffer_(READ_BUFFER)
+  , state_(eReadSize)
+  , need_(0)
+  , writer_started_(false)
+  , producers_()
+  , deflate_()
+  , thread_()
+  , topics_()
+  , topics_lock_()
+{
+  pthread_mutex_init(&topics_lock_, NULL);
+
+  wakeup_.set<BrokerThread, &BrokerThread::on_wakeup>(this);
+  read_w_.set<BrokerThread, &BrokerThread::on_readable>(this);
+  write_w_.set<BrokerThread, &BrokerThread::on_writable>(this);
+}
+
+BrokerThread::~BrokerThread() {
+  for(Producers::iterator i = producers_.begin();
+      i != producers_.end();
+      ++i) {
+    delete *i;
+  }
+
+  if(sock_.fd >= 0) close(sock_.fd);
+
+  pthread_mutex_destroy(&topics_lock_);
+}
+
+bool BrokerThread::connect(std::string addr, std::string reply_queue) {
+  int fd = connect_address(addr);
+  if(fd < 0) return false;
+
+  sock_.fd = fd;
+  sock_.set_nonblock();
+
+  std::vector<wire::Message> setup;
+  link_setup_messages(setup, reply_queue, deflate_);
+
+  for(std::vector<wire::Message>::iterator i = setup.begin();
+      i != setup.end();
+      ++i) {
+    if(sock_.write(*i) == eFailure) return false;
+  }
+
+  return true;
+}
+
+int BrokerThread::add_producer(ev::async& notify) {
+  int idx = producers_.size();
+  assert(idx < (1 << cProducerBits) && "Too many producers");
+
+  producers_.push_back(new Producer(notify));
+  return idx;
+}
+
+void BrokerThread::start() {
+  wakeup_.start();
+  read_w_.start(sock_.fd, EV_READ);
+
+  // Anything the setup left unflushed goes out once the loop runs.
+  writer_started_ = true;
+  write_w_.start(sock_.fd, EV_WRITE);
+
+  pthread_create(&thread_, NULL, &BrokerThread::run, this);
+}
+
+void* BrokerThread::run(void* arg) {
+  BrokerThread* self = (BrokerThread*)arg;
+  self->loop_.run(0);
+  return NULL;
+}
+
+static std::string* encode_frame(wire::Message& msg) {
+  std::string* frame = new std::string(4, '\0');
+
+  if(!msg.AppendToString(frame)) {
+    delete frame;
+    return NULL;
+  }
+
+  uint32_t sz = htonl(frame->size() - 4);
+  memcpy(&(*frame)[0], &sz, 4);
+
+  return frame;
+}
+
+bool BrokerThread::push(int producer, wire::Message& msg) {
+  std::string* frame = encode_frame(msg);
+  if(!frame) {
+    std::cerr << "Error serializing message\n";
+    return false;
+  }
+
+  if(!producers_[producer]->requests.push(frame)) {
+    delete frame;
+    return false;
+  }
+
+  wakeup_.send();
+  return true;
+}
+
+bool BrokerThread::pop_reply(int producer, Reply*& rep) {
+  return producers_[producer]->replies.pop(rep);
+}
+
+// Drain every producer's ring into as few writes as possible. Rings are
+// visited round-robin a batch at a time so one busy loop can't starve the
+// others.
+void BrokerThread::on_wakeup(ev::async& w, int revents) {
+  std::string batch;
+  batch.reserve(cBatchSize);
+
+  bool more = true;
+
+  while(more) {
+    more = false;
+
+    for(Producers::iterator i = producers_.begin();
+        i != producers_.end();
+        ++i) {
+      std::string* frame;
+
+      size_t taken = 0;
+      while(taken < cBatchSize && (*i)->requests.pop(frame)) {
+        batch.append(*frame);
+        taken += frame->size();
+        delete frame;
+      }
+
+      if(taken >= cBatchSize) more = true;
+    }
+
+    if(batch.size() >= cBatchSize) write_batch(batch);
+  }
+
+  if(!batch.empty()) write_batch(batch);
+}
+
+void BrokerThread::write_batch(std::string& batch) {
+  debugs << "Writing batch of " << batch.size() << " bytes to broker\n";
+
+  switch(sock_.write(batch)) {
+  case eOk:
+    break;
+  case eFailure:
+    std::cerr << "Error writing to broker, exiting broker thread\n";
+    loop_.break_loop();
+    break;
+  case eWouldBlock:
+    if(!writer_started_) {
+      writer_started_ = true;
+      write_w_.start(sock_.fd, EV_WRITE);
+    }
+    break;
+  }
+
+  batch.clear();
+}
+
+void BrokerThread::on_writable(ev::io& w, int revents) {
+  switch(sock_.flush()) {
+  case eOk:
+    writer_started_ = false;
+    write_w_.stop();
+    return;
+  case eFailure:
+    std::cerr << "Error writing to broker, exiting broker thread\n";
+    loop_.break_loop();
+    return;
+  case eWouldBlock:
+    return;
+  }
+}
+
+void BrokerThread::on_readable(ev::io& w, int revents) {
+  ssize_t recved = buffer_.fill(sock_.fd);
+
+  if(recved < 0) {
+    if(errno == EAGAIN || errno == EWOULDBLOCK) return;
+    std::cerr << "Error reading from broker: " << strerror(errno) << "\n";
+    loop_.break_loop();
+    return;
+  }
+
+  if(recved == 0) {
+    std::cerr << "Broker closed the connection\n";
+    loop_.break_loop();
+    return;
+  }
+
+  for(;;) {
+    if(state_ == eReadSize) {
+      if(buffer_.read_available() < 4) return;
+      need_ = buffer_.read_int32();
+      buffer_.reserve(need_);
+      state_ = eReadMessage;
+    }
+
+    if(buffer_.read_available() < need_) return;
+
+    Reply rep;
+
+    bool ok = rep.parse(buffer_.segment(), buffer_.read_pos(), need_);
+
+    buffer_.advance_read(need_);
+    state_ = eReadSize;
+
+    if(!ok || !rep.inflate(deflate_)) {
+      std::cerr << "Unable to parse reply from broker\n";
+      continue;
+    }
+
+    if(!(rep.flags() & eBatch)) {
+      route(rep);
+      continue;
+    }
+
+    // Entries of one batch can belong to different loops.
+    std::vector<Reply> entries;
+
+    if(!rep.split(entries)) {
+      std::cerr << "Unable to parse reply batch from broker\n";
+      continue;
+    }
+
+    for(size_t i = 0; i < entries.size(); i++) {
+      route(entries[i]);
+    }
+  }
+}
+
+bool BrokerThread::claim_topic(const std::string& topic) {
+  pthread_mutex_lock(&topics_lock_);
+  bool fresh = topics_.insert(topic).second;
+  pthread_mutex_unlock(&topics_lock_);
+
+  return fresh;
+}
+
+void BrokerThread::route(Reply& parsed) {
+  // Every loop has readers of its own for a topic.
+  if(parsed.topic_p()) {
+    for(size_t i = 0; i < producers_.size(); i++) {
+      hand_off(producers_[i], new Reply(parsed));
+    }
+
+    return;
+  }
+
+  if(!parsed.parse_response()) {
+    std::cerr << "Unable to parse reply from broker\n";
+    return;
+  }
+
+  size_t idx = parsed.stream_id() >> cProducerShift;
+  if(idx >= producers_.size()) idx = 0;
+
+  hand_off(producers_[idx], new Reply(parsed));
+}
+
+void BrokerThread::hand_off(Producer* p, Reply* rep) {
+  // The producer never waits on us, so yielding until it drains a slot
+  // can't deadlock. Meanwhile we stop reading, which pushes back on the
+  // broker instead of buffering without bound.
+  while(!p->replies.push(rep)) {
+    p->notify.send();
+    sched_yield();
+  }
+
+  p->notify.send();
+}
@@ -0,0 +1,121 @@
+#ifndef BROKER_THREAD_HPP
+#define BROKER_THREAD_HPP
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include <ev++.h>
+
+#include "harq.hpp"
+#include "buffer.hpp"
+#include "socket.hpp"
+#include "ring.hpp"
+#include "deflate.hpp"
+
+namespace wire {
+  class Message;
+}
+
+class Reply;
+
+// Owns the single broker link when harq-http runs more than one HTTP
+// loop. Each loop is a producer with its own pair of rings: encoded
+// request frames flow in through one and parsed replies flow back out
+// through the other, so no locks are taken on either side. Replies keep
+// referencing the broker thread's read segment, so their bodies are never
+// copied on the way to the client.
+//
+// The owning loop of a reply is found from the top bits of its stream_id
+// (see Server::next_id), which is why a producer index must fit in
+// cProducerBits.
+class BrokerThread {
+public:
+  static const int cProducerShift = STREAM_COUNTER_BITS;
+  static const int cProducerBits = 64 - STREAM_COUNTER_BITS;
+  static const size_t cRingSize = 16384;
+
+private:
+  struct Producer {
+    Ring<std::string*> requests;
+    Ring<Reply*> replies;
+    ev::async& notify;
+
+    Producer(ev::async& n)
+      : requests(cRingSize)
+      , replies(cRingSize)
+      , notify(n)
+    {}
+  };
+
+  typedef std::vector<Producer*> Producers;
+
+  enum State { eReadSize, eReadMessage };
+
+  ev::dynamic_loop loop_;
+  ev::async wakeup_;
+  ev::io read_w_;
+  ev::io write_w_;
+
+  Socket sock_;
+  Buffer buffer_;
+
+  State state_;
+  int need_;
+
+  bool writer_started_;
+
+  Producers producers_;
+
+  Deflate deflate_;
+
+  pthread_t thread_;
+
+  // Event topics some loop has subscribed the link to.
+  std::set<std::string> topics_;
+  pthread_mutex_t topics_lock_;
+
+  BrokerThread(const BrokerThread&);
+  BrokerThread& operator=(const BrokerThread&);
+
+public:
+  BrokerThread();
+  ~BrokerThread();
+
+  // Called from the main thread before start().
+  Deflate& deflate() {
+    return deflate_;
+  }
+
+  bool connect(std::string addr, std::string reply_queue);
+  int add_producer(ev::async& notify);
+  void start();
+
+  // Called from a producer's own thread.
+  bool push(int producer, wire::Message& msg);
+  bool pop_reply(int producer, Reply*& rep);
+
+  bool full_p(int producer) {
+    return producers_[producer]->requests.full_p();
+  }
+
+  // True for the first loop to ask about topic, which is then the one to
+  // subscribe the link to it; every loop is handed the topic's messages.
+  bool claim_topic(const std::string& topic);
+
+private:
+  static void* run(void* arg);
+
+  void on_wakeup(ev::async& w, int revents);
+  void on_readable(ev::io& w, int revents);
+  void on_writable(ev::io& w, int revents);
+
+  void write_batch(std::string& batch);
+  void route(Reply& parsed);
+  void hand_off(Producer* p, Reply* rep);
+};
+
+#endif
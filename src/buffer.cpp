@@ -1,16 +1,57 @@
 #include "buffer.hpp"
 
 #include <errno.h>
+#include <string.h>
+#include <arpa/inet.h>
 
-Buffer::Buffer(size_t size)
-  : buffer_(new uint8_t[size])
-  , read_pos_(buffer_)
-  , write_pos_(buffer_)
-  , limit_(write_pos_ + size)
+Buffer::Buffer(size_t size, size_t max)
+  : seg_(size)
+  , read_pos_(seg_.bytes())
+  , write_pos_(seg_.bytes())
+  , limit_(seg_.bytes() + size)
+  , max_(max)
 {}
 
+// Make sure size bytes starting at read_pos() fit in the buffer, sliding
+// the unread data to the front or moving it to a bigger (or merely
+// unshared) segment as needed.
+void Buffer::reserve(size_t size) {
+  if(read_pos_ + size <= limit_) return;
+
+  const size_t avail = read_available();
+
+  if(size <= seg_.size() && !seg_.shared_p()) {
+    memmove(seg_.bytes(), read_pos_, avail);
+  } else {
+    Segment fresh(size > seg_.size() ? size : seg_.size());
+    memcpy(fresh.bytes(), read_pos_, avail);
+    seg_ = fresh;
+  }
+
+  read_pos_ = seg_.bytes();
+  write_pos_ = read_pos_ + avail;
+  limit_ = read_pos_ + seg_.size();
+}
+
 ssize_t Buffer::fill(int fd) {
-  const size_t left = limit_ - write_pos_;
+  const size_t cap = seg_.size();
+
+  const size_t avail = read_available();
+
+  if(max_ && avail >= max_) {
+    errno = ENOBUFS;
+    return -1;
+  }
+
+  if((size_t)(limit_ - write_pos_) < cap / 4) {
+    size_t want = avail + cap / 2;
+    if(max_ && want > max_) want = max_;
+
+    reserve(want);
+  }
+
+  size_t left = limit_ - write_pos_;
+  if(max_ && left > max_ - avail) left = max_ - avail;
 
   for(;;) {
     const ssize_t got = recv(fd, write_pos_, left, 0);
@@ -6,14 +6,24 @@
 
 #include <iostream>
 
+#include "segment.hpp"
+
+// A read buffer over a Segment. Consumers that need bytes to outlive the
+// next read take a reference to segment(); once that happens the buffer
+// stops rewinding over them and moves any unread tail to a fresh segment
+// the next time it needs room.
 class Buffer {
-  uint8_t* const buffer_;
+  Segment seg_;
   uint8_t* read_pos_;
   uint8_t* write_pos_;
   uint8_t* limit_;
+  size_t max_;   // the most it may hold unread, 0 for no limit
+
+  Buffer(const Buffer&);
+  Buffer& operator=(const Buffer&);
 
 public:
-  Buffer(size_t size);
+  Buffer(size_t size, size_t max = 0);
 
   uint8_t* read_pos() {
     return read_pos_;
@@ -23,6 +33,14 @@ public:
     return write_pos_ - read_pos_;
   }
 
+  const Segment& segment() {
+    return seg_;
+  }
+
+  void reserve(size_t size);
+
+  // Reads what's there from fd, growing to make room, but fails with
+  // ENOBUFS rather than hold more than max unread.
   ssize_t fill(int fd);
 
   int read_int32();
@@ -38,10 +56,11 @@ public:
     }
 
     // If we've consumed all the data, then auto-rewind
-    // back to the front of the buffer
-    if(read_pos_ == write_pos_) {
-      read_pos_ = buffer_;
-      write_pos_ = buffer_;
+    // back to the front of the buffer, unless someone is still
+    // holding on to what's there.
+    if(read_pos_ == write_pos_ && !seg_.shared_p()) {
+      read_pos_ = seg_.bytes();
+      write_pos_ = seg_.bytes();
     }
   }
 };
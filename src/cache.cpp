@@ -0,0 +1,390 @@
+#include "cache.hpp"
+#include "util.hpp"
+
+#include "http.pb.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <strings.h>
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+// How long a stale entry waits before another refresh is sent for it,
+// should the last one not have come back with something storable.
+static const ev_tstamp cRevalidateRetry = 1;
+
+static std::string lowercase(const char* str, size_t size) {
+  std::string out(str, size);
+
+  for(size_t i = 0; i < out.size(); i++) out[i] = tolower(out[i]);
+
+  return out;
+}
+
+static const char* request_header_name(const http::Header& h) {
+  return h.has_key() ? header_key_name(h.key()) : h.custom_key().c_str();
+}
+
+// Look up name (lowercase) in headers as built by flatten_headers.
+static const char* flat_header(const std::string& headers,
+                               const std::string& name, size_t& size) {
+  size_t at = 0;
+
+  while(at < headers.size()) {
+    size_t name_end = headers.find('\0', at);
+    size_t value_end = headers.find('\0', name_end + 1);
+
+    if(headers.compare(at, name_end - at, name) == 0) {
+      size = value_end - name_end - 1;
+      return headers.data() + name_end + 1;
+    }
+
+    at = value_end + 1;
+  }
+
+  size = 0;
+  return "";
+}
+
+static bool authorized_p(http::Request& req) {
+  for(int i = 0; i < req.headers_size(); i++) {
+    if(strcasecmp(request_header_name(req.headers(i)), "authorization") == 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Whether headers, as built by flatten_headers, has an Authorization.
+static bool authorized_p(const std::string& headers) {
+  static const std::string sName("authorization");
+  size_t at = 0;
+
+  while(at < headers.size()) {
+    size_t name_end = headers.find('\0', at);
+    if(headers.compare(at, name_end - at, sName) == 0) return true;
+
+    at = headers.find('\0', name_end + 1) + 1;
+  }
+
+  return false;
+}
+
+// base plus name=value for each Vary header. A header the request didn't
+// send keys the same as an empty one.
+static std::string variant_key(const std::string& base,
+                               const std::string& vary,
+                               const std::string& headers) {
+  std::string key = base;
+  size_t at = 0;
+
+  while(at < vary.size()) {
+    size_t end = vary.find('\0', at);
+    std::string name = vary.substr(at, end - at);
+
+    size_t size;
+    const char* value = flat_header(headers, name, size);
+
+    key.push_back('\n');
+    key.append(name);
+    key.push_back('=');
+    key.append(value, size);
+
+    at = end + 1;
+  }
+
+  return key;
+}
+
+// Seconds the response stays fresh, and may then be served stale while
+// it's refreshed. Only max-age (or s-maxage, which wins) makes a response
+// cacheable; no-store, no-cache and private rule it out. public,
+// s-maxage and must-revalidate also let it answer requests carrying
+// Authorization.
+static bool freshness(const std::string& cache_control,
+                      ev_tstamp& ttl, ev_tstamp& swr, bool& authorized) {
+  ttl = -1;
+  swr = 0;
+  authorized = false;
+
+  bool shared = false;
+  std::string cc = lowercase(cache_control.data(), cache_control.size());
+  size_t at = 0;
+
+  while(at < cc.size()) {
+    size_t end = cc.find(',', at);
+    if(end == std::string::npos) end = cc.size();
+
+    while(at < end && isspace(cc[at])) at++;
+
+    std::string directive = cc.substr(at, end - at);
+
+    while(!directive.empty() && isspace(directive[directive.size() - 1])) {
+      directive.erase(directive.size() - 1);
+    }
+
+    if(directive == "no-store" || directive == "no-cache" ||
+       directive == "private") {
+      return false;
+    } else if(directive.compare(0, 9, "s-maxage=") == 0) {
+      ttl = atoi(directive.c_str() + 9);
+      shared = true;
+      authorized = true;
+    } else if(directive == "public" || directive == "must-revalidate") {
+      authorized = true;
+    } else if(directive.compare(0, 8, "max-age=") == 0) {
+      if(!shared) ttl = atoi(directive.c_str() + 8);
+    } else if(directive.compare(0, 23, "stale-while-revalidate=") == 0) {
+      swr = atoi(directive.c_str() + 23);
+    }
+
+    at = end + 1;
+  }
+
+  return ttl > 0;
+}
+
+// Header names as a sorted, NUL separated lowercase list. Vary: * means
+// the response can't be reused at all.
+static bool parse_vary(const std::string& vary, std::string& out) {
+  std::vector<std::string> names;
+  std::string v = lowercase(vary.data(), vary.size());
+  size_t at = 0;
+
+  while(at < v.size()) {
+    size_t end = v.find(',', at);
+    if(end == std::string::npos) end = v.size();
+
+    while(at < end && isspace(v[at])) at++;
+
+    size_t stop = end;
+    while(stop > at && isspace(v[stop - 1])) stop--;
+
+    if(stop > at) {
+      std::string name = v.substr(at, stop - at);
+      if(name == "*") return false;
+      names.push_back(name);
+    }
+
+    at = end + 1;
+  }
+
+  std::sort(names.begin(), names.end());
+
+  out.clear();
+
+  for(size_t i = 0; i < names.size(); i++) {
+    out.append(names[i]);
+    out.push_back('\0');
+  }
+
+  return true;
+}
+
+ResponseCache::ResponseCache(size_t budget)
+  : shard_budget_(budget / cShards)
+{
+  for(int i = 0; i < cShards; i++) {
+    pthread_mutex_init(&shards_[i].lock, NULL);
+  }
+}
+
+ResponseCache::~ResponseCache() {
+  for(int i = 0; i < cShards; i++) {
+    Shard& s = shards_[i];
+
+    for(Lru::iterator j = s.lru.begin(); j != s.lru.end(); ++j) {
+      delete *j;
+    }
+
+    pthread_mutex_destroy(&s.lock);
+  }
+}
+
+std::string ResponseCache::base_key(http::Request& req) {
+  if(req.has_custom_method() || req.method() != http::Request_Method_GET) {
+    return std::string();
+  }
+
+  std::string key("GET ");
+
+  for(int i = 0; i < req.headers_size(); i++) {
+    const http::Header& h = req.headers(i);
+    const char* name = request_header_name(h);
+
+    if(strcasecmp(name, "cache-control") == 0 ||
+       strcasecmp(name, "pragma") == 0) {
+      // The client wants it from the source; don't answer from here.
+      if(h.value().find("no-cache") != std::string::npos) {
+        return std::string();
+      }
+    } else if(strcasecmp(name, "cookie") == 0) {
+      // Responses to cookies are as good as private, whatever they say.
+      return std::string();
+    } else if(strcasecmp(name, "host") == 0) {
+      key.append(lowercase(h.value().data(), h.value().size()));
+    }
+  }
+
+  key.push_back(' ');
+  key.append(req.url());
+
+  return key;
+}
+
+std::string ResponseCache::flatten_headers(http::Request& req) {
+  std::string out;
+
+  for(int i = 0; i < req.headers_size(); i++) {
+    const http::Header& h = req.headers(i);
+    const char* name = request_header_name(h);
+
+    out.append(lowercase(name, strlen(name)));
+    out.push_back('\0');
+    out.append(h.value());
+    out.push_back('\0');
+  }
+
+  return out;
+}
+
+ResponseCache::Shard& ResponseCache::shard(const std::string& base) {
+  // FNV-1a
+  uint32_t hash = 2166136261u;
+
+  for(size_t i = 0; i < base.size(); i++) {
+    hash = (hash ^ (uint8_t)base[i]) * 16777619u;
+  }
+
+  return shards_[hash % cShards];
+}
+
+ResponseCache::Result ResponseCache::lookup(const std::string& base,
+                                            http::Request& req,
+                                            ev_tstamp now,
+                                            Segment& response) {
+  Shard& s = shard(base);
+  Result result = eMiss;
+
+  pthread_mutex_lock(&s.lock);
+
+  std::map<std::string, Variants>::iterator v = s.vary.find(base);
+
+  if(v != s.vary.end()) {
+    const std::string& names = v->second.names;
+
+    Entries::iterator i = s.entries.find(
+      names.empty() ? base : variant_key(base, names, flatten_headers(req)));
+
+    if(i != s.entries.end() &&
+       (i->second->authorized || !authorized_p(req))) {
+      Entry* entry = i->second;
+
+      if(now < entry->fresh_until) {
+        result = eFresh;
+      } else if(now < entry->stale_until) {
+        if(now - entry->revalidated >= cRevalidateRetry) {
+          entry->revalidated = now;
+          result = eRevalidate;
+        } else {
+          result = eStale;
+        }
+      } else {
+        remove(s, entry);
+      }
+
+      if(result != eMiss) {
+        response = entry->response;
+        s.lru.splice(s.lru.begin(), s.lru, entry->position);
+      }
+    }
+  }
+
+  pthread_mutex_unlock(&s.lock);
+
+  return result;
+}
+
+bool ResponseCache::store(const std::string& base, const std::string& headers,
+                          const std::string& cache_control,
+                          const std::string& vary,
+                          const Segment& response, ev_tstamp now) {
+  ev_tstamp ttl, swr;
+  bool authorized;
+  std::string names;
+
+  if(!freshness(cache_control, ttl, swr, authorized)) return false;
+  if(!authorized && authorized_p(headers)) return false;
+  if(!parse_vary(vary, names)) return false;
+  if(response.size() > shard_budget_) return false;
+
+  std::string key = names.empty() ? base : variant_key(base, names, headers);
+
+  Shard& s = shard(base);
+
+  pthread_mutex_lock(&s.lock);
+
+  Entries::iterator i = s.entries.find(key);
+  if(i != s.entries.end()) remove(s, i->second);
+
+  Variants& variants = s.vary[base];
+  variants.names = names;
+  variants.entries++;
+
+  Entry* entry = new Entry;
+  entry->key = key;
+  entry->response = response;
+  entry->fresh_until = now + ttl;
+  entry->stale_until = now + ttl + swr;
+  entry->authorized = authorized;
+
+  s.lru.push_front(entry);
+  entry->position = s.lru.begin();
+  s.entries[key] = entry;
+  s.bytes += response.size();
+
+  while(s.bytes > shard_budget_) remove(s, s.lru.back());
+
+  pthread_mutex_unlock(&s.lock);
+
+  return true;
+}
+
+void ResponseCache::remove(Shard& s, Entry* entry) {
+  std::map<std::string, Variants>::iterator v =
+    s.vary.find(entry->key.substr(0, entry->key.find('\n')));
+
+  if(--v->second.entries == 0) s.vary.erase(v);
+
+  s.bytes -= entry->response.size();
+  s.entries.erase(entry->key);
+  s.lru.erase(entry->position);
+
+  delete entry;
+}
+
+std::string ResponseCache::json() {
+  size_t entries = 0;
+  size_t bytes = 0;
+
+  for(int i = 0; i < cShards; i++) {
+    Shard& s = shards_[i];
+
+    pthread_mutex_lock(&s.lock);
+    entries += s.entries.size();
+    bytes += s.bytes;
+    pthread_mutex_unlock(&s.lock);
+  }
+
+  std::stringstream out;
+
+  out << "{\"entries\":" << entries
+      << ",\"bytes\":" << bytes
+      << ",\"budget\":" << shard_budget_ * cShards
+      << "}";
+
+  return out.str();
+}
@@ -0,0 +1,130 @@
+#ifndef CACHE_HPP
+#define CACHE_HPP
+
+#include <pthread.h>
+
+#include <list>
+#include <map>
+#include <string>
+
+#include <ev++.h>
+
+#include "segment.hpp"
+
+namespace http {
+  class Request;
+}
+
+// Responses to GETs, kept for as long as the worker's Cache-Control says
+// they stay fresh (plus any stale-while-revalidate window), so repeats
+// are answered without a broker round trip. Each entry holds the whole
+// response, status line to body, in a single segment that a hit hands
+// straight to the client's write queue.
+//
+// Entries are keyed by method, Host and URL plus the values of whatever
+// request headers the last response for that URL named in Vary. Requests
+// with a Cookie skip the cache, and ones with Authorization only get or
+// leave responses that say a shared cache may keep them (RFC 7234 3.2).
+// One cache is shared by every loop, split into shards that each have a
+// lock, an LRU list and an equal part of the memory budget.
+class ResponseCache {
+public:
+  enum Result {
+    eMiss,
+    eFresh,
+    eStale,        // serve it; someone is already refreshing it
+    eRevalidate    // serve it, and send the request on to refresh it
+  };
+
+  static const int cShards = 16;
+
+private:
+  struct Entry;
+  typedef std::list<Entry*> Lru;
+
+  struct Entry {
+    std::string key;
+    Segment response;
+    ev_tstamp fresh_until;
+    ev_tstamp stale_until;
+    ev_tstamp revalidated;   // when a refresh last went out
+    bool authorized;         // may answer requests with Authorization
+    Lru::iterator position;
+
+    Entry()
+      : key()
+      , response()
+      , fresh_until(0)
+      , stale_until(0)
+      , revalidated(0)
+      , authorized(false)
+      , position()
+    {}
+  };
+
+  typedef std::map<std::string, Entry*> Entries;
+
+  struct Variants {
+    std::string names;
+    int entries;
+
+    Variants()
+      : names()
+      , entries(0)
+    {}
+  };
+
+  struct Shard {
+    pthread_mutex_t lock;
+    Entries entries;
+    Lru lru;               // most recently used first
+    size_t bytes;
+
+    // By base key, the Vary header names (lowercase, sorted and NUL
+    // separated) of the last response, and how many entries there are.
+    std::map<std::string, Variants> vary;
+
+    Shard()
+      : lock()
+      , entries()
+      , lru()
+      , bytes(0)
+      , vary()
+    {}
+  };
+
+  Shard shards_[cShards];
+  size_t shard_budget_;
+
+public:
+  ResponseCache(size_t budget);
+  ~ResponseCache();
+
+  // Method, Host and URL. Empty if the request can't be answered from
+  // the cache.
+  static std::string base_key(http::Request& req);
+
+  // The request's headers flattened to lowercase name, value pairs,
+  // enough to key a response by whatever it turns out to Vary on.
+  static std::string flatten_headers(http::Request& req);
+
+  Result lookup(const std::string& base, http::Request& req, ev_tstamp now,
+                Segment& response);
+
+  // Store a response for the request behind base and headers, if the
+  // Cache-Control and Vary it carries allow.
+  bool store(const std::string& base, const std::string& headers,
+             const std::string& cache_control, const std::string& vary,
+             const Segment& response, ev_tstamp now);
+
+  std::string json();
+
+private:
+  Shard& shard(const std::string& base);
+  void remove(Shard& s, Entry* entry);
+
+  ResponseCache(const ResponseCache&);
+  ResponseCache& operator=(const ResponseCache&);
+};
+
+#endif
@@ -0,0 +1,99 @@
+#include "compact.hpp"
+#include "util.hpp"
+
+#include "http.pb.h"
+
+#include <string.h>
+
+static void put16(std::string& out, size_t at, uint16_t v) {
+  out[at] = v & 0xff;
+  out[at + 1] = v >> 8;
+}
+
+static void put32(std::string& out, size_t at, uint32_t v) {
+  out[at] = v & 0xff;
+  out[at + 1] = (v >> 8) & 0xff;
+  out[at + 2] = (v >> 16) & 0xff;
+  out[at + 3] = v >> 24;
+}
+
+static void put64(std::string& out, size_t at, uint64_t v) {
+  put32(out, at, v & 0xffffffff);
+  put32(out, at + 4, v >> 32);
+}
+
+// Append data (plus a NUL) and point the span at 'at' to it.
+static void put_span(std::string& out, size_t at,
+                     const char* data, size_t size) {
+  put32(out, at, out.size());
+  put32(out, at + 4, size);
+
+  out.append(data, size);
+  out.push_back('\0');
+}
+
+static void put_span(std::string& out, size_t at, const std::string& str) {
+  put_span(out, at, str.data(), str.size());
+}
+
+// The fixed part and header table are laid down first, then each string
+// is appended once and its span patched in, so the request is written in
+// a single pass.
+void compact_encode_request(http::Request& req, std::string& out) {
+  size_t table = cCompactRequestSize;
+  size_t data = table + req.headers_size() * cCompactHeaderSize;
+
+  size_t need = data + req.url().size() + req.body().size() +
+                req.reply_to().size() + req.bulk_reply_to().size() + 32;
+
+  for(int i = 0; i < req.headers_size(); i++) {
+    const http::Header& h = req.headers(i);
+    need += h.custom_key().size() + h.value().size() + 32;
+  }
+
+  out.clear();
+  out.reserve(need);
+  out.resize(data, '\0');
+
+  out[0] = 'H';
+  out[1] = 'C';
+  out[2] = cCompactVersion;
+  out[3] = eCompactRequest;
+  put32(out, 4, req.stream_id());
+  put32(out, 60, req.stream_id() >> 32);
+
+  out[8] = req.version_major();
+  out[9] = req.version_minor();
+  put16(out, 10, req.headers_size());
+
+  if(req.has_custom_method()) {
+    put_span(out, 12, req.custom_method());
+  } else {
+    put_span(out, 12, http::Request_Method_Name(req.method()));
+  }
+
+  put_span(out, 20, req.url());
+
+  if(req.has_body()) put_span(out, 28, req.body());
+  if(req.has_reply_to()) put_span(out, 36, req.reply_to());
+  if(req.has_bulk_reply_to()) put_span(out, 44, req.bulk_reply_to());
+
+  put64(out, 52, req.deadline());
+
+  for(int i = 0; i < req.headers_size(); i++) {
+    const http::Header& h = req.headers(i);
+    size_t at = table + i * cCompactHeaderSize;
+
+    if(h.has_key()) {
+      const char* name = header_key_name(h.key());
+
+      put16(out, at, h.key());
+      put_span(out, at + 4, name, strlen(name));
+    } else {
+      put16(out, at, cCompactCustomKey);
+      put_span(out, at + 4, h.custom_key());
+    }
+
+    put_span(out, at + 12, h.value());
+  }
+}
@@ -0,0 +1,73 @@
+#ifndef COMPACT_HPP
+#define COMPACT_HPP
+
+#include <stdint.h>
+
+#include <string>
+
+namespace http {
+  class Request;
+}
+
+// A fixed layout alternative to http::Request/http::Response, sent with
+// the eCompact flag to destinations routed with ",compact". Every field
+// sits at a known offset or behind an offset table, so a worker can read
+// it straight out of the payload without running a protobuf parser.
+//
+// All integers are little-endian. A span is a u32 offset from the start
+// of the payload followed by a u32 size; strings a span points at are
+// followed by a NUL that the size doesn't count. An absent field is the
+// span {0, 0}.
+//
+//   0   u8[2]  magic "HC"
+//   2   u8     version (cCompactVersion)
+//   3   u8     kind (eCompactRequest or eCompactResponse)
+//   4   u32    stream_id, low half
+//
+// Request:
+//   8   u8     version_major
+//   9   u8     version_minor
+//   10  u16    header_count
+//   12  span   method
+//   20  span   url
+//   28  span   body
+//   36  span   reply_to
+//   44  span   bulk_reply_to
+//   52  u64    deadline (ms since the Unix epoch, 0 for none)
+//   60  u32    stream_id, high half
+//   64  header table
+//
+// Response:
+//   8   u16    status
+//   10  u16    header_count
+//   12  span   body
+//   20  u32    stream_id, high half
+//   24  header table
+//
+// Each header table entry is 20 bytes: a u16 http::Header_Key (0xffff
+// for a custom header), a u16 of padding, then the name and value spans.
+// The name is always filled in, even for well known keys.
+
+static const uint8_t cCompactVersion = 3;
+
+enum CompactKind {
+  eCompactRequest = 1,
+  eCompactResponse = 2
+};
+
+static const int cCompactRequestSize = 64;
+static const int cCompactResponseSize = 24;
+static const int cCompactHeaderSize = 20;
+static const uint16_t cCompactCustomKey = 0xffff;
+
+static inline uint16_t compact_get16(const uint8_t* p) {
+  return p[0] | (p[1] << 8);
+}
+
+static inline uint32_t compact_get32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+void compact_encode_request(http::Request& req, std::string& out);
+
+#endif
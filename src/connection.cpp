@@ -6,6 +6,7 @@
 
 #include <errno.h>
 #include <assert.h>
+#include <limits.h>
 #include <unistd.h>
 #include <sys/socket.h>
 
@@ -13,6 +14,9 @@
 #include "server.hpp"
 #include "connection.hpp"
 #include "action.hpp"
+#include "reply.hpp"
+#include "h2.hpp"
+#include "websocket.hpp"
 
 #include "wire.pb.h"
 
@@ -20,6 +24,10 @@
 
 #include "http_parser.h"
 
+#ifdef FAST_PARSER
+#include "fast_parser.hpp"
+#endif
+
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
 
@@ -67,26 +75,46 @@ int cb_done(http_parser* p) {
   return 0;
 }
 
-Connection::Connection(Server& s, int id, int fd)
+const size_t Connection::cMaxClientRead = READ_BUFFER + WebSocket::cMaxFrame;
+
+Connection::Connection(Server& s, int id, int fd, size_t max_read)
   : id_(id)
   , sock_(fd)
   , read_w_(s.loop())
   , write_w_(s.loop())
   , open_(true)
   , server_(s)
-  , buffer_(1024)
+  , buffer_(1024, max_read)
   , state_(eReadSize)
   , writer_started_(false)
   , inflight_max_(1)
   , hstate_(eNone)
+  , field_()
+  , value_()
   , set_body_(false)
+  , body_()
+  , expect_100_(false)
+  , closing_(false)
+  , lingering_(false)
+  , streams_()
+  , fresh_(true)
+  , h2_(0)
+  , session_(0)
+  , h2_stream_(0)
+  , ws_(0)
+  , timer_(id)
+  , timeout_(eIdleTimeout)
 {
   read_w_.set<Connection, &Connection::on_readable>(this);
   write_w_.set<Connection, &Connection::on_writable>(this);
 
   sock_.set_nonblock();
 
+#ifdef FAST_PARSER
+  fast_parser_init(&parser_);
+#else
   http_parser_init(&parser_, HTTP_REQUEST);
+#endif
   parser_.data = this;
 
   settings_.on_message_begin = cb_begin;
@@ -99,7 +127,45 @@ Connection::Connection(Server& s, int id, int fd)
   settings_.on_message_complete = cb_done;
 }
 
+// A stream of an HTTP/2 connection, which has no socket of its own.
+Connection::Connection(Server& s, int id, H2Session& session,
+                       uint32_t stream)
+  : id_(id)
+  , sock_(-1)
+  , read_w_(s.loop())
+  , write_w_(s.loop())
+  , open_(false)
+  , server_(s)
+  , buffer_(0)
+  , state_(eReadSize)
+  , need_(0)
+  , writer_started_(false)
+  , inflight_max_(1)
+  , parser_()
+  , settings_()
+  , req_()
+  , hstate_(eNone)
+  , field_()
+  , value_()
+  , set_body_(false)
+  , body_()
+  , expect_100_(false)
+  , closing_(false)
+  , lingering_(false)
+  , streams_()
+  , fresh_(false)
+  , h2_(0)
+  , session_(&session)
+  , h2_stream_(stream)
+  , ws_(0)
+  , timer_(id)
+  , timeout_(eIdleTimeout)
+{}
+
 Connection::~Connection() {
+  delete h2_;
+  delete ws_;
+
   if(open_) {
     read_w_.stop();
 
@@ -119,34 +185,24 @@ Connection::~Connection() {
   }
 }
 
-void Connection::clear() {}
-void Connection::set_url(std::string u) {
-  req_.set_url(u);
-}
+// Each request on a keep-alive connection starts from scratch.
+void Connection::clear() {
+  req_.Clear();
 
-#define LOWER(c)            (unsigned char)(c | 0x20)
+  hstate_ = eNone;
+  field_.clear();
+  value_.clear();
 
-static option<http::Header_Key> standard(std::string h) {
-  switch(LOWER(h[0])) {
-  case 'h':
-    if(strcasecmp(h.data(), "host") == 0) {
-      return http::Header_Key_HOST;
-    }
+  set_body_ = false;
+  body_.clear();
 
-    break;
-  case 'a':
-    if(strcasecmp(h.data(), "accept")) {
-      return http::Header_Key_ACCEPT;
-    }
-    break;
-  case 'u':
-    if(strcasecmp(h.data(), "user-agent")) {
-      return http::Header_Key_USER_AGENT;
-    }
-    break;
-  }
+  expect_100_ = false;
 
-  return option<http::Header_Key>();
+  server_.arm_timeout(*this, eHeaderTimeout);
+}
+
+void Connection::set_url(std::string u) {
+  req_.set_url(u);
 }
 
 static bool expect_100(std::string& f, std::string& v) {
@@ -157,8 +213,10 @@ static bool expect_100(std::string& f, std::string& v) {
 void Connection::set_field(std::string f) {
   if(hstate_ == eValue) {
     http::Header* r = req_.add_headers();
-    if(option<http::Header_Key> k = standard(field_)) {
-      r->set_key(*k);
+    int key = header_key(field_.data(), field_.size());
+
+    if(key >= 0) {
+      r->set_key((http::Header_Key)key);
     } else {
       r->set_custom_key(field_);
     }
@@ -184,8 +242,10 @@ void Connection::set_value(std::string v) {
 void Connection::flush_headers() {
   if(hstate_ == eValue) {
     http::Header* r = req_.add_headers();
-    if(option<http::Header_Key> k = standard(field_)) {
-      r->set_key(*k);
+    int key = header_key(field_.data(), field_.size());
+
+    if(key >= 0) {
+      r->set_key((http::Header_Key)key);
     } else {
       r->set_custom_key(field_);
     }
@@ -199,11 +259,19 @@ void Connection::flush_headers() {
     static std::string sContinue("HTTP/1.1 100 Continue\r\n\r\n");
     sock_.write(sContinue);
   }
+
+  if((parser_.flags & F_CHUNKED) ||
+     (parser_.content_length > 0 && parser_.content_length != ULLONG_MAX)) {
+    server_.arm_timeout(*this, eBodyTimeout);
+  }
 }
 
+// Each piece of the body buys the client another body timeout.
 void Connection::set_body(std::string b) {
   set_body_ = true;
   body_ += b;
+
+  server_.arm_timeout(*this, eBodyTimeout);
 }
 
 option<http::Request_Method> req_enum(unsigned char n) {
@@ -224,7 +292,6 @@ option<http::Request_Method> req_enum(unsigned char n) {
 }
 
 void Connection::flush() {
-  req_.set_stream_id(id_);
   req_.set_version_major(parser_.http_major);
   req_.set_version_minor(parser_.http_minor);
 
@@ -238,12 +305,80 @@ void Connection::flush() {
     req_.set_custom_method(http_method_str((http_method)parser_.method));
   }
 
-  server_.deliver(req_);
+  if(h2c_upgrade_p()) {
+    server_.arm_timeout(*this, eHeaderTimeout);
+    upgrade_h2();
+    return;
+  }
+
+  if(parser_.upgrade && WebSocket::upgrade_p(req_) &&
+     server_.routes().match(req_.url()).websocket) {
+    server_.disarm_timeout(*this);
+    ws_ = server_.open_socket(*this, req_);
+    if(!ws_) signal_cleanup();
+    return;
+  }
+
+  server_.arm_timeout(*this, eIdleTimeout);
+  server_.deliver(*this, req_);
+}
+
+// An Upgrade: h2c with no body to read before switching. Other upgrades
+// are delivered as they always were.
+bool Connection::h2c_upgrade_p() {
+  if(!parser_.upgrade || (parser_.flags & F_CHUNKED)) return false;
+
+  if(parser_.content_length > 0 && parser_.content_length != ULLONG_MAX) {
+    return false;
+  }
+
+  bool h2c = false;
+  bool settings = false;
+
+  for(int i = 0; i < req_.headers_size(); i++) {
+    const http::Header& h = req_.headers(i);
+
+    if(h.has_key()) {
+      if(h.key() == http::Header_Key_UPGRADE) {
+        h2c = strcasecmp(h.value().c_str(), "h2c") == 0;
+      }
+    } else if(strcasecmp(h.custom_key().c_str(), "http2-settings") == 0) {
+      settings = true;
+    }
+  }
+
+  return h2c && settings;
+}
+
+// The request carries on as stream 1 of the new session.
+void Connection::upgrade_h2() {
+  static std::string sSwitching(
+      "HTTP/1.1 101 Switching Protocols\r\n"
+      "Connection: Upgrade\r\n"
+      "Upgrade: h2c\r\n\r\n");
+
+  std::string settings;
+
+  for(int i = 0; i < req_.headers_size(); i++) {
+    const http::Header& h = req_.headers(i);
+
+    if(!h.has_key() &&
+       strcasecmp(h.custom_key().c_str(), "http2-settings") == 0) {
+      settings = h.value();
+    }
+  }
+
+  write(sSwitching);
+
+  h2_ = new H2Session(server_, *this);
+  h2_->upgrade(req_, settings);
 }
 
 void Connection::start() {
   FLOW("New Connection");
   read_w_.start(sock_.fd, EV_READ);
+
+  server_.arm_timeout(*this, eIdleTimeout);
 }
 
 void Connection::start_queue() {
@@ -297,6 +432,9 @@ void Connection::on_queue_readable(ev::io& w, int revents) {
 
       need_ = size;
 
+      // Keep the whole frame contiguous so it can be decoded in place.
+      buffer_.reserve(need_);
+
       state_ = eReadMessage;
     }
 
@@ -309,56 +447,122 @@ void Connection::on_queue_readable(ev::io& w, int revents) {
 
     FLOW("READ MSG");
 
-    wire::Message msg;
+    Reply rep;
 
-    bool ok = msg.ParseFromArray(buffer_.read_pos(), need_);
+    bool ok = rep.parse(buffer_.segment(), buffer_.read_pos(), need_);
 
     buffer_.advance_read(need_);
 
-    if(ok) {
-      handle_message(msg);
-    } else {
+    if(!ok) {
       std::cerr << "Unable to parse request\n";
       reopen_queue();
       return;
     }
 
+    if(rep.inflate(server_.deflate())) {
+      handle_message(rep);
+    } else {
+      std::cerr << "Unable to inflate compressed message\n";
+    }
+
     state_ = eReadSize;
   }
 }
 
-void Connection::handle_message(const wire::Message& msg) {
-  http::Response rep;
-
-  if(!rep.ParseFromString(msg.payload())) {
-    std::cerr << "Get malformed response\n";
-  }
-
-  server_.send_reply(rep);
+void Connection::handle_message(Reply& rep) {
+  server_.handle_reply(rep);
 }
 
 void Connection::on_readable(ev::io& w, int revents) {
   ssize_t s = buffer_.fill(sock_.fd);
 
-  if(s == 0) {
-    read_w_.stop();
-    write_w_.stop();
+  if(s < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) return;
+
+  if(s <= 0) {
+    FLOW("Client closed connection");
+    signal_cleanup();
+    return;
+  }
+
+  if(fresh_) {
+    switch(H2Session::preface(buffer_.read_pos(), buffer_.read_available())) {
+    case H2Session::ePartial:
+      return;
+    case H2Session::eMatch:
+      server_.arm_timeout(*this, eHeaderTimeout);
+      h2_ = new H2Session(server_, *this);
+      h2_->start();
+      break;
+    case H2Session::eMismatch:
+      break;
+    }
+
+    fresh_ = false;
+  }
+
+  if(h2_) {
+    buffer_.advance_read(
+        h2_->execute(buffer_.read_pos(), buffer_.read_available()));
+    return;
+  }
 
-    close(sock_.fd);
+  if(ws_) {
+    buffer_.advance_read(
+        ws_->execute(buffer_.read_pos(), buffer_.read_available()));
     return;
   }
 
+  // The fast parser may leave the tail of a line unread; it stays in
+  // buffer_ and is parsed again once the rest arrives.
+#ifdef FAST_PARSER
+  size_t read = fast_parser_execute(&parser_, &settings_,
+                   (const char*)buffer_.read_pos(), buffer_.read_available());
+#else
   size_t read = http_parser_execute(&parser_, &settings_,
                    (const char*)buffer_.read_pos(), buffer_.read_available());
+#endif
 
   buffer_.advance_read(read);
+
+  // The parser stops for good at anything malformed, so the connection
+  // can't go on.
+  if(HTTP_PARSER_ERRNO(&parser_) != HPE_OK) {
+    static std::string sBadRequest(
+        "HTTP/1.1 400 Bad Request\r\n"
+        "Connection: close\r\n"
+        "Content-Length: 0\r\n\r\n");
+
+    debugs << "Malformed request: "
+           << http_errno_name(HTTP_PARSER_ERRNO(&parser_)) << "\n";
+
+    if(!closing_ && streams_.empty()) write(sBadRequest);
+    signal_cleanup();
+    return;
+  }
+
+  // What follows an upgrade is HTTP/2 or WebSocket frames.
+  if(h2_ && !closing_) {
+    buffer_.advance_read(
+        h2_->execute(buffer_.read_pos(), buffer_.read_available()));
+  } else if(ws_ && !closing_) {
+    buffer_.advance_read(
+        ws_->execute(buffer_.read_pos(), buffer_.read_available()));
+  }
 }
 
 void Connection::cleanup() {
 }
 
 void Connection::signal_cleanup() {
+  if(closing_) return;
+  closing_ = true;
+
+  read_w_.stop();
   server_.remove_connection(this);
+
+  if(h2_) h2_->close();
+  if(ws_) ws_->close();
+  if(session_) session_->closed(h2_stream_);
 }
 
 void Connection::on_writable(ev::io& w, int revents) {
@@ -369,6 +573,14 @@ void Connection::on_writable(ev::io& w, int revents) {
     debugs << "Flushed socket in writable event\n";
     writer_started_ = false;
     write_w_.stop();
+
+    if(lingering_) {
+      signal_cleanup();
+      return;
+    }
+
+    server_.drained(*this);
+    if(h2_) h2_->drained();
     return;
   case eFailure:
     std::cerr << "Error writing to socket in writable event\n";
@@ -378,12 +590,14 @@ void Connection::on_writable(ev::io& w, int revents) {
     return;
   case eWouldBlock:
     debugs << "Flush didn't finish for writeable event\n";
+    server_.drained(*this);
+    if(h2_) h2_->drained();
     return;
   }
 }
 
-bool Connection::write(wire::Message& msg) {
-  switch(sock_.write(msg)) {
+bool Connection::check_write(WriteStatus stat) {
+  switch(stat) {
   case eOk:
     return true;
   case eFailure:
@@ -396,20 +610,78 @@ bool Connection::write(wire::Message& msg) {
     debugs << "Starting writable watcher\n";
     return true;
   }
+
+  return false;
+}
+
+bool Connection::write(wire::Message& msg) {
+  return check_write(sock_.write(msg));
 }
 
 bool Connection::write(const std::string& str) {
-  switch(sock_.write(str)) {
-  case eOk:
-    return true;
-  case eFailure:
-    debugs << "Error writing to socket\n";
+  if(session_) return session_->write(h2_stream_, str);
+
+  return check_write(sock_.write(str));
+}
+
+bool Connection::write(const Segment& seg, const uint8_t* data,
+                       size_t size) {
+  if(session_) return session_->write(h2_stream_, seg, data, size);
+
+  return check_write(sock_.write(seg, data, size));
+}
+
+bool Connection::write(const std::string& head,
+                       const Segment& seg, const uint8_t* data, size_t size) {
+  if(session_) {
+    return session_->write(h2_stream_, head) &&
+           session_->write(h2_stream_, seg, data, size);
+  }
+
+  return check_write(sock_.write(head, seg, data, size));
+}
+
+bool Connection::idle_p() {
+  if(h2_) return h2_->idle_p();
+
+  return !ws_ && !session_ && !closing_ && timeout_ == eIdleTimeout &&
+         streams_.empty() && backlog() == 0;
+}
+
+void Connection::go_away() {
+  if(h2_) {
+    h2_->go_away();
+  } else {
     signal_cleanup();
-    return false;
-  case eWouldBlock:
-    writer_started_ = true;
-    write_w_.start(sock_.fd, EV_WRITE);
-    debugs << "Starting writable watcher\n";
-    return true;
   }
 }
+
+void Connection::close_when_drained() {
+  if(closing_ || lingering_) return;
+
+  if(session_ || backlog() == 0) {
+    signal_cleanup();
+    return;
+  }
+
+  lingering_ = true;
+  read_w_.stop();
+
+  server_.arm_timeout(*this, eLingerTimeout);
+}
+
+void Connection::pause_reading() {
+  if(!session_) read_w_.stop();
+}
+
+void Connection::resume_reading() {
+  if(!session_ && !closing_ && !lingering_) {
+    read_w_.start(sock_.fd, EV_READ);
+  }
+}
+
+size_t Connection::backlog() {
+  if(session_) return session_->backlog(h2_stream_);
+
+  return sock_.pending_bytes();
+}
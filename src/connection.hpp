@@ -11,11 +11,16 @@
 #include "harq.hpp"
 #include "buffer.hpp"
 #include "socket.hpp"
+#include "timer_wheel.hpp"
+#include "timeouts.hpp"
 
 #include "http_parser.h"
 #include "http.pb.h"
 
 class Server;
+class Reply;
+class H2Session;
+class WebSocket;
 
 enum DeliverStatus { eIgnored, eWaitForAck, eConsumed };
 
@@ -56,10 +61,49 @@ private:
 
   bool expect_100_;
 
+  // Set once the connection has been handed to Server::remove_connection.
+  bool closing_;
+
+  // Set while it's waiting for its backlog to drain before closing.
+  bool lingering_;
+
+  // Requests delivered to the broker and not yet answered.
+  std::vector<uint64_t> streams_;
+
+  // Until the first bytes are in, the connection may turn out to be
+  // HTTP/2 with prior knowledge.
+  bool fresh_;
+
+  // Set once the connection speaks HTTP/2.
+  H2Session* h2_;
+
+  // For one stream of an HTTP/2 connection: the session that owns it and
+  // the stream's identifier. Writes go to the session rather than a
+  // socket.
+  H2Session* session_;
+  uint32_t h2_stream_;
+
+  // Set once the connection has been upgraded to a WebSocket.
+  WebSocket* ws_;
+
+  // On the loop's wheel while the client owes us something; WebSockets
+  // and HTTP/2 streams are never timed, while an HTTP/2 connection owes
+  // its preface and SETTINGS, then goes idle once it has no streams.
+  // timeout_ is what it owes, whether or not that's timed.
+  TimerWheel::Timer timer_;
+  Timeout timeout_;
+
 public:
+  // The most a client connection may have read and not yet parsed: a
+  // request's worth, or a WebSocket's largest frame.
+  static const size_t cMaxClientRead;
+
   /*** methods ***/
 
-  Connection(Server& s, int id, int fd);
+  // max_read caps the read buffer, 0 for a broker link, whose replies
+  // are as large as its workers make them.
+  Connection(Server& s, int id, int fd, size_t max_read);
+  Connection(Server& s, int id, H2Session& session, uint32_t stream);
   ~Connection();
 
   Buffer& buffer() {
@@ -70,9 +114,70 @@ public:
     return id_;
   }
 
+  // Writes are queued behind a full socket buffer.
+  bool backed_up_p() {
+    return sock_.pending_p();
+  }
+
+  // Bytes written and still waiting on the socket.
+  size_t backlog();
+
+  std::vector<uint64_t>& streams() {
+    return streams_;
+  }
+
+  WebSocket* websocket() {
+    return ws_;
+  }
+
+  TimerWheel::Timer& timer() {
+    return timer_;
+  }
+
+  Timeout timeout() {
+    return timeout_;
+  }
+
+  void set_timeout(Timeout timeout) {
+    timeout_ = timeout;
+  }
+
+  // Between requests, with nothing of ours left to answer or write.
+  bool idle_p();
+
+  // Yet to send anything at all.
+  bool fresh_p() {
+    return fresh_;
+  }
+
+  // Speaking HTTP/2, from the preface or after an h2c upgrade.
+  bool h2_p() {
+    return h2_ != 0;
+  }
+
+  // Closes an idle connection, telling an HTTP/2 client so first.
+  void go_away();
+
+  // Closes once what's been written has gone out, or once the linger
+  // timeout is up, rather than cutting off the end of it.
+  void close_when_drained();
+
+  // Asked in HTTP/1.0, so can't be sent a chunked body.
+  bool http10_p() {
+    return !session_ && parser_.http_major == 1 && parser_.http_minor == 0;
+  }
+
+  // Stops and restarts reading requests, while a streamed reply's body is
+  // open, so that no later reply can land in the middle of it.
+  void pause_reading();
+  void resume_reading();
+
   bool write(wire::Message& msg);
 
   bool write(const std::string& str);
+  bool write(const Segment& seg, const uint8_t* data, size_t size);
+  bool write(const std::string& head,
+             const Segment& seg, const uint8_t* data, size_t size);
 
   void on_readable(ev::io& w, int revents);
   void on_queue_readable(ev::io& w, int revents);
@@ -83,6 +188,10 @@ public:
 
   void cleanup();
 
+  // Stop reading and hand the connection to Server::remove_connection;
+  // later calls do nothing.
+  void signal_cleanup();
+
   void clear();
   void set_url(std::string u);
   void set_field(std::string f);
@@ -92,10 +201,16 @@ public:
   void flush();
 
 private:
+  Connection(const Connection&);
+  Connection& operator=(const Connection&);
+
+  bool h2c_upgrade_p();
+  void upgrade_h2();
+
   void reopen_queue();
-  void signal_cleanup();
 
-  void handle_message(const wire::Message& msg);
+  void handle_message(Reply& rep);
+  bool check_write(WriteStatus stat);
 };
 
 #endif
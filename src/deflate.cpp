@@ -0,0 +1,172 @@
+#include "deflate.hpp"
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+#include <string.h>
+#include <arpa/inet.h>
+
+// zlib only looks back this far, so that's all of a dictionary that
+// matters (and all the sampler collects).
+static const size_t cDictionarySize = 32 * 1024;
+
+// Sample one payload in this many.
+static const unsigned long cSampleEvery = 16;
+
+// Refuse to inflate anything claiming to be bigger than this.
+static const uint32_t cMaxInflated = 256 * 1024 * 1024;
+
+Deflate::Deflate()
+  : def_()
+  , inf_()
+  , def_ready_(false)
+  , inf_ready_(false)
+  , threshold_(0)
+  , dictionary_()
+  , dictionary_id_(0)
+  , sample_(0)
+  , sampled_(0)
+  , seen_(0)
+{}
+
+Deflate::~Deflate() {
+  if(def_ready_) deflateEnd(&def_);
+  if(inf_ready_) inflateEnd(&inf_);
+  if(sample_) fclose(sample_);
+}
+
+bool Deflate::configure(size_t threshold, std::string dictionary_path) {
+  threshold_ = threshold;
+
+  if(dictionary_path.empty()) return true;
+
+  std::ifstream in(dictionary_path.c_str(), std::ios::in | std::ios::binary);
+  if(!in) {
+    std::cerr << "Unable to read dictionary " << dictionary_path << "\n";
+    return false;
+  }
+
+  std::stringstream data;
+  data << in.rdbuf();
+
+  dictionary_ = data.str();
+
+  if(dictionary_.size() > cDictionarySize) {
+    dictionary_ = dictionary_.substr(dictionary_.size() - cDictionarySize);
+  }
+
+  dictionary_id_ = adler32(adler32(0, Z_NULL, 0),
+                           (const Bytef*)dictionary_.data(),
+                           dictionary_.size());
+
+  return true;
+}
+
+bool Deflate::sample_to(std::string path) {
+  sample_ = fopen(path.c_str(), "wb");
+  if(!sample_) {
+    std::cerr << "Unable to open sample file " << path << "\n";
+    return false;
+  }
+
+  return true;
+}
+
+// Returns false when the payload should go out as is, either because it's
+// under the threshold or because compressing it didn't make it smaller.
+bool Deflate::compress(const std::string& in, std::string& out) {
+  if(!enabled_p() || in.size() < threshold_) return false;
+
+  if(!def_ready_) {
+    if(deflateInit(&def_, Z_DEFAULT_COMPRESSION) != Z_OK) return false;
+    def_ready_ = true;
+  } else {
+    deflateReset(&def_);
+  }
+
+  if(!dictionary_.empty()) {
+    deflateSetDictionary(&def_, (const Bytef*)dictionary_.data(),
+                         dictionary_.size());
+  }
+
+  out.resize(4 + deflateBound(&def_, in.size()));
+
+  uint32_t sz = htonl(in.size());
+  memcpy(&out[0], &sz, 4);
+
+  def_.next_in = (Bytef*)in.data();
+  def_.avail_in = in.size();
+  def_.next_out = (Bytef*)&out[4];
+  def_.avail_out = out.size() - 4;
+
+  if(::deflate(&def_, Z_FINISH) != Z_STREAM_END) return false;
+
+  out.resize(4 + def_.total_out);
+
+  return out.size() < in.size();
+}
+
+bool Deflate::inflate(const uint8_t* in, int size,
+                      Segment& out, int& out_size) {
+  if(size < 4) return false;
+
+  uint32_t len;
+  memcpy(&len, in, 4);
+  len = ntohl(len);
+
+  if(len > cMaxInflated) return false;
+
+  if(!inf_ready_) {
+    if(inflateInit(&inf_) != Z_OK) return false;
+    inf_ready_ = true;
+  } else {
+    inflateReset(&inf_);
+  }
+
+  Segment seg(len > 0 ? len : 1);
+
+  inf_.next_in = (Bytef*)in + 4;
+  inf_.avail_in = size - 4;
+  inf_.next_out = seg.bytes();
+  inf_.avail_out = len;
+
+  int r = ::inflate(&inf_, Z_FINISH);
+
+  if(r == Z_NEED_DICT) {
+    if(dictionary_.empty() || inf_.adler != dictionary_id_) {
+      std::cerr << "Compressed payload needs an unknown dictionary\n";
+      return false;
+    }
+
+    inflateSetDictionary(&inf_, (const Bytef*)dictionary_.data(),
+                         dictionary_.size());
+
+    r = ::inflate(&inf_, Z_FINISH);
+  }
+
+  if(r != Z_STREAM_END || inf_.total_out != len) return false;
+
+  out = seg;
+  out_size = len;
+
+  return true;
+}
+
+// Collect every cSampleEvery'th payload until there's a dictionary's worth.
+// The resulting file can be passed straight back in as the dictionary.
+void Deflate::sample(const uint8_t* data, size_t size) {
+  if(!sample_ || seen_++ % cSampleEvery != 0) return;
+
+  size_t take = cDictionarySize - sampled_;
+  if(size < take) take = size;
+
+  fwrite(data, 1, take, sample_);
+  sampled_ += take;
+
+  if(sampled_ >= cDictionarySize) {
+    std::cerr << "Collected " << sampled_ << " bytes of payload samples\n";
+    fclose(sample_);
+    sample_ = 0;
+  }
+}
@@ -0,0 +1,62 @@
+#ifndef DEFLATE_HPP
+#define DEFLATE_HPP
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <string>
+
+#include <zlib.h>
+
+#include "segment.hpp"
+
+// Payload compression for the broker link. Payloads at least threshold
+// bytes long are deflated (with a shared preset dictionary when one is
+// configured) and flagged eDeflate; flagged payloads coming back are
+// inflated into a fresh segment. The broker is told rather than asked
+// (see link_setup_messages), so it and the workers must support it.
+//
+// Streams are kept between messages and reset rather than re-created,
+// so an instance must only be used from one thread.
+class Deflate {
+  z_stream def_;
+  z_stream inf_;
+  bool def_ready_;
+  bool inf_ready_;
+
+  size_t threshold_;
+  std::string dictionary_;
+  uint32_t dictionary_id_;
+
+  // When set, a sample of payloads is collected here to build a
+  // dictionary from.
+  FILE* sample_;
+  size_t sampled_;
+  unsigned long seen_;
+
+  Deflate(const Deflate&);
+  Deflate& operator=(const Deflate&);
+
+public:
+  Deflate();
+  ~Deflate();
+
+  bool configure(size_t threshold, std::string dictionary_path);
+  bool sample_to(std::string path);
+
+  bool enabled_p() {
+    return threshold_ > 0;
+  }
+
+  uint32_t dictionary_id() {
+    return dictionary_id_;
+  }
+
+  bool compress(const std::string& in, std::string& out);
+  bool inflate(const uint8_t* in, int size,
+               Segment& out, int& out_size);
+
+  void sample(const uint8_t* data, size_t size);
+};
+
+#endif
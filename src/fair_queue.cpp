@@ -0,0 +1,135 @@
+#include "fair_queue.hpp"
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <sstream>
+
+// Bytes a class of weight 1 may send per round.
+static const size_t cQuantum = 16 * 1024;
+
+// Weight of a new sample in each class's average wait.
+static const double cWaitWeight = 0.1;
+
+FairQueue::FairQueue()
+  : classes_()
+  , current_(0)
+  , visited_(false)
+  , queued_(0)
+{
+  classes_.push_back(Class("default", 1));
+}
+
+FairQueue::~FairQueue() {
+  for(size_t i = 0; i < classes_.size(); i++) {
+    for(size_t j = 0; j < classes_[i].items.size(); j++) {
+      delete classes_[i].items[j];
+    }
+  }
+}
+
+// spec is name=weight. Naming "default" reweighs the default class.
+bool FairQueue::add_class(std::string spec) {
+  size_t eq = spec.find('=');
+  int weight = eq == std::string::npos ? 0 : atoi(spec.c_str() + eq + 1);
+
+  if(eq == 0 || weight < 1) {
+    std::cerr << "Bad traffic class " << spec << ", expected name=weight\n";
+    return false;
+  }
+
+  std::string name = spec.substr(0, eq);
+
+  int cls = find(name);
+
+  if(cls >= 0) {
+    classes_[cls].weight = weight;
+  } else {
+    classes_.push_back(Class(name, weight));
+  }
+
+  return true;
+}
+
+int FairQueue::find(const std::string& name) {
+  for(size_t i = 0; i < classes_.size(); i++) {
+    if(classes_[i].name == name) return i;
+  }
+
+  return -1;
+}
+
+void FairQueue::push(int cls, Item* item) {
+  Class& c = classes_[cls];
+
+  c.items.push_back(item);
+  if(c.items.size() > c.max_depth) c.max_depth = c.items.size();
+
+  queued_++;
+}
+
+// Each visit tops a class's deficit up by its quantum, and it sends for
+// as long as its head item fits. A class that empties out loses what's
+// left, so idle classes can't save up for a burst.
+FairQueue::Item* FairQueue::pop(ev_tstamp now) {
+  if(queued_ == 0) return 0;
+
+  for(;;) {
+    Class& c = classes_[current_];
+
+    if(!c.items.empty()) {
+      if(!visited_) {
+        c.deficit += cQuantum * c.weight;
+        visited_ = true;
+      }
+
+      Item* item = c.items.front();
+
+      if(item->payload.size() <= c.deficit) {
+        c.deficit -= item->payload.size();
+        c.items.pop_front();
+        queued_--;
+
+        double waited = now - item->queued;
+
+        c.total++;
+        c.wait += (waited - c.wait) * cWaitWeight;
+        if(waited > c.max_wait) c.max_wait = waited;
+
+        if(c.items.empty()) c.deficit = 0;
+
+        return item;
+      }
+    } else {
+      c.deficit = 0;
+    }
+
+    current_ = (current_ + 1) % classes_.size();
+    visited_ = false;
+  }
+}
+
+std::string FairQueue::json() {
+  std::stringstream out;
+
+  out << "[";
+
+  for(size_t i = 0; i < classes_.size(); i++) {
+    Class& c = classes_[i];
+
+    if(i > 0) out << ",";
+
+    out << "{\"name\":\"" << c.name << "\""
+        << ",\"weight\":" << c.weight
+        << ",\"depth\":" << c.items.size()
+        << ",\"max_depth\":" << c.max_depth
+        << ",\"queued\":" << c.total
+        << ",\"wait_ms\":" << c.wait * 1000
+        << ",\"max_wait_ms\":" << c.max_wait * 1000
+        << "}";
+  }
+
+  out << "]";
+
+  return out.str();
+}
@@ -0,0 +1,86 @@
+#ifndef FAIR_QUEUE_HPP
+#define FAIR_QUEUE_HPP
+
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <ev++.h>
+
+// Where payloads wait while the broker link is backed up, one FIFO per
+// traffic class, drained by deficit round robin so each class gets a
+// share of the link in proportion to its weight no matter how much the
+// others have queued. Class 0 is "default", with a weight of 1.
+class FairQueue {
+public:
+  struct Item {
+    std::string destination;
+    std::string payload;
+    uint32_t flags;
+    std::vector<uint64_t> streams;
+    bool bulk;   // for the bulk lane
+    ev_tstamp queued;
+
+    Item()
+      : destination()
+      , payload()
+      , flags(0)
+      , streams()
+      , bulk(false)
+      , queued(0)
+    {}
+  };
+
+private:
+  struct Class {
+    std::string name;
+    int weight;
+    size_t deficit;
+    std::deque<Item*> items;
+
+    size_t max_depth;
+    uint64_t total;
+    double wait;       // EMA of time spent queued, seconds
+    double max_wait;
+
+    Class(std::string n, int w)
+      : name(n)
+      , weight(w)
+      , deficit(0)
+      , items()
+      , max_depth(0)
+      , total(0)
+      , wait(0)
+      , max_wait(0)
+    {}
+  };
+
+  std::vector<Class> classes_;
+  size_t current_;
+  bool visited_;
+  size_t queued_;
+
+public:
+  FairQueue();
+  ~FairQueue();
+
+  bool add_class(std::string spec);
+  int find(const std::string& name);
+
+  bool empty_p() {
+    return queued_ == 0;
+  }
+
+  void push(int cls, Item* item);
+  Item* pop(ev_tstamp now);
+
+  std::string json();
+
+private:
+  FairQueue(const FairQueue&);
+  FairQueue& operator=(const FairQueue&);
+};
+
+#endif
@@ -0,0 +1,632 @@
+#include "fast_parser.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Where the parser is between calls, kept in http_parser::state.
+enum State {
+  eStart = 1,     // before a request line
+  eHeaders,       // before a header line, or a trailer with F_TRAILING
+  eIdentity,      // inside a Content-Length body
+  eChunkSize,     // before a chunk size line
+  eChunkData,     // inside a chunk
+  eChunkEnd,      // before the CRLF that ends a chunk
+  eDead           // after a message that closes the connection
+};
+
+// Token characters as http_parser.c sees them, split by nibble: c is one
+// when bit (c >> 4) of cTokenLow[c & 15] is set, and cTokenHigh has that
+// bit for each high nibble. The vector code looks both nibbles up with a
+// shuffle; the scalar code indexes them directly.
+static const uint8_t cTokenLow[16] = {
+  0xe8, 0xfc, 0xf8, 0xfc, 0xfc, 0xfc, 0xfc, 0xfc,
+  0xf8, 0xf8, 0xf4, 0x54, 0xd0, 0x54, 0xf4, 0x70
+};
+
+static const uint8_t cTokenHigh[16] = {
+  0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+  0, 0, 0, 0, 0, 0, 0, 0
+};
+
+struct Method {
+  const char* name;
+  size_t size;
+};
+
+static const Method cMethods[] = {
+#define XX(num, name, string) { #string, sizeof(#string) - 1 },
+  HTTP_METHOD_MAP(XX)
+#undef XX
+};
+
+static const size_t cMethodCount = sizeof(cMethods) / sizeof(cMethods[0]);
+
+static inline bool token_p(unsigned char c) {
+  return cTokenLow[c & 15] & cTokenHigh[c >> 4];
+}
+
+static inline bool alpha_p(char c) {
+  return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+}
+
+static inline bool digit_p(char c) {
+  return c >= '0' && c <= '9';
+}
+
+static inline int unhex(char c) {
+  if(digit_p(c)) return c - '0';
+  if((c | 0x20) >= 'a' && (c | 0x20) <= 'f') return (c | 0x20) - 'a' + 10;
+  return -1;
+}
+
+// The first CR or LF in [p, end), or end.
+static const char* find_eol(const char* p, const char* end) {
+#if defined(__AVX2__)
+  const __m256i cr32 = _mm256_set1_epi8('\r');
+  const __m256i lf32 = _mm256_set1_epi8('\n');
+
+  for(; end - p >= 32; p += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    unsigned bits = _mm256_movemask_epi8(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, cr32),
+                        _mm256_cmpeq_epi8(v, lf32)));
+
+    if(bits) return p + __builtin_ctz(bits);
+  }
+#endif
+
+#if defined(__SSE2__)
+  const __m128i cr = _mm_set1_epi8('\r');
+  const __m128i lf = _mm_set1_epi8('\n');
+
+  for(; end - p >= 16; p += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    unsigned bits = _mm_movemask_epi8(
+        _mm_or_si128(_mm_cmpeq_epi8(v, cr), _mm_cmpeq_epi8(v, lf)));
+
+    if(bits) return p + __builtin_ctz(bits);
+  }
+#endif
+
+  for(; p < end; p++) {
+    if(*p == '\r' || *p == '\n') return p;
+  }
+
+  return end;
+}
+
+// The first byte in [p, end) that can't appear in a URL, which in strict
+// http_parser is anything outside '!'..'~'. Compared as signed bytes, so
+// 0x80 and up fall below '!'.
+static const char* url_end(const char* p, const char* end) {
+#if defined(__AVX2__)
+  const __m256i low32 = _mm256_set1_epi8(' ');
+  const __m256i high32 = _mm256_set1_epi8(0x7f);
+
+  for(; end - p >= 32; p += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i ok = _mm256_and_si256(_mm256_cmpgt_epi8(v, low32),
+                                  _mm256_cmpgt_epi8(high32, v));
+    unsigned bits = ~(unsigned)_mm256_movemask_epi8(ok);
+
+    if(bits) return p + __builtin_ctz(bits);
+  }
+#endif
+
+#if defined(__SSE2__)
+  const __m128i low = _mm_set1_epi8(' ');
+  const __m128i high = _mm_set1_epi8(0x7f);
+
+  for(; end - p >= 16; p += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    __m128i ok = _mm_and_si128(_mm_cmpgt_epi8(v, low),
+                               _mm_cmplt_epi8(v, high));
+    unsigned bits = ~(unsigned)_mm_movemask_epi8(ok) & 0xffff;
+
+    if(bits) return p + __builtin_ctz(bits);
+  }
+#endif
+
+  for(; p < end; p++) {
+    if(*p <= ' ' || *p >= 0x7f) return p;
+  }
+
+  return end;
+}
+
+// The first byte in [p, end) that isn't a token character.
+static const char* token_end(const char* p, const char* end) {
+#if defined(__AVX2__)
+  const __m256i low_table32 = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128((const __m128i*)cTokenLow));
+  const __m256i high_table32 = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128((const __m128i*)cTokenHigh));
+  const __m256i nibble32 = _mm256_set1_epi8(0x0f);
+
+  for(; end - p >= 32; p += 32) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)p);
+    __m256i low = _mm256_shuffle_epi8(low_table32,
+                                      _mm256_and_si256(v, nibble32));
+    __m256i high = _mm256_shuffle_epi8(high_table32,
+        _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble32));
+    unsigned bits = _mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(_mm256_and_si256(low, high),
+                          _mm256_setzero_si256()));
+
+    if(bits) return p + __builtin_ctz(bits);
+  }
+#endif
+
+#if defined(__SSSE3__)
+  const __m128i low_table = _mm_loadu_si128((const __m128i*)cTokenLow);
+  const __m128i high_table = _mm_loadu_si128((const __m128i*)cTokenHigh);
+  const __m128i nibble = _mm_set1_epi8(0x0f);
+
+  for(; end - p >= 16; p += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i*)p);
+    __m128i low = _mm_shuffle_epi8(low_table, _mm_and_si128(v, nibble));
+    __m128i high = _mm_shuffle_epi8(high_table,
+        _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    unsigned bits = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_and_si128(low, high), _mm_setzero_si128()));
+
+    if(bits) return p + __builtin_ctz(bits);
+  }
+#endif
+
+  for(; p < end; p++) {
+    if(!token_p(*p)) return p;
+  }
+
+  return end;
+}
+
+// Finds the end of the line starting at p: *eol is its CR or LF, *next
+// the start of the line after. Returns 0 if the line isn't all here yet
+// and -1 for a CR that isn't followed by LF.
+static int find_line(const char* p, const char* end,
+                     const char** eol, const char** next) {
+  const char* e = find_eol(p, end);
+
+  if(e == end) return 0;
+
+  if(*e == '\r') {
+    if(e + 1 == end) return 0;
+    if(e[1] != '\n') return -1;
+
+    *eol = e;
+    *next = e + 2;
+    return 1;
+  }
+
+  *eol = e;
+  *next = e + 1;
+  return 1;
+}
+
+static bool fail(http_parser* parser, http_errno err) {
+  parser->http_errno = err;
+  return false;
+}
+
+static bool notify(http_parser* parser, http_cb cb, http_errno err) {
+  if(cb && cb(parser) != 0) return fail(parser, err);
+  return true;
+}
+
+static bool emit(http_parser* parser, http_data_cb cb, http_errno err,
+                 const char* at, size_t size) {
+  if(cb && cb(parser, at, size) != 0) return fail(parser, err);
+  return true;
+}
+
+// name (any case) against lower.
+static bool named_p(const char* name, size_t size, const char* lower) {
+  for(size_t i = 0; i < size; i++) {
+    if(!lower[i] || (name[i] | 0x20) != lower[i]) return false;
+  }
+
+  return lower[size] == 0;
+}
+
+// A value that is word (any case), maybe followed by spaces.
+static bool value_p(const char* p, const char* end, const char* word) {
+  for(; *word; word++, p++) {
+    if(p == end || (*p | 0x20) != *word) return false;
+  }
+
+  for(; p < end; p++) {
+    if(*p != ' ') return false;
+  }
+
+  return true;
+}
+
+static bool userinfo_p(char c) {
+  return alpha_p(c) || digit_p(c) || strchr("-_.!~*'()%;:&=+$,", c);
+}
+
+static bool method(http_parser* parser, const char* p, size_t size) {
+  for(size_t i = 0; i < cMethodCount; i++) {
+    const Method& m = cMethods[i];
+
+    if(m.size == size && m.name[0] == p[0] && memcmp(m.name, p, size) == 0) {
+      parser->method = i;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// The bytes are already known to be printable, which is all an origin-form
+// URL or "*" needs. Absolute URLs and CONNECT's host:port also get the
+// checks http_parser makes on their scheme and authority.
+static bool url_p(const http_parser* parser, const char* p, const char* end) {
+  if(parser->method != HTTP_CONNECT) {
+    if(*p == '/' || *p == '*') return true;
+    if(!alpha_p(*p)) return false;
+
+    while(p < end && alpha_p(*p)) p++;
+
+    if(end - p < 4 || memcmp(p, "://", 3) != 0) return false;
+    p += 3;
+  }
+
+  bool at = false;
+
+  for(; p < end; p++) {
+    if(*p == '/' || *p == '?') return true;
+
+    if(*p == '@') {
+      if(at) return false;
+      at = true;
+      continue;
+    }
+
+    if(!userinfo_p(*p) && *p != '[' && *p != ']') return false;
+    at = false;
+  }
+
+  return true;
+}
+
+// An HTTP major or minor version, 1 to 3 digits.
+static const char* version(const char* p, const char* end,
+                           unsigned short* out) {
+  const char* start = p;
+  unsigned v = 0;
+
+  for(; p < end && digit_p(*p); p++) {
+    v = v * 10 + (*p - '0');
+    if(v > 999) return 0;
+  }
+
+  if(p == start) return 0;
+
+  *out = v;
+  return p;
+}
+
+static bool request_line(http_parser* parser,
+                         const http_parser_settings* settings,
+                         const char* p, const char* eol) {
+  const char* space = (const char*)memchr(p, ' ', eol - p);
+
+  if(!space || !method(parser, p, space - p)) {
+    return fail(parser, HPE_INVALID_METHOD);
+  }
+
+  for(p = space; p < eol && *p == ' '; p++) ;
+
+  const char* url = p;
+  p = url_end(p, eol);
+
+  if(p == url || (p < eol && *p != ' ') || !url_p(parser, url, p)) {
+    return fail(parser, HPE_INVALID_URL);
+  }
+
+  const char* url_stop = p;
+
+  if(p == eol) {
+    parser->http_major = 0;
+    parser->http_minor = 9;
+  } else {
+    while(p < eol && *p == ' ') p++;
+
+    if(eol - p < 5 || memcmp(p, "HTTP/", 5) != 0) {
+      return fail(parser, HPE_INVALID_CONSTANT);
+    }
+
+    p += 5;
+
+    if(p == eol || *p == '0' ||
+       !(p = version(p, eol, &parser->http_major)) ||
+       p == eol || *p++ != '.' ||
+       !(p = version(p, eol, &parser->http_minor)) ||
+       p != eol) {
+      return fail(parser, HPE_INVALID_VERSION);
+    }
+  }
+
+  return notify(parser, settings->on_message_begin, HPE_CB_message_begin) &&
+         emit(parser, settings->on_url, HPE_CB_url, url, url_stop - url);
+}
+
+// The headers http_parser pulls flags and the body length out of.
+static bool special(http_parser* parser, const char* name, size_t size,
+                    const char* p, const char* end) {
+  switch(size) {
+  case 7:
+    if(named_p(name, size, "upgrade") && p < end) {
+      parser->flags |= F_UPGRADE;
+    }
+    break;
+  case 10:
+  case 16:
+    if(named_p(name, size, "connection") ||
+       named_p(name, size, "proxy-connection")) {
+      if(value_p(p, end, "keep-alive")) {
+        parser->flags |= F_CONNECTION_KEEP_ALIVE;
+      } else if(value_p(p, end, "close")) {
+        parser->flags |= F_CONNECTION_CLOSE;
+      }
+    }
+    break;
+  case 14:
+    if(named_p(name, size, "content-length") && p < end) {
+      if(!digit_p(*p)) return fail(parser, HPE_INVALID_CONTENT_LENGTH);
+
+      uint64_t length = 0;
+
+      for(; p < end; p++) {
+        if(*p == ' ') continue;
+        if(!digit_p(*p)) return fail(parser, HPE_INVALID_CONTENT_LENGTH);
+
+        uint64_t t = length * 10 + (*p - '0');
+
+        if(t / 10 != length || t == UINT64_MAX) {
+          return fail(parser, HPE_INVALID_CONTENT_LENGTH);
+        }
+
+        length = t;
+      }
+
+      parser->content_length = length;
+    }
+    break;
+  case 17:
+    if(named_p(name, size, "transfer-encoding") &&
+       value_p(p, end, "chunked")) {
+      parser->flags |= F_CHUNKED;
+    }
+    break;
+  }
+
+  return true;
+}
+
+// A folded header line is rejected rather than joined to the one before,
+// as RFC 7230 allows.
+static bool header_line(http_parser* parser,
+                        const http_parser_settings* settings,
+                        const char* p, const char* eol) {
+  if(*p == ' ' || *p == '\t') return fail(parser, HPE_INVALID_HEADER_TOKEN);
+
+  const char* colon = token_end(p, eol);
+
+  if(colon == p || colon == eol || *colon != ':') {
+    return fail(parser, HPE_INVALID_HEADER_TOKEN);
+  }
+
+  const char* value = colon + 1;
+  while(value < eol && (*value == ' ' || *value == '\t')) value++;
+
+  return emit(parser, settings->on_header_field, HPE_CB_header_field,
+              p, colon - p) &&
+         emit(parser, settings->on_header_value, HPE_CB_header_value,
+              value, eol - value) &&
+         special(parser, p, colon - p, value, eol);
+}
+
+static bool chunk_size(http_parser* parser, const char* p, const char* eol) {
+  if(*eol != '\r' || p == eol || unhex(*p) < 0) {
+    return fail(parser, HPE_INVALID_CHUNK_SIZE);
+  }
+
+  uint64_t size = 0;
+
+  for(; p < eol && unhex(*p) >= 0; p++) {
+    uint64_t t = size * 16 + unhex(*p);
+
+    if(t / 16 != size || t == UINT64_MAX) {
+      return fail(parser, HPE_INVALID_CONTENT_LENGTH);
+    }
+
+    size = t;
+  }
+
+  // Chunk extensions are skipped, as http_parser does.
+  if(p < eol && *p != ';' && *p != ' ') {
+    return fail(parser, HPE_INVALID_CHUNK_SIZE);
+  }
+
+  parser->content_length = size;
+  return true;
+}
+
+static bool message_done(http_parser* parser,
+                         const http_parser_settings* settings) {
+  parser->state = http_should_keep_alive(parser) ? eStart : eDead;
+
+  return notify(parser, settings->on_message_complete,
+                HPE_CB_message_complete);
+}
+
+// The blank line after the headers or trailers. Returns false either on
+// an error or when the rest of the connection isn't HTTP.
+static bool headers_done(http_parser* parser,
+                         const http_parser_settings* settings) {
+  if(parser->flags & F_TRAILING) return message_done(parser, settings);
+
+  parser->upgrade = (parser->flags & F_UPGRADE) ||
+                    parser->method == HTTP_CONNECT;
+
+  if(settings->on_headers_complete) {
+    switch(settings->on_headers_complete(parser)) {
+    case 0:
+      break;
+    case 1:
+      parser->flags |= F_SKIPBODY;
+      break;
+    default:
+      return fail(parser, HPE_CB_headers_complete);
+    }
+  }
+
+  parser->nread = 0;
+
+  if(parser->upgrade) {
+    message_done(parser, settings);
+    return false;
+  }
+
+  if(parser->flags & F_SKIPBODY) return message_done(parser, settings);
+
+  if(parser->flags & F_CHUNKED) {
+    parser->state = eChunkSize;
+    return true;
+  }
+
+  if(parser->content_length == 0 || parser->content_length == UINT64_MAX) {
+    return message_done(parser, settings);
+  }
+
+  parser->state = eIdentity;
+  return true;
+}
+
+void fast_parser_init(http_parser* parser) {
+  http_parser_init(parser, HTTP_REQUEST);
+  parser->state = eStart;
+}
+
+size_t fast_parser_execute(http_parser* parser,
+                           const http_parser_settings* settings,
+                           const char* data, size_t size) {
+  if(HTTP_PARSER_ERRNO(parser) != HPE_OK) return 0;
+
+  const char* p = data;
+  const char* const end = data + size;
+
+  while(p < end) {
+    const char* eol;
+    const char* next;
+
+    switch(parser->state) {
+    case eStart:
+    case eDead:
+      while(p < end && (*p == '\r' || *p == '\n')) p++;
+      if(p == end) break;
+
+      if(parser->state == eDead) {
+        parser->http_errno = HPE_CLOSED_CONNECTION;
+        return p - data;
+      }
+
+      // fallthrough
+    case eHeaders:
+    case eChunkSize:
+      switch(find_line(p, end, &eol, &next)) {
+      case 0:
+        if(parser->nread + (end - p) > HTTP_MAX_HEADER_SIZE) {
+          parser->http_errno = HPE_HEADER_OVERFLOW;
+        }
+        return p - data;
+      case -1:
+        parser->http_errno = HPE_LF_EXPECTED;
+        return p - data;
+      }
+
+      parser->nread += next - p;
+
+      if(parser->nread > HTTP_MAX_HEADER_SIZE) {
+        parser->http_errno = HPE_HEADER_OVERFLOW;
+        return p - data;
+      }
+
+      if(parser->state == eStart) {
+        parser->flags = 0;
+        parser->content_length = UINT64_MAX;
+
+        if(!request_line(parser, settings, p, eol)) return p - data;
+        parser->state = eHeaders;
+      } else if(parser->state == eChunkSize) {
+        if(!chunk_size(parser, p, eol)) return p - data;
+
+        parser->nread = 0;
+
+        if(parser->content_length == 0) {
+          parser->flags |= F_TRAILING;
+          parser->state = eHeaders;
+        } else {
+          parser->state = eChunkData;
+        }
+      } else if(p == eol) {
+        if(!headers_done(parser, settings)) {
+          return HTTP_PARSER_ERRNO(parser) == HPE_OK ? next - data : p - data;
+        }
+      } else {
+        if(!header_line(parser, settings, p, eol)) return p - data;
+      }
+
+      p = next;
+      break;
+
+    case eIdentity:
+    case eChunkData: {
+      size_t take = end - p;
+      if(take > parser->content_length) take = parser->content_length;
+
+      parser->content_length -= take;
+
+      if(!emit(parser, settings->on_body, HPE_CB_body, p, take)) {
+        return p - data;
+      }
+
+      p += take;
+
+      if(parser->content_length > 0) break;
+
+      if(parser->state == eChunkData) {
+        parser->state = eChunkEnd;
+      } else if(!message_done(parser, settings)) {
+        return p - data;
+      }
+      break;
+    }
+
+    case eChunkEnd:
+      if(end - p < 2) return p - data;
+
+      if(p[0] != '\r' || p[1] != '\n') {
+        parser->http_errno = HPE_STRICT;
+        return p - data;
+      }
+
+      p += 2;
+      parser->state = eChunkSize;
+      break;
+
+    default:
+      parser->http_errno = HPE_INVALID_INTERNAL_STATE;
+      return p - data;
+    }
+  }
+
+  return p - data;
+}
@@ -2,7 +2,31 @@
 #define FLAGS_HPP
 
 enum Flags {
-  eQueue = 1
+  eQueue = 1,
+
+  // The payload is a 4 byte big-endian uncompressed size followed by a
+  // zlib stream (see Deflate).
+  eDeflate = 2,
+
+  // The payload uses the fixed layout in compact.hpp rather than
+  // http::Request/http::Response.
+  eCompact = 4,
+
+  // The payload is an http::RequestBatch or http::ResponseBatch, each
+  // entry of which would otherwise have been a message of its own.
+  eBatch = 8,
+
+  // The payload is an http::Cancel.
+  eCancel = 16,
+
+  // The payload is an http::ResponseChunk continuing a streamed reply.
+  eChunk = 32,
+
+  // The payload is an http::Flow.
+  eFlow = 64,
+
+  // The payload is an http::SocketMessage.
+  eSocket = 128
 };
 
 #endif
@@ -0,0 +1,1112 @@
+#include "h2.hpp"
+#include "server.hpp"
+#include "connection.hpp"
+#include "util.hpp"
+#include "debugs.hpp"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+static const char cPreface[] = "PRI * HTTP/2.0\r\n\r\nSM\r\n\r\n";
+static const size_t cPrefaceSize = sizeof(cPreface) - 1;
+
+static const size_t cFrameHeadSize = 9;
+
+enum FrameType {
+  eDataFrame = 0,
+  eHeadersFrame = 1,
+  ePriorityFrame = 2,
+  eRstStreamFrame = 3,
+  eSettingsFrame = 4,
+  ePushPromiseFrame = 5,
+  ePingFrame = 6,
+  eGoawayFrame = 7,
+  eWindowUpdateFrame = 8,
+  eContinuationFrame = 9
+};
+
+static const uint8_t cEndStream = 0x1;
+static const uint8_t cAck = 0x1;
+static const uint8_t cEndHeaders = 0x4;
+static const uint8_t cPadded = 0x8;
+static const uint8_t cPriority = 0x20;
+
+static const uint32_t cNoError = 0x0;
+static const uint32_t cProtocolError = 0x1;
+static const uint32_t cFlowControlError = 0x3;
+static const uint32_t cStreamClosed = 0x5;
+static const uint32_t cFrameSizeError = 0x6;
+static const uint32_t cRefusedStream = 0x7;
+static const uint32_t cCancel = 0x8;
+static const uint32_t cCompressionError = 0x9;
+static const uint32_t cEnhanceYourCalm = 0xb;
+
+static const uint16_t cMaxConcurrentStreams = 0x3;
+static const uint16_t cInitialWindowSize = 0x4;
+static const uint16_t cMaxFrameSize = 0x5;
+static const uint16_t cMaxHeaderListSize = 0x6;
+
+// What we advertise. Streams past cMaxStreams are refused; request
+// bodies are credited back as they arrive, once half a window's worth
+// has come in.
+static const size_t cMaxStreams = 128;
+static const int64_t cStreamWindow = 1 << 20;
+static const int64_t cConnectionWindow = 1 << 24;
+static const int64_t cDefaultWindow = 65535;
+static const size_t cHeaderTable = 4096;
+
+// No flow control window may go past this (RFC 9113 6.9.1).
+static const int64_t cMaxWindow = 0x7fffffff;
+
+// The default SETTINGS_MAX_FRAME_SIZE, which we don't raise.
+static const size_t cMaxFrame = 16384;
+
+static const size_t cMaxHeaderBlock = 64 * 1024;
+
+// Decoded, as SETTINGS_MAX_HEADER_LIST_SIZE counts it. Requests past it
+// get a 431.
+static const size_t cMaxHeaderList = 64 * 1024;
+
+static std::string sHeadersTooLarge(
+    "HTTP/1.1 431 Request Header Fields Too Large\r\n"
+    "Content-Length: 0\r\n\r\n");
+
+// Request bodies are gathered whole before they're delivered, so they're
+// capped; past it the stream gets a 413.
+static const size_t cMaxBody = 16 * 1024 * 1024;
+
+static std::string sBodyTooLarge(
+    "HTTP/1.1 413 Payload Too Large\r\n"
+    "Content-Length: 0\r\n\r\n");
+
+static uint32_t get32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+         ((uint32_t)p[2] << 8) | p[3];
+}
+
+static void put32(std::string& out, uint32_t v) {
+  out.push_back(v >> 24);
+  out.push_back(v >> 16);
+  out.push_back(v >> 8);
+  out.push_back(v);
+}
+
+static void frame_head(std::string& out, size_t size, uint8_t type,
+                       uint8_t flags, uint32_t stream) {
+  out.push_back(size >> 16);
+  out.push_back(size >> 8);
+  out.push_back(size);
+  out.push_back(type);
+  out.push_back(flags);
+  put32(out, stream);
+}
+
+static void put_setting(std::string& out, uint16_t key, uint32_t value) {
+  out.push_back(key >> 8);
+  out.push_back(key);
+  put32(out, value);
+}
+
+// HTTP2-Settings is base64url without padding; plain base64 is taken too.
+static std::string base64url(const std::string& in) {
+  std::string out;
+  uint32_t acc = 0;
+  int bits = 0;
+
+  for(size_t i = 0; i < in.size(); i++) {
+    char c = in[i];
+    int v;
+
+    if(c >= 'A' && c <= 'Z') {
+      v = c - 'A';
+    } else if(c >= 'a' && c <= 'z') {
+      v = c - 'a' + 26;
+    } else if(c >= '0' && c <= '9') {
+      v = c - '0' + 52;
+    } else if(c == '-' || c == '+') {
+      v = 62;
+    } else if(c == '_' || c == '/') {
+      v = 63;
+    } else {
+      continue;
+    }
+
+    acc = (acc << 6) | v;
+    bits += 6;
+
+    if(bits >= 8) {
+      bits -= 8;
+      out.push_back((acc >> bits) & 0xff);
+    }
+  }
+
+  return out;
+}
+
+H2Session::H2Session(Server& server, Connection& con)
+  : server_(server)
+  , con_(con)
+  , hpack_(cHeaderTable, cMaxHeaderList)
+  , streams_()
+  , preface_(false)
+  , dead_(false)
+  , last_stream_(0)
+  , continuation_(0)
+  , block_end_(false)
+  , block_()
+  , max_frame_(cMaxFrame)
+  , initial_window_(cDefaultWindow)
+  , window_(cDefaultWindow)
+  , received_(0)
+{}
+
+H2Session::~H2Session() {
+  for(Streams::iterator i = streams_.begin(); i != streams_.end(); ++i) {
+    delete i->second;
+  }
+}
+
+H2Session::Preface H2Session::preface(const uint8_t* data, size_t size) {
+  size_t n = std::min(size, cPrefaceSize);
+
+  if(memcmp(data, cPreface, n) != 0) return eMismatch;
+
+  return size >= cPrefaceSize ? eMatch : ePartial;
+}
+
+// Our SETTINGS, which have to be the first thing the client sees, and
+// the connection window opened up beyond the default.
+void H2Session::start() {
+  std::string payload;
+
+  put_setting(payload, cMaxConcurrentStreams, cMaxStreams);
+  put_setting(payload, cInitialWindowSize, cStreamWindow);
+  put_setting(payload, cMaxHeaderListSize, cMaxHeaderList);
+
+  send_frame(eSettingsFrame, 0, 0, payload);
+  send_window(0, cConnectionWindow - cDefaultWindow);
+
+  server_.stats().h2_sessions++;
+}
+
+// req arrived as HTTP/1.1 asking to upgrade, and has had its 101. It
+// becomes stream 1, already half closed.
+void H2Session::upgrade(http::Request& req, const std::string& encoded) {
+  std::string decoded = base64url(encoded);
+
+  if(!settings((const uint8_t*)decoded.data(),
+               decoded.size() - decoded.size() % 6)) {
+    return;
+  }
+
+  start();
+
+  Stream* s = new Stream(1, initial_window_);
+
+  s->req.Swap(&req);
+  s->head_only = s->req.has_method() &&
+                 s->req.method() == http::Request_Method_HEAD;
+  s->ended = true;
+
+  last_stream_ = 1;
+  streams_[1] = s;
+
+  server_.stats().h2_streams++;
+
+  deliver(*s);
+}
+
+size_t H2Session::execute(const uint8_t* data, size_t size) {
+  const uint8_t* p = data;
+  const uint8_t* end = data + size;
+
+  if(!preface_) {
+    switch(preface(p, size)) {
+    case ePartial:
+      return 0;
+    case eMismatch:
+      fail(cProtocolError);
+      return size;
+    case eMatch:
+      break;
+    }
+
+    p += cPrefaceSize;
+    preface_ = true;
+  }
+
+  while(!dead_ && (size_t)(end - p) >= cFrameHeadSize) {
+    size_t length = (p[0] << 16) | (p[1] << 8) | p[2];
+
+    if(length > cMaxFrame) {
+      fail(cFrameSizeError);
+      break;
+    }
+
+    if((size_t)(end - p) < cFrameHeadSize + length) break;
+
+    frame(p[3], p[4], get32(p + 5) & 0x7fffffff,
+          p + cFrameHeadSize, length);
+
+    p += cFrameHeadSize + length;
+  }
+
+  return p - data;
+}
+
+void H2Session::send_frame(uint8_t type, uint8_t flags, uint32_t stream,
+                           const std::string& payload) {
+  std::string out;
+
+  frame_head(out, payload.size(), type, flags, stream);
+  out += payload;
+
+  con_.write(out);
+}
+
+void H2Session::send_window(uint32_t stream, size_t increment) {
+  std::string payload;
+  put32(payload, increment);
+
+  send_frame(eWindowUpdateFrame, 0, stream, payload);
+}
+
+void H2Session::reset(uint32_t stream, uint32_t error) {
+  std::string payload;
+  put32(payload, error);
+
+  send_frame(eRstStreamFrame, 0, stream, payload);
+}
+
+// A connection error: GOAWAY, then close.
+void H2Session::fail(uint32_t error) {
+  debugs << "HTTP/2 connection error " << error << "\n";
+
+  std::string payload;
+  put32(payload, last_stream_);
+  put32(payload, error);
+
+  send_frame(eGoawayFrame, 0, 0, payload);
+  con_.signal_cleanup();
+}
+
+bool H2Session::settings(const uint8_t* p, size_t size) {
+  for(size_t at = 0; at + 6 <= size; at += 6) {
+    uint16_t key = (p[at] << 8) | p[at + 1];
+    uint32_t value = get32(p + at + 2);
+
+    switch(key) {
+    case cInitialWindowSize:
+      if(value > cMaxWindow) {
+        fail(cFlowControlError);
+        return false;
+      }
+
+      for(Streams::iterator i = streams_.begin(); i != streams_.end(); ++i) {
+        i->second->window += (int64_t)value - initial_window_;
+
+        if(i->second->window > cMaxWindow) {
+          fail(cFlowControlError);
+          return false;
+        }
+      }
+
+      initial_window_ = value;
+      break;
+    case cMaxFrameSize:
+      if(value < cMaxFrame || value > 0xffffff) {
+        fail(cProtocolError);
+        return false;
+      }
+
+      max_frame_ = value;
+      break;
+    }
+  }
+
+  return true;
+}
+
+void H2Session::frame(uint8_t type, uint8_t flags, uint32_t id,
+                      const uint8_t* p, size_t size) {
+  if(continuation_ && (type != eContinuationFrame || id != continuation_)) {
+    fail(cProtocolError);
+    return;
+  }
+
+  Streams::iterator i = streams_.find(id);
+  Stream* s = i == streams_.end() ? 0 : i->second;
+
+  switch(type) {
+  case eDataFrame:
+    if(id == 0) {
+      fail(cProtocolError);
+      return;
+    }
+
+    data(id, s, flags, p, size);
+    return;
+
+  case eHeadersFrame:
+    if(id == 0 || !(id & 1)) {
+      fail(cProtocolError);
+      return;
+    }
+
+    if(flags & cPadded) {
+      if(size == 0 || p[0] >= size) {
+        fail(cProtocolError);
+        return;
+      }
+
+      size -= 1 + p[0];
+      p++;
+    }
+
+    if(flags & cPriority) {
+      if(size < 5) {
+        fail(cProtocolError);
+        return;
+      }
+
+      p += 5;
+      size -= 5;
+    }
+
+    block_.assign((const char*)p, size);
+    block_end_ = flags & cEndStream;
+
+    if(flags & cEndHeaders) {
+      headers(id);
+    } else {
+      continuation_ = id;
+    }
+
+    return;
+
+  case eContinuationFrame:
+    if(!continuation_) {
+      fail(cProtocolError);
+      return;
+    }
+
+    block_.append((const char*)p, size);
+
+    if(block_.size() > cMaxHeaderBlock) {
+      fail(cEnhanceYourCalm);
+      return;
+    }
+
+    if(flags & cEndHeaders) {
+      continuation_ = 0;
+      headers(id);
+    }
+
+    return;
+
+  case eRstStreamFrame:
+    if(id == 0 || size != 4) {
+      fail(id ? cFrameSizeError : cProtocolError);
+      return;
+    }
+
+    if(s) finish(s);
+    return;
+
+  case eSettingsFrame:
+    if(id != 0 || size % 6) {
+      fail(id ? cProtocolError : cFrameSizeError);
+      return;
+    }
+
+    if(flags & cAck) return;
+    if(!settings(p, size)) return;
+
+    // The preface is done with, and the connection has only to stay busy.
+    if(con_.timeout() == eHeaderTimeout) {
+      server_.arm_timeout(con_, eIdleTimeout);
+    }
+
+    send_frame(eSettingsFrame, cAck, 0, "");
+    flush_all();
+    return;
+
+  case ePingFrame:
+    if(id != 0 || size != 8) {
+      fail(id ? cProtocolError : cFrameSizeError);
+      return;
+    }
+
+    if(!(flags & cAck)) {
+      send_frame(ePingFrame, cAck, 0, std::string((const char*)p, size));
+    }
+
+    return;
+
+  case eWindowUpdateFrame: {
+    if(size != 4) {
+      fail(cFrameSizeError);
+      return;
+    }
+
+    uint32_t increment = get32(p) & 0x7fffffff;
+
+    if(id == 0) {
+      if(increment == 0) {
+        fail(cProtocolError);
+        return;
+      }
+
+      window_ += increment;
+
+      if(window_ > cMaxWindow) {
+        fail(cFlowControlError);
+        return;
+      }
+
+      flush_all();
+      return;
+    }
+
+    if(!s) return;
+
+    if(increment == 0) {
+      reset(id, cProtocolError);
+      finish(s);
+      return;
+    }
+
+    s->window += increment;
+
+    if(s->window > cMaxWindow) {
+      reset(id, cFlowControlError);
+      finish(s);
+      return;
+    }
+
+    flush(*s);
+    return;
+  }
+
+  case ePushPromiseFrame:
+    fail(cProtocolError);
+    return;
+
+  default:
+    // PRIORITY, GOAWAY and unknown frames need nothing from us; a client
+    // that's going away closes the connection when it's done.
+    return;
+  }
+}
+
+// Request bodies are gathered whole, like HTTP/1.1 ones, and credited
+// back as they arrive. What hasn't been credited yet is what the windows
+// we advertised have taken, so a client sending more than that has
+// ignored them.
+void H2Session::data(uint32_t id, Stream* s, uint8_t flags,
+                     const uint8_t* p, size_t size) {
+  if(received_ + size > (size_t)cConnectionWindow) {
+    fail(cFlowControlError);
+    return;
+  }
+
+  received_ += size;
+
+  if(received_ >= (size_t)cConnectionWindow / 2) {
+    send_window(0, received_);
+    received_ = 0;
+  }
+
+  if(!s || s->ended) {
+    if(id > last_stream_) {
+      fail(cProtocolError);
+    } else {
+      reset(id, cStreamClosed);
+    }
+
+    return;
+  }
+
+  if(s->received + size > (size_t)cStreamWindow) {
+    reset(id, cFlowControlError);
+    finish(s);
+    return;
+  }
+
+  s->received += size;
+
+  if(flags & cPadded) {
+    if(size == 0 || p[0] >= size) {
+      fail(cProtocolError);
+      return;
+    }
+
+    size -= 1 + p[0];
+    p++;
+  }
+
+  // With the response sent, NO_ERROR tells the client to stop sending.
+  if(s->req.body().size() + size > cMaxBody) {
+    s->ended = true;
+    write(id, sBodyTooLarge);
+    reset(id, cNoError);
+    return;
+  }
+
+  s->req.mutable_body()->append((const char*)p, size);
+
+  if(flags & cEndStream) {
+    s->ended = true;
+    deliver(*s);
+    return;
+  }
+
+  if(s->received >= (size_t)cStreamWindow / 2) {
+    send_window(s->id, s->received);
+    s->received = 0;
+  }
+}
+
+// A complete header block opens a stream, or ends one as trailers.
+void H2Session::headers(uint32_t id) {
+  HpackDecoder::Fields fields;
+
+  HpackDecoder::Result result =
+    hpack_.decode((const uint8_t*)block_.data(), block_.size(), fields);
+  block_.clear();
+
+  // The decoder's table is out of step with the client's from here on.
+  if(result == HpackDecoder::eCorrupt) {
+    fail(cCompressionError);
+    return;
+  }
+
+  Streams::iterator i = streams_.find(id);
+
+  if(i != streams_.end()) {
+    Stream* s = i->second;
+
+    if(s->ended || !block_end_) {
+      fail(cProtocolError);
+      return;
+    }
+
+    s->ended = true;
+
+    if(result == HpackDecoder::eTooLarge) {
+      write(id, sHeadersTooLarge);
+    } else {
+      deliver(*s);
+    }
+
+    return;
+  }
+
+  if(id <= last_stream_) {
+    fail(cStreamClosed);
+    return;
+  }
+
+  last_stream_ = id;
+
+  if(streams_.size() >= cMaxStreams) {
+    server_.stats().h2_refused++;
+    reset(id, cRefusedStream);
+    return;
+  }
+
+  Stream* s = new Stream(id, initial_window_);
+
+  // Answered without the server seeing it; anything more the client
+  // sends on the stream is refused as for a closed one.
+  if(result == HpackDecoder::eTooLarge) {
+    s->ended = true;
+    streams_[id] = s;
+    write(id, sHeadersTooLarge);
+    return;
+  }
+
+  if(!request(*s, fields)) {
+    delete s;
+    reset(id, cProtocolError);
+    return;
+  }
+
+  streams_[id] = s;
+  server_.stats().h2_streams++;
+
+  if(block_end_) {
+    s->ended = true;
+    deliver(*s);
+  }
+}
+
+static void add_header(http::Request& req, const std::string& name,
+                       const std::string& value) {
+  http::Header* h = req.add_headers();
+  int key = header_key(name.data(), name.size());
+
+  if(key >= 0) {
+    h->set_key((http::Header_Key)key);
+  } else {
+    h->set_custom_key(name);
+  }
+
+  h->set_value(value);
+}
+
+// The pseudo-headers become the method and URL, :authority becomes Host
+// when there isn't one, and cookie fields are joined back into one.
+bool H2Session::request(Stream& s, HpackDecoder::Fields& fields) {
+  http::Request& req = s.req;
+  std::string method, path, authority, cookie;
+  bool host = false;
+
+  for(size_t i = 0; i < fields.size(); i++) {
+    const std::string& name = fields[i].first;
+    const std::string& value = fields[i].second;
+
+    if(!name.empty() && name[0] == ':') {
+      if(name == ":method") {
+        method = value;
+      } else if(name == ":path") {
+        path = value;
+      } else if(name == ":authority") {
+        authority = value;
+      } else if(name != ":scheme") {
+        return false;
+      }
+
+      continue;
+    }
+
+    if(name == "cookie") {
+      if(!cookie.empty()) cookie += "; ";
+      cookie += value;
+      continue;
+    }
+
+    if(name == "host") host = true;
+
+    add_header(req, name, value);
+  }
+
+  if(method.empty() || path.empty()) return false;
+
+  if(!host && !authority.empty()) add_header(req, "host", authority);
+  if(!cookie.empty()) add_header(req, "cookie", cookie);
+
+  http::Request_Method m;
+
+  if(http::Request_Method_Parse(method, &m)) {
+    req.set_method(m);
+  } else {
+    req.set_custom_method(method);
+  }
+
+  req.set_url(path);
+  req.set_version_major(2);
+  req.set_version_minor(0);
+
+  s.head_only = method == "HEAD";
+
+  return true;
+}
+
+void H2Session::deliver(Stream& s) {
+  int id = server_.next_connection_id();
+  Connection* con = new Connection(server_, id, *this, s.id);
+
+  s.con = con;
+  server_.add_connection(con);
+
+  // Answering the request may finish the stream, so it moves out first.
+  http::Request req;
+  req.Swap(&s.req);
+
+  server_.deliver(*con, req);
+}
+
+bool H2Session::write(uint32_t stream, const std::string& str) {
+  Streams::iterator i = streams_.find(stream);
+  if(dead_ || i == streams_.end()) return false;
+
+  Stream* s = i->second;
+
+  respond(*s, 0, (const uint8_t*)str.data(), str.size());
+  if(s->end_sent && s->pending.empty()) finish(s);
+
+  return !dead_;
+}
+
+bool H2Session::write(uint32_t stream, const Segment& seg,
+                      const uint8_t* data, size_t size) {
+  Streams::iterator i = streams_.find(stream);
+  if(dead_ || i == streams_.end()) return false;
+
+  Stream* s = i->second;
+
+  respond(*s, &seg, data, size);
+  if(s->end_sent && s->pending.empty()) finish(s);
+
+  return !dead_;
+}
+
+// Follows the HTTP/1.1 response as it's written, sending the head as
+// HEADERS and the body, less any chunk framing, as DATA. Body bytes that
+// came in a segment go out from it.
+bool H2Session::respond(Stream& s, const Segment* seg,
+                        const uint8_t* p, size_t size) {
+  const uint8_t* end = p + size;
+
+  while(p < end) {
+    switch(s.state) {
+    case Stream::eHead: {
+      // Usually the whole head is in one write.
+      const uint8_t* found = 0;
+
+      if(s.line.empty()) {
+        found = (const uint8_t*)memmem(p, end - p, "\r\n\r\n", 4);
+      }
+
+      if(found) {
+        s.line.assign((const char*)p, found + 4 - p);
+        p = found + 4;
+
+        send_head(s);
+        s.line.clear();
+        break;
+      }
+
+      size_t had = s.line.size();
+      size_t from = had > 3 ? had - 3 : 0;
+
+      s.line.append((const char*)p, end - p);
+
+      size_t at = s.line.find("\r\n\r\n", from);
+      if(at == std::string::npos) return true;
+
+      p += at + 4 - had;
+      s.line.resize(at + 4);
+
+      send_head(s);
+      s.line.clear();
+      break;
+    }
+
+    case Stream::eBody:
+    case Stream::eChunkData: {
+      size_t n = std::min(s.left, (uint64_t)(end - p));
+      s.left -= n;
+
+      bool done = s.left == 0;
+
+      send_data(s, seg, p, n, done && s.state == Stream::eBody);
+      p += n;
+
+      if(done) {
+        s.state = s.state == Stream::eBody ? Stream::eDone
+                                           : Stream::eChunkEnd;
+      }
+
+      break;
+    }
+
+    case Stream::eChunkSize:
+    case Stream::eChunkEnd:
+    case Stream::eTrailer: {
+      const uint8_t* nl = (const uint8_t*)memchr(p, '\n', end - p);
+
+      if(!nl) {
+        s.line.append((const char*)p, end - p);
+        return true;
+      }
+
+      s.line.append((const char*)p, nl - p);
+      p = nl + 1;
+
+      if(s.state == Stream::eChunkSize) {
+        s.left = strtoull(s.line.c_str(), 0, 16);
+        s.state = s.left ? Stream::eChunkData : Stream::eTrailer;
+      } else if(s.state == Stream::eChunkEnd) {
+        s.state = Stream::eChunkSize;
+      } else if(s.line.empty() || s.line == "\r") {
+        send_data(s, 0, 0, 0, true);
+        s.state = Stream::eDone;
+      }
+
+      s.line.clear();
+      break;
+    }
+
+    case Stream::eDone:
+      // Such as the body of a reply to a HEAD.
+      return true;
+    }
+  }
+
+  return true;
+}
+
+static bool skip_header_p(const std::string& name) {
+  return name == "connection" || name == "keep-alive" ||
+         name == "proxy-connection" || name == "transfer-encoding" ||
+         name == "upgrade";
+}
+
+void H2Session::send_head(Stream& s) {
+  const std::string& h = s.line;
+
+  size_t space = h.find(' ');
+  int status = space == std::string::npos ? 502 : atoi(h.c_str() + space + 1);
+
+  std::string block;
+  hpack_status(block, status);
+
+  bool chunked = false;
+  uint64_t length = 0;
+
+  size_t at = h.find("\r\n") + 2;
+
+  for(;;) {
+    size_t eol = h.find("\r\n", at);
+    if(eol == at || eol == std::string::npos) break;
+
+    size_t colon = h.find(':', at);
+
+    if(colon < eol) {
+      std::string name(h, at, colon - at);
+      for(size_t i = 0; i < name.size(); i++) name[i] = tolower(name[i]);
+
+      size_t v = colon + 1;
+      while(v < eol && (h[v] == ' ' || h[v] == '\t')) v++;
+
+      if(name == "transfer-encoding") {
+        chunked = h.compare(v, eol - v, "chunked") == 0;
+      } else if(!skip_header_p(name)) {
+        if(name == "content-length") length = strtoull(h.c_str() + v, 0, 10);
+
+        hpack_literal(block, name.data(), name.size(), h.data() + v, eol - v);
+      }
+    }
+
+    at = eol + 2;
+  }
+
+  bool body = !s.head_only && (chunked || length > 0);
+
+  // The block goes out whole, in a HEADERS and as many CONTINUATIONs as
+  // the client's frame size makes it take.
+  std::string out;
+  size_t n = std::min(block.size(), (size_t)max_frame_);
+
+  frame_head(out, n, eHeadersFrame,
+             (body ? 0 : cEndStream) | (n == block.size() ? cEndHeaders : 0),
+             s.id);
+  out.append(block, 0, n);
+
+  for(size_t sent = n; sent < block.size(); sent += n) {
+    n = std::min(block.size() - sent, (size_t)max_frame_);
+
+    frame_head(out, n, eContinuationFrame,
+               sent + n == block.size() ? cEndHeaders : 0, s.id);
+    out.append(block, sent, n);
+  }
+
+  con_.write(out);
+
+  if(!body) {
+    s.state = Stream::eDone;
+    s.end_sent = true;
+  } else if(chunked) {
+    s.state = Stream::eChunkSize;
+  } else {
+    s.state = Stream::eBody;
+    s.left = length;
+  }
+}
+
+// Anything the windows hold back waits in pending, by reference when
+// it's in a segment.
+void H2Session::send_data(Stream& s, const Segment* seg,
+                          const uint8_t* data, size_t size, bool end) {
+  if(s.pending.empty()) {
+    size_t sent = send_now(s, seg, data, size, end);
+
+    data += sent;
+    size -= sent;
+
+    if(size == 0) return;
+  }
+
+  if(size > 0) {
+    if(seg) {
+      s.pending.push_back(Piece(*seg, data, size));
+    } else {
+      Segment copy(size);
+      memcpy(copy.bytes(), data, size);
+
+      s.pending.push_back(Piece(copy, copy.bytes(), size));
+    }
+
+    s.pending_bytes += size;
+  }
+
+  if(end) s.end_pending = true;
+}
+
+// Sends what the windows allow and returns how much that was. With end
+// set, END_STREAM goes with the last of it if it all went.
+size_t H2Session::send_now(Stream& s, const Segment* seg,
+                           const uint8_t* data, size_t size, bool end) {
+  if(size == 0 && !end) return 0;
+
+  size_t sent = 0;
+
+  do {
+    int64_t room = std::min(s.window, window_);
+    size_t n = std::min(size - sent, (size_t)max_frame_);
+
+    if(room < (int64_t)n) n = room > 0 ? room : 0;
+    if(n == 0 && sent < size) break;
+
+    bool last = end && sent + n == size;
+
+    std::string head;
+    frame_head(head, n, eDataFrame, last ? cEndStream : 0, s.id);
+
+    if(n == 0) {
+      con_.write(head);
+    } else if(seg) {
+      con_.write(head, *seg, data + sent, n);
+    } else {
+      head.append((const char*)data + sent, n);
+      con_.write(head);
+    }
+
+    s.window -= n;
+    window_ -= n;
+    sent += n;
+
+    if(last) s.end_sent = true;
+  } while(sent < size);
+
+  return sent;
+}
+
+// Sends what a window update has made room for, finishing the stream if
+// that was the end of it.
+void H2Session::flush(Stream& s) {
+  while(!s.pending.empty()) {
+    Piece& piece = s.pending.front();
+    bool last = s.end_pending && s.pending.size() == 1;
+
+    size_t sent = send_now(s, &piece.seg, piece.seg.bytes() + piece.offset,
+                           piece.size, last);
+    s.pending_bytes -= sent;
+
+    if(sent < piece.size) {
+      piece.offset += sent;
+      piece.size -= sent;
+      break;
+    }
+
+    s.pending.pop_front();
+  }
+
+  if(s.end_sent && s.pending.empty()) {
+    finish(&s);
+    return;
+  }
+
+  if(s.con) server_.drained(*s.con);
+}
+
+void H2Session::flush_all() {
+  std::vector<uint32_t> waiting;
+
+  for(Streams::iterator i = streams_.begin(); i != streams_.end(); ++i) {
+    if(!i->second->pending.empty()) waiting.push_back(i->first);
+  }
+
+  for(size_t j = 0; j < waiting.size() && !dead_; j++) {
+    Streams::iterator i = streams_.find(waiting[j]);
+    if(i != streams_.end()) flush(*i->second);
+  }
+}
+
+// Done with a stream, one way or the other. Closing its Connection
+// cancels whatever it's still waiting on. The last one to go starts the
+// connection's idle timeout afresh.
+void H2Session::finish(Stream* s) {
+  Connection* con = s->con;
+
+  streams_.erase(s->id);
+  delete s;
+
+  if(con) con->signal_cleanup();
+
+  if(streams_.empty() && !dead_ && con_.timeout() == eIdleTimeout) {
+    server_.arm_timeout(con_, eIdleTimeout);
+  }
+}
+
+size_t H2Session::backlog(uint32_t stream) {
+  size_t bytes = con_.backlog();
+
+  Streams::iterator i = streams_.find(stream);
+  if(i != streams_.end()) bytes += i->second->pending_bytes;
+
+  return bytes;
+}
+
+void H2Session::drained() {
+  std::vector<Connection*> cons;
+
+  for(Streams::iterator i = streams_.begin(); i != streams_.end(); ++i) {
+    if(i->second->con) cons.push_back(i->second->con);
+  }
+
+  for(size_t i = 0; i < cons.size() && !dead_; i++) {
+    server_.drained(*cons[i]);
+  }
+}
+
+// The server closed a stream's Connection, so its client can't be sent
+// the rest of the response.
+void H2Session::closed(uint32_t stream) {
+  if(dead_) return;
+
+  Streams::iterator i = streams_.find(stream);
+  if(i == streams_.end()) return;
+
+  Stream* s = i->second;
+  s->con = 0;
+
+  if(!s->end_sent) reset(stream, cCancel);
+  finish(s);
+}
+
+bool H2Session::idle_p() {
+  return !dead_ && streams_.empty() && con_.backlog() == 0;
+}
+
+void H2Session::go_away() {
+  fail(cNoError);
+}
+
+void H2Session::close() {
+  if(dead_) return;
+  dead_ = true;
+
+  for(Streams::iterator i = streams_.begin(); i != streams_.end(); ++i) {
+    Connection* con = i->second->con;
+    i->second->con = 0;
+
+    if(con) con->signal_cleanup();
+  }
+}
@@ -0,0 +1,188 @@
+#ifndef H2_HPP
+#define H2_HPP
+
+#include <stdint.h>
+
+#include <deque>
+#include <map>
+#include <string>
+
+#include "segment.hpp"
+#include "hpack.hpp"
+
+#include "http.pb.h"
+
+class Server;
+class Connection;
+
+// Cleartext HTTP/2 (h2c) on a client connection, started either by the
+// client preface (prior knowledge) or by an HTTP/1.1 Upgrade: h2c.
+//
+// Each HTTP/2 stream gets a Connection of its own that the server treats
+// like any other client: it's delivered the stream's request once
+// END_STREAM arrives, and writes its response as HTTP/1.1. The session
+// reframes what's written as HEADERS and DATA, holding DATA back while
+// the client's flow control windows are shut. A stream the client resets
+// closes its Connection, which cancels whatever it was waiting on.
+class H2Session {
+public:
+  enum Preface { eMismatch, ePartial, eMatch };
+
+private:
+  // Response bytes held back by flow control, at offset in seg.
+  struct Piece {
+    Segment seg;
+    size_t offset;
+    size_t size;
+
+    Piece(const Segment& s, const uint8_t* data, size_t sz)
+      : seg(s)
+      , offset(data - s.bytes())
+      , size(sz)
+    {}
+  };
+
+  struct Stream {
+    uint32_t id;
+    Connection* con;     // 0 once the server is done with the stream
+    http::Request req;
+    bool head_only;      // a HEAD request, whose response has no DATA
+    bool ended;          // END_STREAM arrived
+    size_t received;     // DATA not yet credited back to the client
+
+    // Where parsing the HTTP/1.1 response written to con is up to.
+    enum {
+      eHead,
+      eBody,
+      eChunkSize,
+      eChunkData,
+      eChunkEnd,
+      eTrailer,
+      eDone
+    } state;
+
+    std::string line;    // the head, or a line of chunk framing
+    uint64_t left;       // body or chunk bytes still to come
+
+    int64_t window;
+    std::deque<Piece> pending;
+    size_t pending_bytes;
+    bool end_pending;    // END_STREAM goes out with the last piece
+    bool end_sent;
+
+    Stream(uint32_t i, int64_t w)
+      : id(i)
+      , con(0)
+      , req()
+      , head_only(false)
+      , ended(false)
+      , received(0)
+      , state(eHead)
+      , line()
+      , left(0)
+      , window(w)
+      , pending()
+      , pending_bytes(0)
+      , end_pending(false)
+      , end_sent(false)
+    {}
+
+  private:
+    Stream(const Stream&);
+    Stream& operator=(const Stream&);
+  };
+
+  typedef std::map<uint32_t, Stream*> Streams;
+
+  Server& server_;
+  Connection& con_;
+
+  HpackDecoder hpack_;
+  Streams streams_;
+
+  bool preface_;   // the client preface has been read
+  bool dead_;      // closed, waiting for con_ to be cleaned up
+
+  uint32_t last_stream_;
+
+  // A header block split over CONTINUATION frames.
+  uint32_t continuation_;
+  bool block_end_;   // its HEADERS had END_STREAM
+  std::string block_;
+
+  // The client's settings, and what we may still send on the
+  // connection as a whole.
+  uint32_t max_frame_;
+  int64_t initial_window_;
+  int64_t window_;
+
+  // DATA received on the connection and not yet credited back.
+  size_t received_;
+
+public:
+  H2Session(Server& server, Connection& con);
+  ~H2Session();
+
+  // Whether data starts with the client preface.
+  static Preface preface(const uint8_t* data, size_t size);
+
+  void start();
+  void upgrade(http::Request& req, const std::string& settings);
+
+  // Reads whole frames, leaving any partial one for next time.
+  size_t execute(const uint8_t* data, size_t size);
+
+  // A stream's Connection writing its response.
+  bool write(uint32_t stream, const std::string& str);
+  bool write(uint32_t stream,
+             const Segment& seg, const uint8_t* data, size_t size);
+
+  size_t backlog(uint32_t stream);
+
+  // con_'s writes are going out.
+  void drained();
+
+  // A stream's Connection was closed.
+  void closed(uint32_t stream);
+
+  // con_ was closed.
+  void close();
+
+  // No streams open and nothing left to write.
+  bool idle_p();
+
+  // Closes con_ with a GOAWAY, so the client knows to reconnect.
+  void go_away();
+
+private:
+  H2Session(const H2Session&);
+  H2Session& operator=(const H2Session&);
+
+  void fail(uint32_t error);
+  void reset(uint32_t stream, uint32_t error);
+  void send_frame(uint8_t type, uint8_t flags, uint32_t stream,
+                  const std::string& payload);
+  void send_window(uint32_t stream, size_t increment);
+
+  bool settings(const uint8_t* p, size_t size);
+  void frame(uint8_t type, uint8_t flags, uint32_t stream,
+             const uint8_t* p, size_t size);
+  void data(uint32_t id, Stream* s, uint8_t flags,
+            const uint8_t* p, size_t size);
+  void headers(uint32_t stream);
+  bool request(Stream& s, HpackDecoder::Fields& fields);
+  void deliver(Stream& s);
+
+  bool respond(Stream& s, const Segment* seg,
+               const uint8_t* data, size_t size);
+  void send_head(Stream& s);
+  void send_data(Stream& s, const Segment* seg,
+                 const uint8_t* data, size_t size, bool end);
+  size_t send_now(Stream& s, const Segment* seg,
+                  const uint8_t* data, size_t size, bool end);
+  void flush(Stream& s);
+  void flush_all();
+  void finish(Stream* s);
+};
+
+#endif
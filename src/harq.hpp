@@ -6,6 +6,21 @@
 #define READ_BUFFER 81920
 #define VERSION_STR "0.1"
 
+// Stream ids carry the loop that sent them in the bits above these, so
+// the BrokerThread knows which loop to hand a reply to.
+#define STREAM_COUNTER_BITS 56
+
+// Every queue that replies and socket messages arrive on is under
+// GATEWAY_QUEUES; anything else a link is subscribed to is an event topic.
+#define GATEWAY_QUEUES "/harq-http/"
+
+#define REPLY_QUEUE "/harq-http/reply"
+#define BULK_REPLY_SUFFIX "/bulk"
+
+// Followed by a bridged WebSocket's stream, the ephemeral queue its
+// outgoing messages are sent to.
+#define SOCKET_QUEUE "/harq-http/socket"
+
 #define WARN_UNUSED __attribute__((warn_unused_result))
 
 #endif
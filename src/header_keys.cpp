@@ -0,0 +1,398 @@
+// Generated from src/http.proto by src/tmp/gen_header_keys.cpp; run
+// `make header_keys` after changing http::Header::Key rather than
+// editing this.
+
+#include "util.hpp"
+
+#include <stdint.h>
+#include <string.h>
+
+struct HeaderSlot {
+  const char* lower;
+  uint8_t size;
+  int8_t key;    // -1 for an empty slot
+};
+
+static const HeaderSlot cSlots[256] = {
+  { 0, 0, -1 },
+  { "date", 4, 17 },  // DATE
+  { 0, 0, -1 },
+  { "x-request-id", 12, 56 },  // X_REQUEST_ID
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-correlation-id", 16, 57 },  // X_CORRELATION_ID
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "content-length", 14, 13 },  // CONTENT_LENGTH
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "origin", 6, 29 },  // ORIGIN
+  { 0, 0, -1 },
+  { "te", 2, 36 },  // TE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "access-control-request-headers", 30, 8 },  // ACCESS_CONTROL_REQUEST_HEADERS
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "sec-fetch-site", 14, 45 },  // SEC_FETCH_SITE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "host", 4, 0 },  // HOST
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-real-ip", 9, 55 },  // X_REAL_IP
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-requested-with", 16, 51 },  // X_REQUESTED_WITH
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "accept-datetime", 15, 6 },  // ACCEPT_DATETIME
+  { "pragma", 6, 30 },  // PRAGMA
+  { "keep-alive", 10, 27 },  // KEEP_ALIVE
+  { 0, 0, -1 },
+  { "if-modified-since", 17, 23 },  // IF_MODIFIED_SINCE
+  { 0, 0, -1 },
+  { "if-unmodified-since", 19, 26 },  // IF_UNMODIFIED_SINCE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "if-match", 8, 22 },  // IF_MATCH
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "if-none-match", 13, 24 },  // IF_NONE_MATCH
+  { "sec-fetch-dest", 14, 43 },  // SEC_FETCH_DEST
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-traffic-class", 15, 61 },  // X_TRAFFIC_CLASS
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-forwarded-host", 16, 53 },  // X_FORWARDED_HOST
+  { "content-md5", 11, 14 },  // CONTENT_MD5
+  { 0, 0, -1 },
+  { "x-forwarded-proto", 17, 54 },  // X_FORWARDED_PROTO
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "accept-encoding", 15, 4 },  // ACCEPT_ENCODING
+  { 0, 0, -1 },
+  { "forwarded", 9, 20 },  // FORWARDED
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "content-encoding", 16, 12 },  // CONTENT_ENCODING
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "upgrade", 7, 39 },  // UPGRADE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "sec-fetch-mode", 14, 44 },  // SEC_FETCH_MODE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "upgrade-insecure-requests", 25, 40 },  // UPGRADE_INSECURE_REQUESTS
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "priority", 8, 31 },  // PRIORITY
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "expect", 6, 19 },  // EXPECT
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "access-control-request-method", 29, 7 },  // ACCESS_CONTROL_REQUEST_METHOD
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-http-method-override", 22, 59 },  // X_HTTP_METHOD_OVERRIDE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "warning", 7, 42 },  // WARNING
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "transfer-encoding", 17, 38 },  // TRANSFER_ENCODING
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "content-type", 12, 15 },  // CONTENT_TYPE
+  { "x-request-timeout", 17, 60 },  // X_REQUEST_TIMEOUT
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "cache-control", 13, 10 },  // CACHE_CONTROL
+  { 0, 0, -1 },
+  { "from", 4, 21 },  // FROM
+  { "accept-language", 15, 5 },  // ACCEPT_LANGUAGE
+  { 0, 0, -1 },
+  { "dnt", 3, 18 },  // DNT
+  { "authorization", 13, 9 },  // AUTHORIZATION
+  { "connection", 10, 11 },  // CONNECTION
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "if-range", 8, 25 },  // IF_RANGE
+  { "max-forwards", 12, 28 },  // MAX_FORWARDS
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "accept-charset", 14, 3 },  // ACCEPT_CHARSET
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "range", 5, 34 },  // RANGE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-csrf-token", 12, 58 },  // X_CSRF_TOKEN
+  { 0, 0, -1 },
+  { "proxy-connection", 16, 33 },  // PROXY_CONNECTION
+  { "referer", 7, 35 },  // REFERER
+  { "sec-websocket-protocol", 22, 49 },  // SEC_WEBSOCKET_PROTOCOL
+  { "proxy-authorization", 19, 32 },  // PROXY_AUTHORIZATION
+  { 0, 0, -1 },
+  { "trailer", 7, 37 },  // TRAILER
+  { 0, 0, -1 },
+  { "user-agent", 10, 2 },  // USER_AGENT
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "sec-fetch-user", 14, 46 },  // SEC_FETCH_USER
+  { "sec-websocket-version", 21, 48 },  // SEC_WEBSOCKET_VERSION
+  { "sec-websocket-extensions", 24, 50 },  // SEC_WEBSOCKET_EXTENSIONS
+  { "cookie", 6, 16 },  // COOKIE
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "accept", 6, 1 },  // ACCEPT
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "via", 3, 41 },  // VIA
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "x-forwarded-for", 15, 52 },  // X_FORWARDED_FOR
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { "sec-websocket-key", 17, 47 },  // SEC_WEBSOCKET_KEY
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+  { 0, 0, -1 },
+};
+
+static const char* const cNames[62] = {
+  "Host",
+  "Accept",
+  "User-Agent",
+  "Accept-Charset",
+  "Accept-Encoding",
+  "Accept-Language",
+  "Accept-Datetime",
+  "Access-Control-Request-Method",
+  "Access-Control-Request-Headers",
+  "Authorization",
+  "Cache-Control",
+  "Connection",
+  "Content-Encoding",
+  "Content-Length",
+  "Content-MD5",
+  "Content-Type",
+  "Cookie",
+  "Date",
+  "DNT",
+  "Expect",
+  "Forwarded",
+  "From",
+  "If-Match",
+  "If-Modified-Since",
+  "If-None-Match",
+  "If-Range",
+  "If-Unmodified-Since",
+  "Keep-Alive",
+  "Max-Forwards",
+  "Origin",
+  "Pragma",
+  "Priority",
+  "Proxy-Authorization",
+  "Proxy-Connection",
+  "Range",
+  "Referer",
+  "TE",
+  "Trailer",
+  "Transfer-Encoding",
+  "Upgrade",
+  "Upgrade-Insecure-Requests",
+  "Via",
+  "Warning",
+  "Sec-Fetch-Dest",
+  "Sec-Fetch-Mode",
+  "Sec-Fetch-Site",
+  "Sec-Fetch-User",
+  "Sec-WebSocket-Key",
+  "Sec-WebSocket-Version",
+  "Sec-WebSocket-Protocol",
+  "Sec-WebSocket-Extensions",
+  "X-Requested-With",
+  "X-Forwarded-For",
+  "X-Forwarded-Host",
+  "X-Forwarded-Proto",
+  "X-Real-IP",
+  "X-Request-ID",
+  "X-Correlation-ID",
+  "X-CSRF-Token",
+  "X-HTTP-Method-Override",
+  "X-Request-Timeout",
+  "X-Traffic-Class",
+};
+
+static inline unsigned slot(const char* name, size_t size) {
+  return (size * 1 +
+          (unsigned char)(name[0] | 0x20) * 2 +
+          (unsigned char)(name[size - 1] | 0x20) * 5 +
+          (unsigned char)(name[size - 2] | 0x20) * 27) & 255;
+}
+
+static inline uint64_t lower_word(uint64_t x) {
+  const uint64_t ones = 0x0101010101010101ULL;
+  const uint64_t high = 0x8080808080808080ULL;
+
+  uint64_t seven = x & ~high;
+  uint64_t ge_a = seven + (0x80 - 'A') * ones;
+  uint64_t gt_z = seven + (0x80 - 'Z' - 1) * ones;
+  uint64_t upper = (ge_a ^ gt_z) & ~x & high;
+
+  return x | (upper >> 2);
+}
+
+// name (any case) against lower, both size bytes long.
+static bool equal_lower(const char* name, const char* lower, size_t size) {
+  uint64_t a, b;
+
+  while(size >= 8) {
+    memcpy(&a, name, 8);
+    memcpy(&b, lower, 8);
+    if(lower_word(a) != b) return false;
+
+    name += 8;
+    lower += 8;
+    size -= 8;
+  }
+
+  if(size == 0) return true;
+
+  a = b = 0;
+  memcpy(&a, name, size);
+  memcpy(&b, lower, size);
+
+  return lower_word(a) == b;
+}
+
+int header_key(const char* name, size_t size) {
+  if(size < 2 || size > 30) return -1;
+
+  const HeaderSlot& s = cSlots[slot(name, size)];
+
+  if(s.size != size || !equal_lower(name, s.lower, size)) {
+    return -1;
+  }
+
+  return s.key;
+}
+
+const char* header_key_name(int key) {
+  if(key < 0 || key >= 62) return "";
+
+  return cNames[key];
+}
@@ -0,0 +1,58 @@
+#include "hedge.hpp"
+
+#include <algorithm>
+
+// Latencies kept per route, and how many must be seen before hedging.
+static const size_t cSamples = 256;
+static const size_t cMinSamples = 32;
+
+// The percentile is recomputed after this many new samples.
+static const size_t cRecompute = 16;
+
+// Hedges allowed per request sent, and how many may be saved up for a
+// burst of slow replies.
+static const double cBudget = 0.05;
+static const double cMaxTokens = 10;
+
+Hedger::Hedger()
+  : samples_()
+  , next_(0)
+  , fresh_(0)
+  , percentile_(95)
+  , threshold_(0)
+  , tokens_(0)
+{
+  samples_.reserve(cSamples);
+}
+
+void Hedger::sample(double latency) {
+  if(samples_.size() < cSamples) {
+    samples_.push_back(latency);
+  } else {
+    samples_[next_] = latency;
+    next_ = (next_ + 1) % cSamples;
+  }
+
+  if(samples_.size() < cMinSamples || ++fresh_ < cRecompute) return;
+
+  fresh_ = 0;
+
+  std::vector<double> sorted(samples_);
+  std::vector<double>::iterator nth =
+    sorted.begin() + (sorted.size() - 1) * percentile_ / 100;
+
+  std::nth_element(sorted.begin(), nth, sorted.end());
+  threshold_ = *nth;
+}
+
+void Hedger::earn() {
+  tokens_ += cBudget;
+  if(tokens_ > cMaxTokens) tokens_ = cMaxTokens;
+}
+
+bool Hedger::spend() {
+  if(tokens_ < 1) return false;
+
+  tokens_ -= 1;
+  return true;
+}
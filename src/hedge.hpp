@@ -0,0 +1,49 @@
+#ifndef HEDGE_HPP
+#define HEDGE_HPP
+
+#include <stddef.h>
+
+#include <vector>
+
+// Decides when a route's requests get hedged: once a request has waited
+// longer than a percentile of the route's recent reply latencies, a copy
+// may be sent elsewhere. Hedges are paid for out of a budget earned by
+// ordinary requests, so they never add more than a fixed share of load.
+class Hedger {
+  std::vector<double> samples_;  // ring of recent latencies, seconds
+  size_t next_;
+  size_t fresh_;       // samples since the threshold was last computed
+
+  int percentile_;
+  double threshold_;   // 0 until there are enough samples
+
+  double tokens_;
+
+public:
+  Hedger();
+
+  void set_percentile(int percentile) {
+    percentile_ = percentile;
+  }
+
+  // How long to wait for a reply before hedging, or 0 for not yet.
+  double threshold() {
+    return threshold_;
+  }
+
+  void sample(double latency);
+
+  void earn();
+  bool spend();
+
+  // Whether there's a token to spend, without spending it.
+  bool affordable_p() {
+    return tokens_ >= 1;
+  }
+
+  double tokens() {
+    return tokens_;
+  }
+};
+
+#endif
@@ -0,0 +1,288 @@
+#include "hot_restart.hpp"
+#include "server.hpp"
+#include "util.hpp"
+
+#include <iostream>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+
+// Sent by the new process to ask for the sockets, and at the front of the
+// answer, followed by how many there are.
+static const uint32_t cHandoffMagic = 0x68617271;
+
+// As many as there can be loops (see -n).
+static const int cMaxSockets = 256;
+
+// How long either side waits on the other before giving up.
+static const int cHandoffTimeout = 5;
+
+static void set_timeout(int fd) {
+  struct timeval tv = { cHandoffTimeout, 0 };
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, (void*)&tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, (void*)&tv, sizeof(tv));
+}
+
+// Whether whoever is at the other end of sock runs as our user.
+static bool same_user_p(int sock) {
+#ifdef SO_PEERCRED
+  struct ucred cred;
+  socklen_t len = sizeof(cred);
+
+  if(getsockopt(sock, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0) {
+    return false;
+  }
+
+  return cred.uid == getuid();
+#else
+  uid_t uid;
+  gid_t gid;
+
+  if(getpeereid(sock, &uid, &gid) != 0) return false;
+
+  return uid == getuid();
+#endif
+}
+
+static bool send_sockets(int sock, const std::vector<int>& fds) {
+  uint32_t head[2] = { cHandoffMagic, (uint32_t)fds.size() };
+
+  struct iovec iov;
+  iov.iov_base = head;
+  iov.iov_len = sizeof(head);
+
+  std::vector<char> ctrl(CMSG_SPACE(sizeof(int) * fds.size()));
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = &ctrl[0];
+  msg.msg_controllen = ctrl.size();
+
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+  memcpy(CMSG_DATA(cmsg), &fds[0], sizeof(int) * fds.size());
+
+  for(;;) {
+    ssize_t r = sendmsg(sock, &msg, 0);
+    if(r == -1 && errno == EINTR) continue;
+    return r == sizeof(head);
+  }
+}
+
+static bool recv_sockets(int sock, std::vector<int>& fds) {
+  uint32_t head[2] = { 0, 0 };
+
+  struct iovec iov;
+  iov.iov_base = head;
+  iov.iov_len = sizeof(head);
+
+  std::vector<char> ctrl(CMSG_SPACE(sizeof(int) * cMaxSockets));
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = &ctrl[0];
+  msg.msg_controllen = ctrl.size();
+
+  ssize_t r;
+  do {
+    r = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC);
+  } while(r == -1 && errno == EINTR);
+
+  if(r != sizeof(head) || head[0] != cHandoffMagic ||
+     head[1] == 0 || head[1] > (uint32_t)cMaxSockets) {
+    return false;
+  }
+
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  if(!cmsg || cmsg->cmsg_level != SOL_SOCKET ||
+     cmsg->cmsg_type != SCM_RIGHTS ||
+     cmsg->cmsg_len != CMSG_LEN(sizeof(int) * head[1])) {
+    return false;
+  }
+
+  size_t at = fds.size();
+  fds.resize(at + head[1]);
+  memcpy(&fds[at], CMSG_DATA(cmsg), sizeof(int) * head[1]);
+
+  return true;
+}
+
+HotRestart::HotRestart(const std::string& path)
+  : path_(path)
+  , fd_(-1)
+  , watcher_()
+  , peer_(-1)
+  , peer_watcher_()
+  , peer_timer_()
+  , magic_(0)
+  , magic_read_(0)
+  , servers_()
+  , handed_at_(0)
+  , draining_(0)
+{}
+
+HotRestart::~HotRestart() {
+  if(fd_ >= 0) close(fd_);
+  if(peer_ >= 0) close(peer_);
+}
+
+bool HotRestart::take_over(std::vector<int>& fds) {
+  int s = connect_unix(path_);
+
+  if(s < 0) {
+    std::cerr << "Nothing to take over from at " << path_
+              << ", opening listening sockets\n";
+    return false;
+  }
+
+  set_timeout(s);
+
+  uint32_t magic = cHandoffMagic;
+  bool ok = ::write(s, &magic, sizeof(magic)) == sizeof(magic) &&
+            recv_sockets(s, fds);
+
+  close(s);
+
+  if(!ok) {
+    std::cerr << "Unable to take over listening sockets from " << path_
+              << "\n";
+    return false;
+  }
+
+  handed_at_ = ev_time();
+
+  std::cerr << "Took over " << fds.size() << " listening sockets from "
+            << path_ << "\n";
+
+  return true;
+}
+
+bool HotRestart::listen(const std::vector<Server*>& servers) {
+  servers_ = servers;
+
+  fd_ = listen_unix(path_);
+  if(fd_ < 0) return false;
+
+  set_nonblock(fd_);
+
+  watcher_.set(servers_[0]->loop());
+  watcher_.set<HotRestart, &HotRestart::on_request>(this);
+  watcher_.start(fd_, EV_READ);
+
+  peer_watcher_.set(servers_[0]->loop());
+  peer_watcher_.set<HotRestart, &HotRestart::on_peer>(this);
+
+  peer_timer_.set(servers_[0]->loop());
+  peer_timer_.set<HotRestart, &HotRestart::on_peer_timeout>(this);
+
+  return true;
+}
+
+// A newer process wants our sockets. It has cHandoffTimeout to ask,
+// and nobody else is listened to until it's done.
+void HotRestart::on_request(ev::io& w, int revents) {
+  int s = accept(fd_, 0, 0);
+  if(s < 0) return;
+
+  if(peer_ >= 0 || !same_user_p(s)) {
+    close(s);
+    return;
+  }
+
+  set_nonblock(s);
+
+  peer_ = s;
+  magic_ = 0;
+  magic_read_ = 0;
+
+  peer_watcher_.start(peer_, EV_READ);
+  peer_timer_.start(cHandoffTimeout, 0);
+}
+
+void HotRestart::on_peer(ev::io& w, int revents) {
+  ssize_t r = ::read(peer_, (char*)&magic_ + magic_read_,
+                     sizeof(magic_) - magic_read_);
+
+  if(r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+    return;
+  }
+
+  if(r <= 0) {
+    drop_peer();
+    return;
+  }
+
+  magic_read_ += r;
+  if(magic_read_ < sizeof(magic_)) return;
+
+  if(magic_ != cHandoffMagic) {
+    drop_peer();
+    return;
+  }
+
+  hand_over();
+}
+
+void HotRestart::on_peer_timeout(ev::timer& w, int revents) {
+  std::cerr << "Gave up on a process asking for the listening sockets\n";
+  drop_peer();
+}
+
+void HotRestart::drop_peer() {
+  peer_watcher_.stop();
+  peer_timer_.stop();
+
+  close(peer_);
+  peer_ = -1;
+}
+
+// Our own socket at path_ is closed first, since the new process is about
+// to listen there in our place.
+void HotRestart::hand_over() {
+  std::vector<int> fds;
+
+  for(size_t i = 0; i < servers_.size(); i++) {
+    fds.push_back(servers_[i]->listener());
+  }
+
+  watcher_.stop();
+  close(fd_);
+  fd_ = -1;
+
+  bool ok = send_sockets(peer_, fds);
+  drop_peer();
+
+  if(!ok) {
+    std::cerr << "Unable to hand listening sockets over, carrying on\n";
+    listen(servers_);
+    return;
+  }
+
+  std::cerr << "Handed " << fds.size()
+            << " listening sockets to a new process, draining\n";
+
+  draining_ = servers_.size();
+
+  for(size_t i = 0; i < servers_.size(); i++) {
+    servers_[i]->hand_off();
+  }
+}
+
+void HotRestart::drained() {
+  if(__atomic_sub_fetch(&draining_, 1, __ATOMIC_ACQ_REL) > 0) return;
+
+  std::cerr << "Drained, exiting\n";
+  exit(0);
+}
@@ -0,0 +1,76 @@
+#ifndef HOT_RESTART_HPP
+#define HOT_RESTART_HPP
+
+#include <string>
+#include <vector>
+
+#include <ev++.h>
+
+class Server;
+
+// Restarting onto a new binary without closing the listening sockets
+// (-U). Every process started with the same path first asks whoever is
+// listening there, an older process, for its listening sockets, which it
+// sends over SCM_RIGHTS. The old process stops accepting and exits once
+// every loop has drained (see Server::on_drain), while the new one
+// accepts on the sockets it was handed straight away, so connections
+// waiting in their backlogs are never reset. The new process then listens
+// on path itself, for the next restart.
+//
+// Loops hand over their sockets in order, so a restart should keep the
+// same -n. Only a process running as the same user is handed them.
+class HotRestart {
+  std::string path_;
+
+  // Where the next process asks for our sockets.
+  int fd_;
+  ev::io watcher_;
+
+  // A process that connected and has yet to finish asking, read from
+  // without blocking the loop and dropped after cHandoffTimeout.
+  int peer_;
+  ev::io peer_watcher_;
+  ev::timer peer_timer_;
+  uint32_t magic_;
+  size_t magic_read_;
+
+  std::vector<Server*> servers_;
+
+  // When the sockets were taken over, 0 when they weren't.
+  ev_tstamp handed_at_;
+
+  // Loops yet to finish draining.
+  int draining_;
+
+public:
+  HotRestart(const std::string& path);
+  ~HotRestart();
+
+  // Asks an older process for its listening sockets, adding them to fds.
+  // Returns false when nobody answers, and the sockets are to be opened
+  // afresh.
+  bool take_over(std::vector<int>& fds);
+
+  ev_tstamp handed_at() {
+    return handed_at_;
+  }
+
+  // Starts listening for the next process, on the first loop.
+  bool listen(const std::vector<Server*>& servers);
+
+  void on_request(ev::io& w, int revents);
+  void on_peer(ev::io& w, int revents);
+  void on_peer_timeout(ev::timer& w, int revents);
+
+  // Called from each loop once it has drained; the last one exits.
+  void drained();
+
+private:
+  HotRestart(const HotRestart&);
+  HotRestart& operator=(const HotRestart&);
+
+  void drop_peer();
+  void hand_over();
+};
+
+#endif
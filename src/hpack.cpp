@@ -0,0 +1,445 @@
+#include "hpack.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+// Blocks may not shrink the dynamic table below what an entry needs.
+static const size_t cEntryOverhead = 32;
+
+// RFC 7541 Appendix A. Index 1 is the first entry.
+static const char* const cStatic[][2] = {
+  { ":authority", "" },
+  { ":method", "GET" },
+  { ":method", "POST" },
+  { ":path", "/" },
+  { ":path", "/index.html" },
+  { ":scheme", "http" },
+  { ":scheme", "https" },
+  { ":status", "200" },
+  { ":status", "204" },
+  { ":status", "206" },
+  { ":status", "304" },
+  { ":status", "400" },
+  { ":status", "404" },
+  { ":status", "500" },
+  { "accept-charset", "" },
+  { "accept-encoding", "gzip, deflate" },
+  { "accept-language", "" },
+  { "accept-ranges", "" },
+  { "accept", "" },
+  { "access-control-allow-origin", "" },
+  { "age", "" },
+  { "allow", "" },
+  { "authorization", "" },
+  { "cache-control", "" },
+  { "content-disposition", "" },
+  { "content-encoding", "" },
+  { "content-language", "" },
+  { "content-length", "" },
+  { "content-location", "" },
+  { "content-range", "" },
+  { "content-type", "" },
+  { "cookie", "" },
+  { "date", "" },
+  { "etag", "" },
+  { "expect", "" },
+  { "expires", "" },
+  { "from", "" },
+  { "host", "" },
+  { "if-match", "" },
+  { "if-modified-since", "" },
+  { "if-none-match", "" },
+  { "if-range", "" },
+  { "if-unmodified-since", "" },
+  { "last-modified", "" },
+  { "link", "" },
+  { "location", "" },
+  { "max-forwards", "" },
+  { "proxy-authenticate", "" },
+  { "proxy-authorization", "" },
+  { "range", "" },
+  { "referer", "" },
+  { "refresh", "" },
+  { "retry-after", "" },
+  { "server", "" },
+  { "set-cookie", "" },
+  { "strict-transport-security", "" },
+  { "transfer-encoding", "" },
+  { "user-agent", "" },
+  { "vary", "" },
+  { "via", "" },
+  { "www-authenticate", "" },
+};
+
+static const uint64_t cStaticSize = sizeof(cStatic) / sizeof(cStatic[0]);
+
+// RFC 7541 Appendix B: each symbol's code, right aligned, and its length
+// in bits. Symbol 256 is EOS.
+static const struct {
+  uint32_t code;
+  int bits;
+} cHuffman[257] = {
+  { 0x00001ff8, 13 }, { 0x007fffd8, 23 }, { 0x0fffffe2, 28 }, { 0x0fffffe3, 28 },
+  { 0x0fffffe4, 28 }, { 0x0fffffe5, 28 }, { 0x0fffffe6, 28 }, { 0x0fffffe7, 28 },
+  { 0x0fffffe8, 28 }, { 0x00ffffea, 24 }, { 0x3ffffffc, 30 }, { 0x0fffffe9, 28 },
+  { 0x0fffffea, 28 }, { 0x3ffffffd, 30 }, { 0x0fffffeb, 28 }, { 0x0fffffec, 28 },
+  { 0x0fffffed, 28 }, { 0x0fffffee, 28 }, { 0x0fffffef, 28 }, { 0x0ffffff0, 28 },
+  { 0x0ffffff1, 28 }, { 0x0ffffff2, 28 }, { 0x3ffffffe, 30 }, { 0x0ffffff3, 28 },
+  { 0x0ffffff4, 28 }, { 0x0ffffff5, 28 }, { 0x0ffffff6, 28 }, { 0x0ffffff7, 28 },
+  { 0x0ffffff8, 28 }, { 0x0ffffff9, 28 }, { 0x0ffffffa, 28 }, { 0x0ffffffb, 28 },
+  { 0x00000014, 6 }, { 0x000003f8, 10 }, { 0x000003f9, 10 }, { 0x00000ffa, 12 },
+  { 0x00001ff9, 13 }, { 0x00000015, 6 }, { 0x000000f8, 8 }, { 0x000007fa, 11 },
+  { 0x000003fa, 10 }, { 0x000003fb, 10 }, { 0x000000f9, 8 }, { 0x000007fb, 11 },
+  { 0x000000fa, 8 }, { 0x00000016, 6 }, { 0x00000017, 6 }, { 0x00000018, 6 },
+  { 0x00000000, 5 }, { 0x00000001, 5 }, { 0x00000002, 5 }, { 0x00000019, 6 },
+  { 0x0000001a, 6 }, { 0x0000001b, 6 }, { 0x0000001c, 6 }, { 0x0000001d, 6 },
+  { 0x0000001e, 6 }, { 0x0000001f, 6 }, { 0x0000005c, 7 }, { 0x000000fb, 8 },
+  { 0x00007ffc, 15 }, { 0x00000020, 6 }, { 0x00000ffb, 12 }, { 0x000003fc, 10 },
+  { 0x00001ffa, 13 }, { 0x00000021, 6 }, { 0x0000005d, 7 }, { 0x0000005e, 7 },
+  { 0x0000005f, 7 }, { 0x00000060, 7 }, { 0x00000061, 7 }, { 0x00000062, 7 },
+  { 0x00000063, 7 }, { 0x00000064, 7 }, { 0x00000065, 7 }, { 0x00000066, 7 },
+  { 0x00000067, 7 }, { 0x00000068, 7 }, { 0x00000069, 7 }, { 0x0000006a, 7 },
+  { 0x0000006b, 7 }, { 0x0000006c, 7 }, { 0x0000006d, 7 }, { 0x0000006e, 7 },
+  { 0x0000006f, 7 }, { 0x00000070, 7 }, { 0x00000071, 7 }, { 0x00000072, 7 },
+  { 0x000000fc, 8 }, { 0x00000073, 7 }, { 0x000000fd, 8 }, { 0x00001ffb, 13 },
+  { 0x0007fff0, 19 }, { 0x00001ffc, 13 }, { 0x00003ffc, 14 }, { 0x00000022, 6 },
+  { 0x00007ffd, 15 }, { 0x00000003, 5 }, { 0x00000023, 6 }, { 0x00000004, 5 },
+  { 0x00000024, 6 }, { 0x00000005, 5 }, { 0x00000025, 6 }, { 0x00000026, 6 },
+  { 0x00000027, 6 }, { 0x00000006, 5 }, { 0x00000074, 7 }, { 0x00000075, 7 },
+  { 0x00000028, 6 }, { 0x00000029, 6 }, { 0x0000002a, 6 }, { 0x00000007, 5 },
+  { 0x0000002b, 6 }, { 0x00000076, 7 }, { 0x0000002c, 6 }, { 0x00000008, 5 },
+  { 0x00000009, 5 }, { 0x0000002d, 6 }, { 0x00000077, 7 }, { 0x00000078, 7 },
+  { 0x00000079, 7 }, { 0x0000007a, 7 }, { 0x0000007b, 7 }, { 0x00007ffe, 15 },
+  { 0x000007fc, 11 }, { 0x00003ffd, 14 }, { 0x00001ffd, 13 }, { 0x0ffffffc, 28 },
+  { 0x000fffe6, 20 }, { 0x003fffd2, 22 }, { 0x000fffe7, 20 }, { 0x000fffe8, 20 },
+  { 0x003fffd3, 22 }, { 0x003fffd4, 22 }, { 0x003fffd5, 22 }, { 0x007fffd9, 23 },
+  { 0x003fffd6, 22 }, { 0x007fffda, 23 }, { 0x007fffdb, 23 }, { 0x007fffdc, 23 },
+  { 0x007fffdd, 23 }, { 0x007fffde, 23 }, { 0x00ffffeb, 24 }, { 0x007fffdf, 23 },
+  { 0x00ffffec, 24 }, { 0x00ffffed, 24 }, { 0x003fffd7, 22 }, { 0x007fffe0, 23 },
+  { 0x00ffffee, 24 }, { 0x007fffe1, 23 }, { 0x007fffe2, 23 }, { 0x007fffe3, 23 },
+  { 0x007fffe4, 23 }, { 0x001fffdc, 21 }, { 0x003fffd8, 22 }, { 0x007fffe5, 23 },
+  { 0x003fffd9, 22 }, { 0x007fffe6, 23 }, { 0x007fffe7, 23 }, { 0x00ffffef, 24 },
+  { 0x003fffda, 22 }, { 0x001fffdd, 21 }, { 0x000fffe9, 20 }, { 0x003fffdb, 22 },
+  { 0x003fffdc, 22 }, { 0x007fffe8, 23 }, { 0x007fffe9, 23 }, { 0x001fffde, 21 },
+  { 0x007fffea, 23 }, { 0x003fffdd, 22 }, { 0x003fffde, 22 }, { 0x00fffff0, 24 },
+  { 0x001fffdf, 21 }, { 0x003fffdf, 22 }, { 0x007fffeb, 23 }, { 0x007fffec, 23 },
+  { 0x001fffe0, 21 }, { 0x001fffe1, 21 }, { 0x003fffe0, 22 }, { 0x001fffe2, 21 },
+  { 0x007fffed, 23 }, { 0x003fffe1, 22 }, { 0x007fffee, 23 }, { 0x007fffef, 23 },
+  { 0x000fffea, 20 }, { 0x003fffe2, 22 }, { 0x003fffe3, 22 }, { 0x003fffe4, 22 },
+  { 0x007ffff0, 23 }, { 0x003fffe5, 22 }, { 0x003fffe6, 22 }, { 0x007ffff1, 23 },
+  { 0x03ffffe0, 26 }, { 0x03ffffe1, 26 }, { 0x000fffeb, 20 }, { 0x0007fff1, 19 },
+  { 0x003fffe7, 22 }, { 0x007ffff2, 23 }, { 0x003fffe8, 22 }, { 0x01ffffec, 25 },
+  { 0x03ffffe2, 26 }, { 0x03ffffe3, 26 }, { 0x03ffffe4, 26 }, { 0x07ffffde, 27 },
+  { 0x07ffffdf, 27 }, { 0x03ffffe5, 26 }, { 0x00fffff1, 24 }, { 0x01ffffed, 25 },
+  { 0x0007fff2, 19 }, { 0x001fffe3, 21 }, { 0x03ffffe6, 26 }, { 0x07ffffe0, 27 },
+  { 0x07ffffe1, 27 }, { 0x03ffffe7, 26 }, { 0x07ffffe2, 27 }, { 0x00fffff2, 24 },
+  { 0x001fffe4, 21 }, { 0x001fffe5, 21 }, { 0x03ffffe8, 26 }, { 0x03ffffe9, 26 },
+  { 0x0ffffffd, 28 }, { 0x07ffffe3, 27 }, { 0x07ffffe4, 27 }, { 0x07ffffe5, 27 },
+  { 0x000fffec, 20 }, { 0x00fffff3, 24 }, { 0x000fffed, 20 }, { 0x001fffe6, 21 },
+  { 0x003fffe9, 22 }, { 0x001fffe7, 21 }, { 0x001fffe8, 21 }, { 0x007ffff3, 23 },
+  { 0x003fffea, 22 }, { 0x003fffeb, 22 }, { 0x01ffffee, 25 }, { 0x01ffffef, 25 },
+  { 0x00fffff4, 24 }, { 0x00fffff5, 24 }, { 0x03ffffea, 26 }, { 0x007ffff4, 23 },
+  { 0x03ffffeb, 26 }, { 0x07ffffe6, 27 }, { 0x03ffffec, 26 }, { 0x03ffffed, 26 },
+  { 0x07ffffe7, 27 }, { 0x07ffffe8, 27 }, { 0x07ffffe9, 27 }, { 0x07ffffea, 27 },
+  { 0x07ffffeb, 27 }, { 0x0ffffffe, 28 }, { 0x07ffffec, 27 }, { 0x07ffffed, 27 },
+  { 0x07ffffee, 27 }, { 0x07ffffef, 27 }, { 0x07fffff0, 27 }, { 0x03ffffee, 26 },
+  { 0x3fffffff, 30 },
+};
+
+// The code as a state machine that takes four bits at a time. States are
+// the code tree's internal nodes, the root being 0; no code is shorter
+// than five bits, so a step emits at most one symbol.
+class HuffmanDecoder {
+  enum { eEmit = 1, eFail = 2 };
+
+  struct Step {
+    uint8_t next;
+    uint8_t flags;
+    uint8_t sym;
+  };
+
+  Step steps_[256][16];
+
+  // States a string may end in: padding is up to seven of the ones EOS
+  // starts with.
+  bool accept_[256];
+
+public:
+  HuffmanDecoder()
+    : steps_()
+    , accept_()
+  {
+    // Children are internal nodes below 256 and symbols at 256 and up;
+    // 0 is the root, so it also means not yet set.
+    int tree[256][2];
+    int nodes = 1;
+
+    memset(tree, 0, sizeof(tree));
+
+    for(int sym = 0; sym < 257; sym++) {
+      uint32_t code = cHuffman[sym].code;
+      int n = 0;
+
+      for(int bit = cHuffman[sym].bits - 1; bit > 0; bit--) {
+        int b = (code >> bit) & 1;
+
+        if(!tree[n][b]) tree[n][b] = nodes++;
+        n = tree[n][b];
+      }
+
+      tree[n][code & 1] = 256 + sym;
+    }
+
+    for(int d = 0, n = 0; d < 8; d++, n = tree[n][1]) {
+      accept_[n] = true;
+    }
+
+    for(int s = 0; s < nodes; s++) {
+      for(int v = 0; v < 16; v++) {
+        Step& step = steps_[s][v];
+        int n = s;
+
+        for(int bit = 3; bit >= 0; bit--) {
+          int c = tree[n][(v >> bit) & 1];
+
+          if(c < 256) {
+            n = c;
+          } else if(c == 256 + 256) {
+            step.flags |= eFail;
+            break;
+          } else {
+            step.flags |= eEmit;
+            step.sym = c - 256;
+            n = 0;
+          }
+        }
+
+        step.next = n;
+      }
+    }
+  }
+
+  bool decode(const uint8_t* p, size_t size, std::string& out) const {
+    int state = 0;
+
+    for(size_t i = 0; i < size; i++) {
+      const Step& hi = steps_[state][p[i] >> 4];
+      if(hi.flags & eFail) return false;
+      if(hi.flags & eEmit) out.push_back(hi.sym);
+
+      const Step& lo = steps_[hi.next][p[i] & 15];
+      if(lo.flags & eFail) return false;
+      if(lo.flags & eEmit) out.push_back(lo.sym);
+
+      state = lo.next;
+    }
+
+    return accept_[state];
+  }
+};
+
+// Built before any loop starts.
+static const HuffmanDecoder sHuffman;
+
+// An integer with an n bit prefix. Anything past 2^32 is taken as an
+// attack rather than a header.
+static bool read_int(const uint8_t*& p, const uint8_t* end, int n,
+                     uint64_t& out) {
+  if(p == end) return false;
+
+  uint64_t mask = (1 << n) - 1;
+  out = *p++ & mask;
+
+  if(out < mask) return true;
+
+  for(int shift = 0; shift <= 28; shift += 7) {
+    if(p == end) return false;
+
+    uint8_t b = *p++;
+    out += (uint64_t)(b & 0x7f) << shift;
+
+    if(!(b & 0x80)) return true;
+  }
+
+  return false;
+}
+
+static bool read_string(const uint8_t*& p, const uint8_t* end,
+                        std::string& out) {
+  if(p == end) return false;
+
+  bool huffman = *p & 0x80;
+  uint64_t size;
+
+  if(!read_int(p, end, 7, size) || size > (uint64_t)(end - p)) return false;
+
+  const uint8_t* at = p;
+  p += size;
+
+  if(huffman) return sHuffman.decode(at, size, out);
+
+  out.assign((const char*)at, size);
+  return true;
+}
+
+HpackDecoder::HpackDecoder(size_t limit, size_t max_list)
+  : table_()
+  , size_(0)
+  , max_size_(limit)
+  , limit_(limit)
+  , max_list_(max_list)
+{}
+
+bool HpackDecoder::field(uint64_t index, Field& out) {
+  if(index == 0) return false;
+
+  if(index <= cStaticSize) {
+    out.first = cStatic[index - 1][0];
+    out.second = cStatic[index - 1][1];
+    return true;
+  }
+
+  index -= cStaticSize + 1;
+  if(index >= table_.size()) return false;
+
+  out = table_[index];
+  return true;
+}
+
+void HpackDecoder::evict(size_t max) {
+  while(size_ > max) {
+    const Field& f = table_.back();
+
+    size_ -= f.first.size() + f.second.size() + cEntryOverhead;
+    table_.pop_back();
+  }
+}
+
+// An entry too big for the table empties it and isn't added.
+void HpackDecoder::insert(const Field& f) {
+  size_t size = f.first.size() + f.second.size() + cEntryOverhead;
+
+  if(size > max_size_) {
+    evict(0);
+    return;
+  }
+
+  evict(max_size_ - size);
+
+  table_.push_front(f);
+  size_ += size;
+}
+
+HpackDecoder::Result HpackDecoder::decode(const uint8_t* p, size_t size,
+                                          Fields& out) {
+  const uint8_t* end = p + size;
+  uint64_t index;
+  size_t list = 0;
+  bool started = false;   // a field has been decoded
+
+  while(p < end) {
+    uint8_t b = *p;
+
+    // Indexed field
+    if(b & 0x80) {
+      Field f;
+
+      if(!read_int(p, end, 7, index) || !field(index, f)) return eCorrupt;
+
+      started = true;
+      list += f.first.size() + f.second.size() + cEntryOverhead;
+      if(list <= max_list_) out.push_back(f);
+      continue;
+    }
+
+    // Dynamic table size update, only allowed at the start of a block.
+    if((b & 0xe0) == 0x20) {
+      if(started) return eCorrupt;
+      if(!read_int(p, end, 5, index) || index > limit_) return eCorrupt;
+
+      max_size_ = index;
+      evict(max_size_);
+      continue;
+    }
+
+    // Literal, with incremental indexing (01) or without (0000, 0001).
+    bool indexed = (b & 0xc0) == 0x40;
+    Field f;
+
+    if(!read_int(p, end, indexed ? 6 : 4, index)) return eCorrupt;
+
+    if(index) {
+      if(!field(index, f)) return eCorrupt;
+    } else if(!read_string(p, end, f.first)) {
+      return eCorrupt;
+    }
+
+    f.second.clear();
+    if(!read_string(p, end, f.second)) return eCorrupt;
+
+    if(indexed) insert(f);
+
+    started = true;
+    list += f.first.size() + f.second.size() + cEntryOverhead;
+    if(list <= max_list_) out.push_back(f);
+  }
+
+  return list <= max_list_ ? eDecoded : eTooLarge;
+}
+
+static void put_int(std::string& out, uint8_t first, int n, uint64_t v) {
+  uint64_t mask = (1 << n) - 1;
+
+  if(v < mask) {
+    out.push_back(first | v);
+    return;
+  }
+
+  out.push_back(first | mask);
+  v -= mask;
+
+  while(v >= 0x80) {
+    out.push_back((v & 0x7f) | 0x80);
+    v >>= 7;
+  }
+
+  out.push_back(v);
+}
+
+static void put_string(std::string& out, const char* str, size_t size) {
+  put_int(out, 0, 7, size);
+  out.append(str, size);
+}
+
+void hpack_status(std::string& out, int status) {
+  int index = 0;
+
+  switch(status) {
+  case 200: index = 8; break;
+  case 204: index = 9; break;
+  case 206: index = 10; break;
+  case 304: index = 11; break;
+  case 400: index = 12; break;
+  case 404: index = 13; break;
+  case 500: index = 14; break;
+  }
+
+  if(index) {
+    put_int(out, 0x80, 7, index);
+    return;
+  }
+
+  char digits[16];
+  int size = snprintf(digits, sizeof(digits), "%d", status);
+
+  // Literal without indexing, named by the :status entry at index 8.
+  put_int(out, 0, 4, 8);
+  put_string(out, digits, size);
+}
+
+void hpack_literal(std::string& out, const char* name, size_t name_size,
+                   const char* value, size_t value_size) {
+  out.push_back(0);
+  put_string(out, name, name_size);
+  put_string(out, value, value_size);
+}
@@ -0,0 +1,60 @@
+#ifndef HPACK_HPP
+#define HPACK_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+// HPACK (RFC 7541) header compression for the HTTP/2 front end.
+//
+// Requests are decoded in full: static and dynamic table references,
+// literals and Huffman coded strings. Responses are encoded without
+// touching the client's dynamic table, as literals and references to
+// the static :status entries, so there's no encoder state to keep.
+class HpackDecoder {
+public:
+  typedef std::pair<std::string, std::string> Field;
+  typedef std::vector<Field> Fields;
+
+  enum Result {
+    eDecoded,
+    eTooLarge,   // past max_list; the table is still in step
+    eCorrupt     // a COMPRESSION_ERROR; the connection can't carry on
+  };
+
+private:
+  // Newest first, as the dynamic part of the index space runs.
+  std::deque<Field> table_;
+
+  size_t size_;       // name and value bytes, plus 32 per entry
+  size_t max_size_;   // as last set by a size update in a block
+  size_t limit_;      // the SETTINGS_HEADER_TABLE_SIZE we advertise
+  size_t max_list_;   // the SETTINGS_MAX_HEADER_LIST_SIZE we advertise
+
+  bool field(uint64_t index, Field& out);
+  void insert(const Field& f);
+  void evict(size_t max);
+
+public:
+  HpackDecoder(size_t limit, size_t max_list);
+
+  // Appends the fields of a complete header block to out. Once they add
+  // up to more than max_list (counted as the table counts entries), the
+  // rest are decoded only for the sake of the table and dropped, since a
+  // small block can reference big entries many times over.
+  Result decode(const uint8_t* p, size_t size, Fields& out);
+};
+
+// Appends a :status field to a header block.
+void hpack_status(std::string& out, int status);
+
+// Appends a field the client isn't to add to its dynamic table. name has
+// to be lower case already.
+void hpack_literal(std::string& out, const char* name, size_t name_size,
+                   const char* value, size_t value_size);
+
+#endif
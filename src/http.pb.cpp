@@ -1,1435 +1,3474 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: http.proto
 
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
 #include "http.pb.h"
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
 // @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
 
-namespace http {
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-namespace {
-
-const ::google::protobuf::Descriptor* Header_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Header_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Header_Key_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Request_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Request_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Request_Method_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Response_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Response_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_http_2eproto() {
-  protobuf_AddDesc_http_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "http.proto");
-  GOOGLE_CHECK(file != NULL);
-  Header_descriptor_ = file->message_type(0);
-  static const int Header_offsets_[3] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Header, key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Header, custom_key_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Header, value_),
+namespace http {
+PROTOBUF_CONSTEXPR Header::Header(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.custom_key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/0} {}
+struct HeaderDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HeaderDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HeaderDefaultTypeInternal() {}
+  union {
+    Header _instance;
   };
-  Header_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Header_descriptor_,
-      Header::default_instance_,
-      Header_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Header, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Header, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Header));
-  Header_Key_descriptor_ = Header_descriptor_->enum_type(0);
-  Request_descriptor_ = file->message_type(1);
-  static const int Request_offsets_[8] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, version_major_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, version_minor_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, stream_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, method_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, custom_method_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, url_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, body_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HeaderDefaultTypeInternal _Header_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.headers_)*/{}
+  , /*decltype(_impl_.custom_method_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.url_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.reply_to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.bulk_reply_to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.version_major_)*/0u
+  , /*decltype(_impl_.version_minor_)*/0u
+  , /*decltype(_impl_.stream_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.deadline_)*/uint64_t{0u}
+  , /*decltype(_impl_.method_)*/0} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
   };
-  Request_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Request_descriptor_,
-      Request::default_instance_,
-      Request_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Request));
-  Request_Method_descriptor_ = Request_descriptor_->enum_type(0);
-  Response_descriptor_ = file->message_type(2);
-  static const int Response_offsets_[4] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, stream_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, status_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, headers_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, body_),
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.headers_)*/{}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stream_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0u
+  , /*decltype(_impl_.streamed_)*/false} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
   };
-  Response_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Response_descriptor_,
-      Response::default_instance_,
-      Response_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Response, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Response));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_http_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Header_descriptor_, &Header::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Request_descriptor_, &Request::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Response_descriptor_, &Response::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_http_2eproto() {
-  delete Header::default_instance_;
-  delete Header_reflection_;
-  delete Request::default_instance_;
-  delete Request_reflection_;
-  delete Response::default_instance_;
-  delete Response_reflection_;
-}
-
-void protobuf_AddDesc_http_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\nhttp.proto\022\004http\"w\n\006Header\022\035\n\003key\030\001 \001("
-    "\0162\020.http.Header.Key\022\022\n\ncustom_key\030\002 \001(\t\022"
-    "\r\n\005value\030\003 \002(\t\"+\n\003Key\022\010\n\004HOST\020\000\022\n\n\006ACCEP"
-    "T\020\001\022\016\n\nUSER_AGENT\020\002\"\375\001\n\007Request\022\025\n\rversi"
-    "on_major\030\001 \002(\r\022\025\n\rversion_minor\030\002 \002(\r\022\021\n"
-    "\tstream_id\030\010 \002(\r\022$\n\006method\030\003 \001(\0162\024.http."
-    "Request.Method\022\025\n\rcustom_method\030\004 \001(\t\022\013\n"
-    "\003url\030\005 \002(\t\022\035\n\007headers\030\006 \003(\0132\014.http.Heade"
-    "r\022\014\n\004body\030\007 \001(\014\":\n\006Method\022\n\n\006DELETE\020\000\022\007\n"
-    "\003GET\020\001\022\010\n\004HEAD\020\002\022\010\n\004POST\020\003\022\007\n\003PUT\020\004\"Z\n\010R"
-    "esponse\022\021\n\tstream_id\030\001 \002(\r\022\016\n\006status\030\002 \002"
-    "(\r\022\035\n\007headers\030\003 \003(\0132\014.http.Header\022\014\n\004bod"
-    "y\030\004 \001(\014", 487);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "http.proto", &protobuf_RegisterTypes);
-  Header::default_instance_ = new Header();
-  Request::default_instance_ = new Request();
-  Response::default_instance_ = new Response();
-  Header::default_instance_->InitAsDefaultInstance();
-  Request::default_instance_->InitAsDefaultInstance();
-  Response::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_http_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_http_2eproto {
-  StaticDescriptorInitializer_http_2eproto() {
-    protobuf_AddDesc_http_2eproto();
-  }
-} static_descriptor_initializer_http_2eproto_;
-
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* Header_Key_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Header_Key_descriptor_;
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+PROTOBUF_CONSTEXPR ResponseChunk::ResponseChunk(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stream_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.end_)*/false} {}
+struct ResponseChunkDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseChunkDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseChunkDefaultTypeInternal() {}
+  union {
+    ResponseChunk _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseChunkDefaultTypeInternal _ResponseChunk_default_instance_;
+PROTOBUF_CONSTEXPR RequestBatch::RequestBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.requests_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RequestBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestBatchDefaultTypeInternal() {}
+  union {
+    RequestBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestBatchDefaultTypeInternal _RequestBatch_default_instance_;
+PROTOBUF_CONSTEXPR ResponseBatch::ResponseBatch(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.responses_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResponseBatchDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseBatchDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseBatchDefaultTypeInternal() {}
+  union {
+    ResponseBatch _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseBatchDefaultTypeInternal _ResponseBatch_default_instance_;
+PROTOBUF_CONSTEXPR Cancel::Cancel(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stream_ids_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CancelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CancelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CancelDefaultTypeInternal() {}
+  union {
+    Cancel _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CancelDefaultTypeInternal _Cancel_default_instance_;
+PROTOBUF_CONSTEXPR Flow::Flow(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.paused_)*/{}
+  , /*decltype(_impl_.resumed_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FlowDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FlowDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FlowDefaultTypeInternal() {}
+  union {
+    Flow _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FlowDefaultTypeInternal _Flow_default_instance_;
+PROTOBUF_CONSTEXPR SocketMessage::SocketMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.reply_to_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.body_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.request_)*/nullptr
+  , /*decltype(_impl_.stream_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.binary_)*/false
+  , /*decltype(_impl_.end_)*/false} {}
+struct SocketMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SocketMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SocketMessageDefaultTypeInternal() {}
+  union {
+    SocketMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SocketMessageDefaultTypeInternal _SocketMessage_default_instance_;
+}  // namespace http
+static ::_pb::Metadata file_level_metadata_http_2eproto[9];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_http_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_http_2eproto = nullptr;
+
+const uint32_t TableStruct_http_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  PROTOBUF_FIELD_OFFSET(::http::Header, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::http::Header, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::Header, _impl_.key_),
+  PROTOBUF_FIELD_OFFSET(::http::Header, _impl_.custom_key_),
+  PROTOBUF_FIELD_OFFSET(::http::Header, _impl_.value_),
+  2,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.version_major_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.version_minor_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.stream_id_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.method_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.custom_method_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.url_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.headers_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.reply_to_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.bulk_reply_to_),
+  PROTOBUF_FIELD_OFFSET(::http::Request, _impl_.deadline_),
+  5,
+  6,
+  7,
+  9,
+  0,
+  1,
+  ~0u,
+  2,
+  3,
+  4,
+  8,
+  PROTOBUF_FIELD_OFFSET(::http::Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::http::Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::Response, _impl_.stream_id_),
+  PROTOBUF_FIELD_OFFSET(::http::Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::http::Response, _impl_.headers_),
+  PROTOBUF_FIELD_OFFSET(::http::Response, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::http::Response, _impl_.streamed_),
+  1,
+  2,
+  ~0u,
+  0,
+  3,
+  PROTOBUF_FIELD_OFFSET(::http::ResponseChunk, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::http::ResponseChunk, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::ResponseChunk, _impl_.stream_id_),
+  PROTOBUF_FIELD_OFFSET(::http::ResponseChunk, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::http::ResponseChunk, _impl_.end_),
+  1,
+  0,
+  2,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::http::RequestBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::RequestBatch, _impl_.requests_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::http::ResponseBatch, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::ResponseBatch, _impl_.responses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::http::Cancel, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::Cancel, _impl_.stream_ids_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::http::Flow, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::Flow, _impl_.paused_),
+  PROTOBUF_FIELD_OFFSET(::http::Flow, _impl_.resumed_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_.stream_id_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_.reply_to_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_.binary_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_.body_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::http::SocketMessage, _impl_.request_),
+  3,
+  0,
+  4,
+  1,
+  5,
+  2,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, 9, -1, sizeof(::http::Header)},
+  { 12, 29, -1, sizeof(::http::Request)},
+  { 40, 51, -1, sizeof(::http::Response)},
+  { 56, 65, -1, sizeof(::http::ResponseChunk)},
+  { 68, -1, -1, sizeof(::http::RequestBatch)},
+  { 75, -1, -1, sizeof(::http::ResponseBatch)},
+  { 82, -1, -1, sizeof(::http::Cancel)},
+  { 89, -1, -1, sizeof(::http::Flow)},
+  { 97, 109, -1, sizeof(::http::SocketMessage)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::http::_Header_default_instance_._instance,
+  &::http::_Request_default_instance_._instance,
+  &::http::_Response_default_instance_._instance,
+  &::http::_ResponseChunk_default_instance_._instance,
+  &::http::_RequestBatch_default_instance_._instance,
+  &::http::_ResponseBatch_default_instance_._instance,
+  &::http::_Cancel_default_instance_._instance,
+  &::http::_Flow_default_instance_._instance,
+  &::http::_SocketMessage_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_http_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nhttp.proto\022\004http\"\332\t\n\006Header\022\035\n\003key\030\001 \001"
+  "(\0162\020.http.Header.Key\022\022\n\ncustom_key\030\002 \001(\t"
+  "\022\r\n\005value\030\003 \002(\t\"\215\t\n\003Key\022\010\n\004HOST\020\000\022\n\n\006ACC"
+  "EPT\020\001\022\016\n\nUSER_AGENT\020\002\022\022\n\016ACCEPT_CHARSET\020"
+  "\003\022\023\n\017ACCEPT_ENCODING\020\004\022\023\n\017ACCEPT_LANGUAG"
+  "E\020\005\022\023\n\017ACCEPT_DATETIME\020\006\022!\n\035ACCESS_CONTR"
+  "OL_REQUEST_METHOD\020\007\022\"\n\036ACCESS_CONTROL_RE"
+  "QUEST_HEADERS\020\010\022\021\n\rAUTHORIZATION\020\t\022\021\n\rCA"
+  "CHE_CONTROL\020\n\022\016\n\nCONNECTION\020\013\022\024\n\020CONTENT"
+  "_ENCODING\020\014\022\022\n\016CONTENT_LENGTH\020\r\022\017\n\013CONTE"
+  "NT_MD5\020\016\022\020\n\014CONTENT_TYPE\020\017\022\n\n\006COOKIE\020\020\022\010"
+  "\n\004DATE\020\021\022\007\n\003DNT\020\022\022\n\n\006EXPECT\020\023\022\r\n\tFORWARD"
+  "ED\020\024\022\010\n\004FROM\020\025\022\014\n\010IF_MATCH\020\026\022\025\n\021IF_MODIF"
+  "IED_SINCE\020\027\022\021\n\rIF_NONE_MATCH\020\030\022\014\n\010IF_RAN"
+  "GE\020\031\022\027\n\023IF_UNMODIFIED_SINCE\020\032\022\016\n\nKEEP_AL"
+  "IVE\020\033\022\020\n\014MAX_FORWARDS\020\034\022\n\n\006ORIGIN\020\035\022\n\n\006P"
+  "RAGMA\020\036\022\014\n\010PRIORITY\020\037\022\027\n\023PROXY_AUTHORIZA"
+  "TION\020 \022\024\n\020PROXY_CONNECTION\020!\022\t\n\005RANGE\020\"\022"
+  "\013\n\007REFERER\020#\022\006\n\002TE\020$\022\013\n\007TRAILER\020%\022\025\n\021TRA"
+  "NSFER_ENCODING\020&\022\013\n\007UPGRADE\020\'\022\035\n\031UPGRADE"
+  "_INSECURE_REQUESTS\020(\022\007\n\003VIA\020)\022\013\n\007WARNING"
+  "\020*\022\022\n\016SEC_FETCH_DEST\020+\022\022\n\016SEC_FETCH_MODE"
+  "\020,\022\022\n\016SEC_FETCH_SITE\020-\022\022\n\016SEC_FETCH_USER"
+  "\020.\022\025\n\021SEC_WEBSOCKET_KEY\020/\022\031\n\025SEC_WEBSOCK"
+  "ET_VERSION\0200\022\032\n\026SEC_WEBSOCKET_PROTOCOL\0201"
+  "\022\034\n\030SEC_WEBSOCKET_EXTENSIONS\0202\022\024\n\020X_REQU"
+  "ESTED_WITH\0203\022\023\n\017X_FORWARDED_FOR\0204\022\024\n\020X_F"
+  "ORWARDED_HOST\0205\022\025\n\021X_FORWARDED_PROTO\0206\022\r"
+  "\n\tX_REAL_IP\0207\022\020\n\014X_REQUEST_ID\0208\022\024\n\020X_COR"
+  "RELATION_ID\0209\022\020\n\014X_CSRF_TOKEN\020:\022\032\n\026X_HTT"
+  "P_METHOD_OVERRIDE\020;\022\025\n\021X_REQUEST_TIMEOUT"
+  "\020<\022\023\n\017X_TRAFFIC_CLASS\020=\"\270\002\n\007Request\022\025\n\rv"
+  "ersion_major\030\001 \002(\r\022\025\n\rversion_minor\030\002 \002("
+  "\r\022\021\n\tstream_id\030\010 \002(\004\022$\n\006method\030\003 \001(\0162\024.h"
+  "ttp.Request.Method\022\025\n\rcustom_method\030\004 \001("
+  "\t\022\013\n\003url\030\005 \002(\t\022\035\n\007headers\030\006 \003(\0132\014.http.H"
+  "eader\022\014\n\004body\030\007 \001(\014\022\020\n\010reply_to\030\t \001(\t\022\025\n"
+  "\rbulk_reply_to\030\n \001(\t\022\020\n\010deadline\030\013 \001(\004\":"
+  "\n\006Method\022\n\n\006DELETE\020\000\022\007\n\003GET\020\001\022\010\n\004HEAD\020\002\022"
+  "\010\n\004POST\020\003\022\007\n\003PUT\020\004\"l\n\010Response\022\021\n\tstream"
+  "_id\030\001 \002(\004\022\016\n\006status\030\002 \002(\r\022\035\n\007headers\030\003 \003"
+  "(\0132\014.http.Header\022\014\n\004body\030\004 \001(\014\022\020\n\010stream"
+  "ed\030\005 \001(\010\"=\n\rResponseChunk\022\021\n\tstream_id\030\001"
+  " \002(\004\022\014\n\004body\030\004 \001(\014\022\013\n\003end\030\005 \001(\010\" \n\014Reque"
+  "stBatch\022\020\n\010requests\030\001 \003(\014\"\"\n\rResponseBat"
+  "ch\022\021\n\tresponses\030\001 \003(\014\"\034\n\006Cancel\022\022\n\nstrea"
+  "m_ids\030\001 \003(\004\"\'\n\004Flow\022\016\n\006paused\030\001 \003(\004\022\017\n\007r"
+  "esumed\030\002 \003(\004\"\177\n\rSocketMessage\022\021\n\tstream_"
+  "id\030\001 \002(\004\022\020\n\010reply_to\030\002 \001(\t\022\016\n\006binary\030\003 \001"
+  "(\010\022\014\n\004body\030\004 \001(\014\022\013\n\003end\030\005 \001(\010\022\036\n\007request"
+  "\030\006 \001(\0132\r.http.Request"
+  ;
+static ::_pbi::once_flag descriptor_table_http_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_http_2eproto = {
+    false, false, 2021, descriptor_table_protodef_http_2eproto,
+    "http.proto",
+    &descriptor_table_http_2eproto_once, nullptr, 0, 9,
+    schemas, file_default_instances, TableStruct_http_2eproto::offsets,
+    file_level_metadata_http_2eproto, file_level_enum_descriptors_http_2eproto,
+    file_level_service_descriptors_http_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_http_2eproto_getter() {
+  return &descriptor_table_http_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_http_2eproto(&descriptor_table_http_2eproto);
+namespace http {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Header_Key_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_http_2eproto);
+  return file_level_enum_descriptors_http_2eproto[0];
 }
 bool Header_Key_IsValid(int value) {
-  switch(value) {
+  switch (value) {
     case 0:
     case 1:
     case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+    case 19:
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+    case 34:
+    case 35:
+    case 36:
+    case 37:
+    case 38:
+    case 39:
+    case 40:
+    case 41:
+    case 42:
+    case 43:
+    case 44:
+    case 45:
+    case 46:
+    case 47:
+    case 48:
+    case 49:
+    case 50:
+    case 51:
+    case 52:
+    case 53:
+    case 54:
+    case 55:
+    case 56:
+    case 57:
+    case 58:
+    case 59:
+    case 60:
+    case 61:
       return true;
     default:
       return false;
   }
 }
 
-#ifndef _MSC_VER
-const Header_Key Header::HOST;
-const Header_Key Header::ACCEPT;
-const Header_Key Header::USER_AGENT;
-const Header_Key Header::Key_MIN;
-const Header_Key Header::Key_MAX;
-const int Header::Key_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Header::kKeyFieldNumber;
-const int Header::kCustomKeyFieldNumber;
-const int Header::kValueFieldNumber;
-#endif  // !_MSC_VER
-
-Header::Header()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void Header::InitAsDefaultInstance() {
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Header_Key Header::HOST;
+constexpr Header_Key Header::ACCEPT;
+constexpr Header_Key Header::USER_AGENT;
+constexpr Header_Key Header::ACCEPT_CHARSET;
+constexpr Header_Key Header::ACCEPT_ENCODING;
+constexpr Header_Key Header::ACCEPT_LANGUAGE;
+constexpr Header_Key Header::ACCEPT_DATETIME;
+constexpr Header_Key Header::ACCESS_CONTROL_REQUEST_METHOD;
+constexpr Header_Key Header::ACCESS_CONTROL_REQUEST_HEADERS;
+constexpr Header_Key Header::AUTHORIZATION;
+constexpr Header_Key Header::CACHE_CONTROL;
+constexpr Header_Key Header::CONNECTION;
+constexpr Header_Key Header::CONTENT_ENCODING;
+constexpr Header_Key Header::CONTENT_LENGTH;
+constexpr Header_Key Header::CONTENT_MD5;
+constexpr Header_Key Header::CONTENT_TYPE;
+constexpr Header_Key Header::COOKIE;
+constexpr Header_Key Header::DATE;
+constexpr Header_Key Header::DNT;
+constexpr Header_Key Header::EXPECT;
+constexpr Header_Key Header::FORWARDED;
+constexpr Header_Key Header::FROM;
+constexpr Header_Key Header::IF_MATCH;
+constexpr Header_Key Header::IF_MODIFIED_SINCE;
+constexpr Header_Key Header::IF_NONE_MATCH;
+constexpr Header_Key Header::IF_RANGE;
+constexpr Header_Key Header::IF_UNMODIFIED_SINCE;
+constexpr Header_Key Header::KEEP_ALIVE;
+constexpr Header_Key Header::MAX_FORWARDS;
+constexpr Header_Key Header::ORIGIN;
+constexpr Header_Key Header::PRAGMA;
+constexpr Header_Key Header::PRIORITY;
+constexpr Header_Key Header::PROXY_AUTHORIZATION;
+constexpr Header_Key Header::PROXY_CONNECTION;
+constexpr Header_Key Header::RANGE;
+constexpr Header_Key Header::REFERER;
+constexpr Header_Key Header::TE;
+constexpr Header_Key Header::TRAILER;
+constexpr Header_Key Header::TRANSFER_ENCODING;
+constexpr Header_Key Header::UPGRADE;
+constexpr Header_Key Header::UPGRADE_INSECURE_REQUESTS;
+constexpr Header_Key Header::VIA;
+constexpr Header_Key Header::WARNING;
+constexpr Header_Key Header::SEC_FETCH_DEST;
+constexpr Header_Key Header::SEC_FETCH_MODE;
+constexpr Header_Key Header::SEC_FETCH_SITE;
+constexpr Header_Key Header::SEC_FETCH_USER;
+constexpr Header_Key Header::SEC_WEBSOCKET_KEY;
+constexpr Header_Key Header::SEC_WEBSOCKET_VERSION;
+constexpr Header_Key Header::SEC_WEBSOCKET_PROTOCOL;
+constexpr Header_Key Header::SEC_WEBSOCKET_EXTENSIONS;
+constexpr Header_Key Header::X_REQUESTED_WITH;
+constexpr Header_Key Header::X_FORWARDED_FOR;
+constexpr Header_Key Header::X_FORWARDED_HOST;
+constexpr Header_Key Header::X_FORWARDED_PROTO;
+constexpr Header_Key Header::X_REAL_IP;
+constexpr Header_Key Header::X_REQUEST_ID;
+constexpr Header_Key Header::X_CORRELATION_ID;
+constexpr Header_Key Header::X_CSRF_TOKEN;
+constexpr Header_Key Header::X_HTTP_METHOD_OVERRIDE;
+constexpr Header_Key Header::X_REQUEST_TIMEOUT;
+constexpr Header_Key Header::X_TRAFFIC_CLASS;
+constexpr Header_Key Header::Key_MIN;
+constexpr Header_Key Header::Key_MAX;
+constexpr int Header::Key_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Request_Method_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_http_2eproto);
+  return file_level_enum_descriptors_http_2eproto[1];
 }
-
-Header::Header(const Header& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
+bool Request_Method_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
 }
 
-void Header::SharedCtor() {
-  _cached_size_ = 0;
-  key_ = 0;
-  custom_key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
+#if (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
+constexpr Request_Method Request::DELETE;
+constexpr Request_Method Request::GET;
+constexpr Request_Method Request::HEAD;
+constexpr Request_Method Request::POST;
+constexpr Request_Method Request::PUT;
+constexpr Request_Method Request::Method_MIN;
+constexpr Request_Method Request::Method_MAX;
+constexpr int Request::Method_ARRAYSIZE;
+#endif  // (__cplusplus < 201703) && (!defined(_MSC_VER) || (_MSC_VER >= 1900 && _MSC_VER < 1912))
 
-Header::~Header() {
-  SharedDtor();
-}
+// ===================================================================
 
-void Header::SharedDtor() {
-  if (custom_key_ != &::google::protobuf::internal::kEmptyString) {
-    delete custom_key_;
+class Header::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Header>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
   }
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+  static void set_has_custom_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
-  if (this != default_instance_) {
+  static void set_has_value(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-}
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
 
-void Header::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+Header::Header(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.Header)
 }
-const ::google::protobuf::Descriptor* Header::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Header_descriptor_;
+Header::Header(const Header& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Header* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.custom_key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.key_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.custom_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.custom_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_custom_key()) {
+    _this->_impl_.custom_key_.Set(from._internal_custom_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_value()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.key_ = from._impl_.key_;
+  // @@protoc_insertion_point(copy_constructor:http.Header)
+}
+
+inline void Header::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.custom_key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.key_){0}
+  };
+  _impl_.custom_key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.custom_key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-const Header& Header::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_http_2eproto();
-  return *default_instance_;
+Header::~Header() {
+  // @@protoc_insertion_point(destructor:http.Header)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
 
-Header* Header::default_instance_ = NULL;
+inline void Header::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.custom_key_.Destroy();
+  _impl_.value_.Destroy();
+}
 
-Header* Header::New() const {
-  return new Header;
+void Header::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
 
 void Header::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    key_ = 0;
-    if (has_custom_key()) {
-      if (custom_key_ != &::google::protobuf::internal::kEmptyString) {
-        custom_key_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:http.Header)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.custom_key_.ClearNonDefaultToEmpty();
     }
-    if (has_value()) {
-      if (value_ != &::google::protobuf::internal::kEmptyString) {
-        value_->clear();
-      }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.value_.ClearNonDefaultToEmpty();
     }
   }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  _impl_.key_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Header::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Header::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // optional .http.Header.Key key = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::http::Header_Key_IsValid(value)) {
-            set_key(static_cast< ::http::Header_Key >(value));
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::http::Header_Key_IsValid(val))) {
+            _internal_set_key(static_cast<::http::Header_Key>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(1, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(1, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_custom_key;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional string custom_key = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_custom_key:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_custom_key()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->custom_key().data(), this->custom_key().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_value;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_custom_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.Header.custom_key");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string value = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_value:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_value()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->value().data(), this->value().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.Header.value");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Header::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Header::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.Header)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // optional .http.Header.Key key = 1;
-  if (has_key()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      1, this->key(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_key(), target);
   }
 
   // optional string custom_key = 2;
-  if (has_custom_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->custom_key().data(), this->custom_key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->custom_key(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_custom_key().data(), static_cast<int>(this->_internal_custom_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.Header.custom_key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_custom_key(), target);
   }
 
   // required string value = 3;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->value().data(), this->value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      3, this->value(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.Header.value");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_value(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:http.Header)
+  return target;
 }
 
-::google::protobuf::uint8* Header::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // optional .http.Header.Key key = 1;
-  if (has_key()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      1, this->key(), target);
+size_t Header::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.Header)
+  size_t total_size = 0;
+
+  // required string value = 3;
+  if (_internal_has_value()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // optional string custom_key = 2;
-  if (has_custom_key()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->custom_key().data(), this->custom_key().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->custom_key(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_custom_key());
   }
 
-  // required string value = 3;
-  if (has_value()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->value().data(), this->value().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        3, this->value(), target);
+  // optional .http.Header.Key key = 1;
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_key());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int Header::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // optional .http.Header.Key key = 1;
-    if (has_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->key());
-    }
-
-    // optional string custom_key = 2;
-    if (has_custom_key()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->custom_key());
-    }
-
-    // required string value = 3;
-    if (has_value()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->value());
-    }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Header::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Header::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Header::GetClassData() const { return &_class_data_; }
 
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
 
-void Header::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Header* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Header*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+void Header::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Header*>(&to_msg);
+  auto& from = static_cast<const Header&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.Header)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Header::MergeFrom(const Header& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_key()) {
-      set_key(from.key());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_custom_key(from._internal_custom_key());
     }
-    if (from.has_custom_key()) {
-      set_custom_key(from.custom_key());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_value(from._internal_value());
     }
-    if (from.has_value()) {
-      set_value(from.value());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.key_ = from._impl_.key_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Header::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Header::CopyFrom(const Header& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.Header)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Header::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000004) != 0x00000004) return false;
-
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
   return true;
 }
 
-void Header::Swap(Header* other) {
-  if (other != this) {
-    std::swap(key_, other->key_);
-    std::swap(custom_key_, other->custom_key_);
-    std::swap(value_, other->value_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
+void Header::InternalSwap(Header* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.custom_key_, lhs_arena,
+      &other->_impl_.custom_key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+  swap(_impl_.key_, other->_impl_.key_);
 }
 
-::google::protobuf::Metadata Header::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Header_descriptor_;
-  metadata.reflection = Header_reflection_;
-  return metadata;
+::PROTOBUF_NAMESPACE_ID::Metadata Header::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[0]);
 }
 
-
 // ===================================================================
 
-const ::google::protobuf::EnumDescriptor* Request_Method_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Request_Method_descriptor_;
-}
-bool Request_Method_IsValid(int value) {
-  switch(value) {
-    case 0:
-    case 1:
-    case 2:
-    case 3:
-    case 4:
-      return true;
-    default:
-      return false;
+class Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Request>()._impl_._has_bits_);
+  static void set_has_version_major(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
   }
-}
-
-#ifndef _MSC_VER
-const Request_Method Request::DELETE;
-const Request_Method Request::GET;
-const Request_Method Request::HEAD;
-const Request_Method Request::POST;
-const Request_Method Request::PUT;
-const Request_Method Request::Method_MIN;
-const Request_Method Request::Method_MAX;
-const int Request::Method_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Request::kVersionMajorFieldNumber;
-const int Request::kVersionMinorFieldNumber;
-const int Request::kStreamIdFieldNumber;
-const int Request::kMethodFieldNumber;
-const int Request::kCustomMethodFieldNumber;
-const int Request::kUrlFieldNumber;
-const int Request::kHeadersFieldNumber;
-const int Request::kBodyFieldNumber;
-#endif  // !_MSC_VER
-
-Request::Request()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+  static void set_has_version_minor(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_stream_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_method(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_custom_method(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_url(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_reply_to(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_bulk_reply_to(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_deadline(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x000000e2) ^ 0x000000e2) != 0;
+  }
+};
 
-void Request::InitAsDefaultInstance() {
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.Request)
 }
-
 Request::Request(const Request& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Request::SharedCtor() {
-  _cached_size_ = 0;
-  version_major_ = 0u;
-  version_minor_ = 0u;
-  stream_id_ = 0u;
-  method_ = 0;
-  custom_method_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  url_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  body_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.headers_){from._impl_.headers_}
+    , decltype(_impl_.custom_method_){}
+    , decltype(_impl_.url_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.reply_to_){}
+    , decltype(_impl_.bulk_reply_to_){}
+    , decltype(_impl_.version_major_){}
+    , decltype(_impl_.version_minor_){}
+    , decltype(_impl_.stream_id_){}
+    , decltype(_impl_.deadline_){}
+    , decltype(_impl_.method_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.custom_method_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.custom_method_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_custom_method()) {
+    _this->_impl_.custom_method_.Set(from._internal_custom_method(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_url()) {
+    _this->_impl_.url_.Set(from._internal_url(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_body()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.reply_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply_to()) {
+    _this->_impl_.reply_to_.Set(from._internal_reply_to(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.bulk_reply_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bulk_reply_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_bulk_reply_to()) {
+    _this->_impl_.bulk_reply_to_.Set(from._internal_bulk_reply_to(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.version_major_, &from._impl_.version_major_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.method_) -
+    reinterpret_cast<char*>(&_impl_.version_major_)) + sizeof(_impl_.method_));
+  // @@protoc_insertion_point(copy_constructor:http.Request)
+}
+
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.headers_){arena}
+    , decltype(_impl_.custom_method_){}
+    , decltype(_impl_.url_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.reply_to_){}
+    , decltype(_impl_.bulk_reply_to_){}
+    , decltype(_impl_.version_major_){0u}
+    , decltype(_impl_.version_minor_){0u}
+    , decltype(_impl_.stream_id_){uint64_t{0u}}
+    , decltype(_impl_.deadline_){uint64_t{0u}}
+    , decltype(_impl_.method_){0}
+  };
+  _impl_.custom_method_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.custom_method_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.reply_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.bulk_reply_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.bulk_reply_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Request::~Request() {
+  // @@protoc_insertion_point(destructor:http.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Request::SharedDtor() {
-  if (custom_method_ != &::google::protobuf::internal::kEmptyString) {
-    delete custom_method_;
-  }
-  if (url_ != &::google::protobuf::internal::kEmptyString) {
-    delete url_;
-  }
-  if (body_ != &::google::protobuf::internal::kEmptyString) {
-    delete body_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.headers_.~RepeatedPtrField();
+  _impl_.custom_method_.Destroy();
+  _impl_.url_.Destroy();
+  _impl_.body_.Destroy();
+  _impl_.reply_to_.Destroy();
+  _impl_.bulk_reply_to_.Destroy();
 }
 
 void Request::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Request::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Request_descriptor_;
-}
-
-const Request& Request::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_http_2eproto();
-  return *default_instance_;
-}
-
-Request* Request::default_instance_ = NULL;
-
-Request* Request::New() const {
-  return new Request;
+  _impl_._cached_size_.Set(size);
 }
 
 void Request::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    version_major_ = 0u;
-    version_minor_ = 0u;
-    stream_id_ = 0u;
-    method_ = 0;
-    if (has_custom_method()) {
-      if (custom_method_ != &::google::protobuf::internal::kEmptyString) {
-        custom_method_->clear();
-      }
+// @@protoc_insertion_point(message_clear_start:http.Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.headers_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.custom_method_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.url_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.body_.ClearNonDefaultToEmpty();
     }
-    if (has_url()) {
-      if (url_ != &::google::protobuf::internal::kEmptyString) {
-        url_->clear();
-      }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.reply_to_.ClearNonDefaultToEmpty();
     }
-    if (has_body()) {
-      if (body_ != &::google::protobuf::internal::kEmptyString) {
-        body_->clear();
-      }
+    if (cached_has_bits & 0x00000010u) {
+      _impl_.bulk_reply_to_.ClearNonDefaultToEmpty();
     }
   }
-  headers_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
+  if (cached_has_bits & 0x000000e0u) {
+    ::memset(&_impl_.version_major_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.stream_id_) -
+        reinterpret_cast<char*>(&_impl_.version_major_)) + sizeof(_impl_.stream_id_));
+  }
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&_impl_.deadline_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.method_) -
+        reinterpret_cast<char*>(&_impl_.deadline_)) + sizeof(_impl_.method_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-bool Request::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
       // required uint32 version_major = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &version_major_)));
-          set_has_version_major();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_version_minor;
-        break;
-      }
-
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_version_major(&has_bits);
+          _impl_.version_major_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 version_minor = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_version_minor:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &version_minor_)));
-          set_has_version_minor();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_method;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_version_minor(&has_bits);
+          _impl_.version_minor_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // optional .http.Request.Method method = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_method:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::http::Request_Method_IsValid(value)) {
-            set_method(static_cast< ::http::Request_Method >(value));
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::http::Request_Method_IsValid(val))) {
+            _internal_set_method(static_cast<::http::Request_Method>(val));
           } else {
-            mutable_unknown_fields()->AddVarint(3, value);
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(3, val, mutable_unknown_fields());
           }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_custom_method;
-        break;
-      }
-
+        } else
+          goto handle_unusual;
+        continue;
       // optional string custom_method = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_custom_method:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_custom_method()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->custom_method().data(), this->custom_method().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_url;
-        break;
-      }
-
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_custom_method();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.Request.custom_method");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // required string url = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_url:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_url()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->url().data(), this->url().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_headers;
-        break;
-      }
-
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_url();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.Request.url");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .http.Header headers = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_headers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_headers()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(50)) goto parse_headers;
-        if (input->ExpectTag(58)) goto parse_body;
-        break;
-      }
-
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_headers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional bytes body = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_body:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_body()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_stream_id;
-        break;
-      }
-
-      // required uint32 stream_id = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_stream_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &stream_id_)));
-          set_has_stream_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 stream_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_stream_id(&has_bits);
+          _impl_.stream_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string reply_to = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_reply_to();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.Request.reply_to");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string bulk_reply_to = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_bulk_reply_to();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.Request.bulk_reply_to");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 deadline = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_deadline(&has_bits);
+          _impl_.deadline_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Request::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
   // required uint32 version_major = 1;
-  if (has_version_major()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->version_major(), output);
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_version_major(), target);
   }
 
   // required uint32 version_minor = 2;
-  if (has_version_minor()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->version_minor(), output);
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_version_minor(), target);
   }
 
   // optional .http.Request.Method method = 3;
-  if (has_method()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      3, this->method(), output);
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_method(), target);
   }
 
   // optional string custom_method = 4;
-  if (has_custom_method()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->custom_method().data(), this->custom_method().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->custom_method(), output);
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_custom_method().data(), static_cast<int>(this->_internal_custom_method().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.Request.custom_method");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_custom_method(), target);
   }
 
   // required string url = 5;
-  if (has_url()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->url().data(), this->url().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      5, this->url(), output);
+  if (cached_has_bits & 0x00000002u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_url().data(), static_cast<int>(this->_internal_url().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.Request.url");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_url(), target);
   }
 
   // repeated .http.Header headers = 6;
-  for (int i = 0; i < this->headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      6, this->headers(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_headers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_headers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional bytes body = 7;
-  if (has_body()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      7, this->body(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteBytesMaybeAliased(
+        7, this->_internal_body(), target);
   }
 
-  // required uint32 stream_id = 8;
-  if (has_stream_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(8, this->stream_id(), output);
+  // required uint64 stream_id = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_stream_id(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  // optional string reply_to = 9;
+  if (cached_has_bits & 0x00000008u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_reply_to().data(), static_cast<int>(this->_internal_reply_to().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.Request.reply_to");
+    target = stream->WriteStringMaybeAliased(
+        9, this->_internal_reply_to(), target);
   }
-}
 
-::google::protobuf::uint8* Request::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint32 version_major = 1;
-  if (has_version_major()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->version_major(), target);
+  // optional string bulk_reply_to = 10;
+  if (cached_has_bits & 0x00000010u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_bulk_reply_to().data(), static_cast<int>(this->_internal_bulk_reply_to().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.Request.bulk_reply_to");
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_bulk_reply_to(), target);
   }
 
-  // required uint32 version_minor = 2;
-  if (has_version_minor()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->version_minor(), target);
+  // optional uint64 deadline = 11;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_deadline(), target);
   }
 
-  // optional .http.Request.Method method = 3;
-  if (has_method()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      3, this->method(), target);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:http.Request)
+  return target;
+}
 
-  // optional string custom_method = 4;
-  if (has_custom_method()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->custom_method().data(), this->custom_method().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->custom_method(), target);
-  }
+size_t Request::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:http.Request)
+  size_t total_size = 0;
 
-  // required string url = 5;
-  if (has_url()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->url().data(), this->url().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->url(), target);
+  if (_internal_has_url()) {
+    // required string url = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_url());
   }
 
-  // repeated .http.Header headers = 6;
-  for (int i = 0; i < this->headers_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        6, this->headers(i), target);
+  if (_internal_has_version_major()) {
+    // required uint32 version_major = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version_major());
   }
 
-  // optional bytes body = 7;
-  if (has_body()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        7, this->body(), target);
+  if (_internal_has_version_minor()) {
+    // required uint32 version_minor = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version_minor());
   }
 
-  // required uint32 stream_id = 8;
-  if (has_stream_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(8, this->stream_id(), target);
+  if (_internal_has_stream_id()) {
+    // required uint64 stream_id = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
+  return total_size;
 }
+size_t Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.Request)
+  size_t total_size = 0;
 
-int Request::ByteSize() const {
-  int total_size = 0;
+  if (((_impl_._has_bits_[0] & 0x000000e2) ^ 0x000000e2) == 0) {  // All required fields are present.
+    // required string url = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_url());
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
     // required uint32 version_major = 1;
-    if (has_version_major()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->version_major());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version_major());
 
     // required uint32 version_minor = 2;
-    if (has_version_minor()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->version_minor());
-    }
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_version_minor());
+
+    // required uint64 stream_id = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .http.Header headers = 6;
+  total_size += 1UL * this->_internal_headers_size();
+  for (const auto& msg : this->_impl_.headers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string custom_method = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_custom_method());
+  }
 
-    // required uint32 stream_id = 8;
-    if (has_stream_id()) {
+  if (cached_has_bits & 0x0000001cu) {
+    // optional bytes body = 7;
+    if (cached_has_bits & 0x00000004u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->stream_id());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_body());
     }
 
-    // optional .http.Request.Method method = 3;
-    if (has_method()) {
+    // optional string reply_to = 9;
+    if (cached_has_bits & 0x00000008u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->method());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_reply_to());
     }
 
-    // optional string custom_method = 4;
-    if (has_custom_method()) {
+    // optional string bulk_reply_to = 10;
+    if (cached_has_bits & 0x00000010u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->custom_method());
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_bulk_reply_to());
     }
 
-    // required string url = 5;
-    if (has_url()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->url());
+  }
+  if (cached_has_bits & 0x00000300u) {
+    // optional uint64 deadline = 11;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_deadline());
     }
 
-    // optional bytes body = 7;
-    if (has_body()) {
+    // optional .http.Request.Method method = 3;
+    if (cached_has_bits & 0x00000200u) {
       total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->body());
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_method());
     }
 
   }
-  // repeated .http.Header headers = 6;
-  total_size += 1 * this->headers_size();
-  for (int i = 0; i < this->headers_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->headers(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Request::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Request* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Request*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
+
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
-void Request::MergeFrom(const Request& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  headers_.MergeFrom(from.headers_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_version_major()) {
-      set_version_major(from.version_major());
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_custom_method(from._internal_custom_method());
     }
-    if (from.has_version_minor()) {
-      set_version_minor(from.version_minor());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_url(from._internal_url());
     }
-    if (from.has_stream_id()) {
-      set_stream_id(from.stream_id());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_body(from._internal_body());
     }
-    if (from.has_method()) {
-      set_method(from.method());
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_reply_to(from._internal_reply_to());
     }
-    if (from.has_custom_method()) {
-      set_custom_method(from.custom_method());
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_set_bulk_reply_to(from._internal_bulk_reply_to());
     }
-    if (from.has_url()) {
-      set_url(from.url());
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.version_major_ = from._impl_.version_major_;
     }
-    if (from.has_body()) {
-      set_body(from.body());
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.version_minor_ = from._impl_.version_minor_;
     }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.stream_id_ = from._impl_.stream_id_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Request::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.deadline_ = from._impl_.deadline_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.method_ = from._impl_.method_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
 void Request::CopyFrom(const Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.Request)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
 bool Request::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000027) != 0x00000027) return false;
-
-  for (int i = 0; i < headers_size(); i++) {
-    if (!this->headers(i).IsInitialized()) return false;
-  }
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.headers_))
+    return false;
   return true;
 }
 
-void Request::Swap(Request* other) {
-  if (other != this) {
-    std::swap(version_major_, other->version_major_);
-    std::swap(version_minor_, other->version_minor_);
-    std::swap(stream_id_, other->stream_id_);
-    std::swap(method_, other->method_);
-    std::swap(custom_method_, other->custom_method_);
-    std::swap(url_, other->url_);
-    headers_.Swap(&other->headers_);
-    std::swap(body_, other->body_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Request::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Request_descriptor_;
-  metadata.reflection = Request_reflection_;
-  return metadata;
+void Request::InternalSwap(Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.headers_.InternalSwap(&other->_impl_.headers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.custom_method_, lhs_arena,
+      &other->_impl_.custom_method_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.url_, lhs_arena,
+      &other->_impl_.url_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_to_, lhs_arena,
+      &other->_impl_.reply_to_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.bulk_reply_to_, lhs_arena,
+      &other->_impl_.bulk_reply_to_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.method_)
+      + sizeof(Request::_impl_.method_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.version_major_)>(
+          reinterpret_cast<char*>(&_impl_.version_major_),
+          reinterpret_cast<char*>(&other->_impl_.version_major_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[1]);
 }
 
-
 // ===================================================================
 
-#ifndef _MSC_VER
-const int Response::kStreamIdFieldNumber;
-const int Response::kStatusFieldNumber;
-const int Response::kHeadersFieldNumber;
-const int Response::kBodyFieldNumber;
-#endif  // !_MSC_VER
-
-Response::Response()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
+class Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Response>()._impl_._has_bits_);
+  static void set_has_stream_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_status(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_streamed(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000006) ^ 0x00000006) != 0;
+  }
+};
 
-void Response::InitAsDefaultInstance() {
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.Response)
 }
-
 Response::Response(const Response& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Response::SharedCtor() {
-  _cached_size_ = 0;
-  stream_id_ = 0u;
-  status_ = 0u;
-  body_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.headers_){from._impl_.headers_}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.stream_id_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.streamed_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_body()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.stream_id_, &from._impl_.stream_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.streamed_) -
+    reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.streamed_));
+  // @@protoc_insertion_point(copy_constructor:http.Response)
+}
+
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.headers_){arena}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.stream_id_){uint64_t{0u}}
+    , decltype(_impl_.status_){0u}
+    , decltype(_impl_.streamed_){false}
+  };
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Response::~Response() {
+  // @@protoc_insertion_point(destructor:http.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
 }
 
-void Response::SharedDtor() {
-  if (body_ != &::google::protobuf::internal::kEmptyString) {
-    delete body_;
-  }
-  if (this != default_instance_) {
-  }
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.headers_.~RepeatedPtrField();
+  _impl_.body_.Destroy();
 }
 
 void Response::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Response::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Response_descriptor_;
-}
-
-const Response& Response::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_http_2eproto();
-  return *default_instance_;
-}
-
-Response* Response::default_instance_ = NULL;
-
-Response* Response::New() const {
-  return new Response;
+  _impl_._cached_size_.Set(size);
 }
 
 void Response::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    stream_id_ = 0u;
-    status_ = 0u;
-    if (has_body()) {
-      if (body_ != &::google::protobuf::internal::kEmptyString) {
-        body_->clear();
-      }
-    }
-  }
-  headers_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Response::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint32 stream_id = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &stream_id_)));
-          set_has_stream_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(16)) goto parse_status;
-        break;
-      }
-
+// @@protoc_insertion_point(message_clear_start:http.Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.headers_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.body_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000000eu) {
+    ::memset(&_impl_.stream_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.streamed_) -
+        reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.streamed_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 stream_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_stream_id(&has_bits);
+          _impl_.stream_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // required uint32 status = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_status:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &status_)));
-          set_has_status();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_headers;
-        break;
-      }
-
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_status(&has_bits);
+          _impl_.status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       // repeated .http.Header headers = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_headers:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
-                input, add_headers()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(26)) goto parse_headers;
-        if (input->ExpectTag(34)) goto parse_body;
-        break;
-      }
-
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_headers(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       // optional bytes body = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_body:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadBytes(
-                input, this->mutable_body()));
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool streamed = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_streamed(&has_bits);
+          _impl_.streamed_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
-  }
-  return true;
-#undef DO_
-}
-
-void Response::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required uint32 stream_id = 1;
-  if (has_stream_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->stream_id(), output);
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 stream_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_stream_id(), target);
   }
 
   // required uint32 status = 2;
-  if (has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(2, this->status(), output);
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_status(), target);
   }
 
   // repeated .http.Header headers = 3;
-  for (int i = 0; i < this->headers_size(); i++) {
-    ::google::protobuf::internal::WireFormatLite::WriteMessageMaybeToArray(
-      3, this->headers(i), output);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_headers_size()); i < n; i++) {
+    const auto& repfield = this->_internal_headers(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // optional bytes body = 4;
-  if (has_body()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBytes(
-      4, this->body(), output);
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_body(), target);
+  }
+
+  // optional bool streamed = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_streamed(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
+  // @@protoc_insertion_point(serialize_to_array_end:http.Response)
+  return target;
 }
 
-::google::protobuf::uint8* Response::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint32 stream_id = 1;
-  if (has_stream_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->stream_id(), target);
+size_t Response::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:http.Response)
+  size_t total_size = 0;
+
+  if (_internal_has_stream_id()) {
+    // required uint64 stream_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
   }
 
-  // required uint32 status = 2;
-  if (has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(2, this->status(), target);
+  if (_internal_has_status()) {
+    // required uint32 status = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_status());
+  }
+
+  return total_size;
+}
+size_t Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.Response)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000006) ^ 0x00000006) == 0) {  // All required fields are present.
+    // required uint64 stream_id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
+
+    // required uint32 status = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_status());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
   // repeated .http.Header headers = 3;
-  for (int i = 0; i < this->headers_size(); i++) {
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteMessageNoVirtualToArray(
-        3, this->headers(i), target);
+  total_size += 1UL * this->_internal_headers_size();
+  for (const auto& msg : this->_impl_.headers_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // optional bytes body = 4;
-  if (has_body()) {
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteBytesToArray(
-        4, this->body(), target);
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_body());
   }
 
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
+  // optional bool streamed = 5;
+  if (cached_has_bits & 0x00000008u) {
+    total_size += 1 + 1;
   }
-  return target;
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-int Response::ByteSize() const {
-  int total_size = 0;
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
 
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint32 stream_id = 1;
-    if (has_stream_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->stream_id());
-    }
 
-    // required uint32 status = 2;
-    if (has_status()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->status());
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.headers_.MergeFrom(from._impl_.headers_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_body(from._internal_body());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.stream_id_ = from._impl_.stream_id_;
     }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.status_ = from._impl_.status_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.streamed_ = from._impl_.streamed_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
-    // optional bytes body = 4;
-    if (has_body()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::BytesSize(
-          this->body());
+void Response::CopyFrom(const Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.headers_))
+    return false;
+  return true;
+}
+
+void Response::InternalSwap(Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.headers_.InternalSwap(&other->_impl_.headers_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.streamed_)
+      + sizeof(Response::_impl_.streamed_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.stream_id_)>(
+          reinterpret_cast<char*>(&_impl_.stream_id_),
+          reinterpret_cast<char*>(&other->_impl_.stream_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[2]);
+}
+
+// ===================================================================
+
+class ResponseChunk::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResponseChunk>()._impl_._has_bits_);
+  static void set_has_stream_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+ResponseChunk::ResponseChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.ResponseChunk)
+}
+ResponseChunk::ResponseChunk(const ResponseChunk& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResponseChunk* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.stream_id_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_body()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.stream_id_, &from._impl_.stream_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:http.ResponseChunk)
+}
+
+inline void ResponseChunk::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.stream_id_){uint64_t{0u}}
+    , decltype(_impl_.end_){false}
+  };
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResponseChunk::~ResponseChunk() {
+  // @@protoc_insertion_point(destructor:http.ResponseChunk)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResponseChunk::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.body_.Destroy();
+}
+
+void ResponseChunk::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResponseChunk::Clear() {
+// @@protoc_insertion_point(message_clear_start:http.ResponseChunk)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.body_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.stream_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResponseChunk::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 stream_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_stream_id(&has_bits);
+          _impl_.stream_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes body = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool end = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
     }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResponseChunk::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.ResponseChunk)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 stream_id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_stream_id(), target);
+  }
 
+  // optional bytes body = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_body(), target);
   }
-  // repeated .http.Header headers = 3;
-  total_size += 1 * this->headers_size();
-  for (int i = 0; i < this->headers_size(); i++) {
-    total_size +=
-      ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
-        this->headers(i));
+
+  // optional bool end = 5;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_end(), target);
   }
 
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
+  // @@protoc_insertion_point(serialize_to_array_end:http.ResponseChunk)
+  return target;
 }
 
-void Response::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Response* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Response*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
+size_t ResponseChunk::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.ResponseChunk)
+  size_t total_size = 0;
+
+  // required uint64 stream_id = 1;
+  if (_internal_has_stream_id()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes body = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_body());
+  }
+
+  // optional bool end = 5;
+  if (cached_has_bits & 0x00000004u) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-void Response::MergeFrom(const Response& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  headers_.MergeFrom(from.headers_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_stream_id()) {
-      set_stream_id(from.stream_id());
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResponseChunk::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResponseChunk::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResponseChunk::GetClassData() const { return &_class_data_; }
+
+
+void ResponseChunk::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResponseChunk*>(&to_msg);
+  auto& from = static_cast<const ResponseChunk&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.ResponseChunk)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_body(from._internal_body());
     }
-    if (from.has_status()) {
-      set_status(from.status());
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.stream_id_ = from._impl_.stream_id_;
     }
-    if (from.has_body()) {
-      set_body(from.body());
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.end_ = from._impl_.end_;
     }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Response::CopyFrom(const ::google::protobuf::Message& from) {
+void ResponseChunk::CopyFrom(const ResponseChunk& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.ResponseChunk)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Response::CopyFrom(const Response& from) {
+bool ResponseChunk::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ResponseChunk::InternalSwap(ResponseChunk* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResponseChunk, _impl_.end_)
+      + sizeof(ResponseChunk::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(ResponseChunk, _impl_.stream_id_)>(
+          reinterpret_cast<char*>(&_impl_.stream_id_),
+          reinterpret_cast<char*>(&other->_impl_.stream_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResponseChunk::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[3]);
+}
+
+// ===================================================================
+
+class RequestBatch::_Internal {
+ public:
+};
+
+RequestBatch::RequestBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.RequestBatch)
+}
+RequestBatch::RequestBatch(const RequestBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RequestBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){from._impl_.requests_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:http.RequestBatch)
+}
+
+inline void RequestBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.requests_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RequestBatch::~RequestBatch() {
+  // @@protoc_insertion_point(destructor:http.RequestBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RequestBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.requests_.~RepeatedPtrField();
+}
+
+void RequestBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RequestBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:http.RequestBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.requests_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RequestBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes requests = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_requests();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RequestBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.RequestBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes requests = 1;
+  for (int i = 0, n = this->_internal_requests_size(); i < n; i++) {
+    const auto& s = this->_internal_requests(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:http.RequestBatch)
+  return target;
+}
+
+size_t RequestBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.RequestBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated bytes requests = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.requests_.size());
+  for (int i = 0, n = _impl_.requests_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.requests_.Get(i));
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RequestBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RequestBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RequestBatch::GetClassData() const { return &_class_data_; }
+
+
+void RequestBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RequestBatch*>(&to_msg);
+  auto& from = static_cast<const RequestBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.RequestBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.requests_.MergeFrom(from._impl_.requests_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RequestBatch::CopyFrom(const RequestBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.RequestBatch)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Response::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000003) != 0x00000003) return false;
+bool RequestBatch::IsInitialized() const {
+  return true;
+}
+
+void RequestBatch::InternalSwap(RequestBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.requests_.InternalSwap(&other->_impl_.requests_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RequestBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[4]);
+}
+
+// ===================================================================
+
+class ResponseBatch::_Internal {
+ public:
+};
+
+ResponseBatch::ResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.ResponseBatch)
+}
+ResponseBatch::ResponseBatch(const ResponseBatch& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResponseBatch* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){from._impl_.responses_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:http.ResponseBatch)
+}
+
+inline void ResponseBatch::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.responses_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ResponseBatch::~ResponseBatch() {
+  // @@protoc_insertion_point(destructor:http.ResponseBatch)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResponseBatch::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.responses_.~RepeatedPtrField();
+}
+
+void ResponseBatch::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResponseBatch::Clear() {
+// @@protoc_insertion_point(message_clear_start:http.ResponseBatch)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.responses_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResponseBatch::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated bytes responses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_responses();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResponseBatch::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.ResponseBatch)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated bytes responses = 1;
+  for (int i = 0, n = this->_internal_responses_size(); i < n; i++) {
+    const auto& s = this->_internal_responses(i);
+    target = stream->WriteBytes(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:http.ResponseBatch)
+  return target;
+}
+
+size_t ResponseBatch::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.ResponseBatch)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  for (int i = 0; i < headers_size(); i++) {
-    if (!this->headers(i).IsInitialized()) return false;
+  // repeated bytes responses = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.responses_.size());
+  for (int i = 0, n = _impl_.responses_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      _impl_.responses_.Get(i));
   }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResponseBatch::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResponseBatch::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResponseBatch::GetClassData() const { return &_class_data_; }
+
+
+void ResponseBatch::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResponseBatch*>(&to_msg);
+  auto& from = static_cast<const ResponseBatch&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.ResponseBatch)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.responses_.MergeFrom(from._impl_.responses_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResponseBatch::CopyFrom(const ResponseBatch& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.ResponseBatch)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResponseBatch::IsInitialized() const {
   return true;
 }
 
-void Response::Swap(Response* other) {
-  if (other != this) {
-    std::swap(stream_id_, other->stream_id_);
-    std::swap(status_, other->status_);
-    headers_.Swap(&other->headers_);
-    std::swap(body_, other->body_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
+void ResponseBatch::InternalSwap(ResponseBatch* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.responses_.InternalSwap(&other->_impl_.responses_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResponseBatch::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[5]);
+}
+
+// ===================================================================
+
+class Cancel::_Internal {
+ public:
+};
+
+Cancel::Cancel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.Cancel)
+}
+Cancel::Cancel(const Cancel& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Cancel* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stream_ids_){from._impl_.stream_ids_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:http.Cancel)
+}
+
+inline void Cancel::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stream_ids_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Cancel::~Cancel() {
+  // @@protoc_insertion_point(destructor:http.Cancel)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
+  SharedDtor();
 }
 
-::google::protobuf::Metadata Response::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Response_descriptor_;
-  metadata.reflection = Response_reflection_;
-  return metadata;
+inline void Cancel::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stream_ids_.~RepeatedField();
+}
+
+void Cancel::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Cancel::Clear() {
+// @@protoc_insertion_point(message_clear_start:http.Cancel)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stream_ids_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Cancel::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 stream_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_stream_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_stream_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Cancel::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.Cancel)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 stream_ids = 1;
+  for (int i = 0, n = this->_internal_stream_ids_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_stream_ids(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:http.Cancel)
+  return target;
 }
 
+size_t Cancel::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.Cancel)
+  size_t total_size = 0;
 
-// @@protoc_insertion_point(namespace_scope)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
+  // repeated uint64 stream_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.stream_ids_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_stream_ids_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Cancel::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Cancel::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Cancel::GetClassData() const { return &_class_data_; }
+
+
+void Cancel::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Cancel*>(&to_msg);
+  auto& from = static_cast<const Cancel&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.Cancel)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stream_ids_.MergeFrom(from._impl_.stream_ids_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Cancel::CopyFrom(const Cancel& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.Cancel)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Cancel::IsInitialized() const {
+  return true;
+}
+
+void Cancel::InternalSwap(Cancel* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stream_ids_.InternalSwap(&other->_impl_.stream_ids_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Cancel::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[6]);
+}
+
+// ===================================================================
+
+class Flow::_Internal {
+ public:
+};
+
+Flow::Flow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.Flow)
+}
+Flow::Flow(const Flow& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Flow* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paused_){from._impl_.paused_}
+    , decltype(_impl_.resumed_){from._impl_.resumed_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:http.Flow)
+}
+
+inline void Flow::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.paused_){arena}
+    , decltype(_impl_.resumed_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Flow::~Flow() {
+  // @@protoc_insertion_point(destructor:http.Flow)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Flow::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.paused_.~RepeatedField();
+  _impl_.resumed_.~RepeatedField();
+}
+
+void Flow::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Flow::Clear() {
+// @@protoc_insertion_point(message_clear_start:http.Flow)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.paused_.Clear();
+  _impl_.resumed_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Flow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint64 paused = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_paused(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<8>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 10) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_paused(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint64 resumed = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_resumed(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<16>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 18) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt64Parser(_internal_mutable_resumed(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Flow::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.Flow)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint64 paused = 1;
+  for (int i = 0, n = this->_internal_paused_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_paused(i), target);
+  }
+
+  // repeated uint64 resumed = 2;
+  for (int i = 0, n = this->_internal_resumed_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_resumed(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:http.Flow)
+  return target;
+}
+
+size_t Flow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.Flow)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint64 paused = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.paused_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_paused_size());
+    total_size += data_size;
+  }
+
+  // repeated uint64 resumed = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt64Size(this->_impl_.resumed_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_resumed_size());
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Flow::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Flow::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Flow::GetClassData() const { return &_class_data_; }
+
+
+void Flow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Flow*>(&to_msg);
+  auto& from = static_cast<const Flow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.Flow)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.paused_.MergeFrom(from._impl_.paused_);
+  _this->_impl_.resumed_.MergeFrom(from._impl_.resumed_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Flow::CopyFrom(const Flow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.Flow)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Flow::IsInitialized() const {
+  return true;
+}
+
+void Flow::InternalSwap(Flow* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.paused_.InternalSwap(&other->_impl_.paused_);
+  _impl_.resumed_.InternalSwap(&other->_impl_.resumed_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Flow::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[7]);
+}
+
+// ===================================================================
+
+class SocketMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SocketMessage>()._impl_._has_bits_);
+  static void set_has_stream_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_reply_to(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_binary(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_body(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_end(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::http::Request& request(const SocketMessage* msg);
+  static void set_has_request(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000008) ^ 0x00000008) != 0;
+  }
+};
+
+const ::http::Request&
+SocketMessage::_Internal::request(const SocketMessage* msg) {
+  return *msg->_impl_.request_;
+}
+SocketMessage::SocketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:http.SocketMessage)
+}
+SocketMessage::SocketMessage(const SocketMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SocketMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_to_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.stream_id_){}
+    , decltype(_impl_.binary_){}
+    , decltype(_impl_.end_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.reply_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_reply_to()) {
+    _this->_impl_.reply_to_.Set(from._internal_reply_to(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_body()) {
+    _this->_impl_.body_.Set(from._internal_body(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_request()) {
+    _this->_impl_.request_ = new ::http::Request(*from._impl_.request_);
+  }
+  ::memcpy(&_impl_.stream_id_, &from._impl_.stream_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_) -
+    reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.end_));
+  // @@protoc_insertion_point(copy_constructor:http.SocketMessage)
+}
+
+inline void SocketMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.reply_to_){}
+    , decltype(_impl_.body_){}
+    , decltype(_impl_.request_){nullptr}
+    , decltype(_impl_.stream_id_){uint64_t{0u}}
+    , decltype(_impl_.binary_){false}
+    , decltype(_impl_.end_){false}
+  };
+  _impl_.reply_to_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.body_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.body_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SocketMessage::~SocketMessage() {
+  // @@protoc_insertion_point(destructor:http.SocketMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SocketMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.reply_to_.Destroy();
+  _impl_.body_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.request_;
+}
+
+void SocketMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SocketMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:http.SocketMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.reply_to_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.body_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.request_ != nullptr);
+      _impl_.request_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000038u) {
+    ::memset(&_impl_.stream_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.end_) -
+        reinterpret_cast<char*>(&_impl_.stream_id_)) + sizeof(_impl_.end_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SocketMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 stream_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_stream_id(&has_bits);
+          _impl_.stream_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string reply_to = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_reply_to();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          #ifndef NDEBUG
+          ::_pbi::VerifyUTF8(str, "http.SocketMessage.reply_to");
+          #endif  // !NDEBUG
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool binary = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_binary(&has_bits);
+          _impl_.binary_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes body = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_body();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool end = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_end(&has_bits);
+          _impl_.end_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .http.Request request = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_request(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SocketMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:http.SocketMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 stream_id = 1;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_stream_id(), target);
+  }
+
+  // optional string reply_to = 2;
+  if (cached_has_bits & 0x00000001u) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::VerifyUTF8StringNamedField(
+      this->_internal_reply_to().data(), static_cast<int>(this->_internal_reply_to().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::SERIALIZE,
+      "http.SocketMessage.reply_to");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_reply_to(), target);
+  }
+
+  // optional bool binary = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_binary(), target);
+  }
+
+  // optional bytes body = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_body(), target);
+  }
+
+  // optional bool end = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_end(), target);
+  }
+
+  // optional .http.Request request = 6;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::request(this),
+        _Internal::request(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:http.SocketMessage)
+  return target;
+}
+
+size_t SocketMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:http.SocketMessage)
+  size_t total_size = 0;
+
+  // required uint64 stream_id = 1;
+  if (_internal_has_stream_id()) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_stream_id());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string reply_to = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_reply_to());
+    }
+
+    // optional bytes body = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_body());
+    }
+
+    // optional .http.Request request = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.request_);
+    }
+
+  }
+  if (cached_has_bits & 0x00000030u) {
+    // optional bool binary = 3;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool end = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SocketMessage::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SocketMessage::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SocketMessage::GetClassData() const { return &_class_data_; }
+
+
+void SocketMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SocketMessage*>(&to_msg);
+  auto& from = static_cast<const SocketMessage&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:http.SocketMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_reply_to(from._internal_reply_to());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_body(from._internal_body());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_request()->::http::Request::MergeFrom(
+          from._internal_request());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.stream_id_ = from._impl_.stream_id_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.binary_ = from._impl_.binary_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.end_ = from._impl_.end_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SocketMessage::CopyFrom(const SocketMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:http.SocketMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SocketMessage::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_request()) {
+    if (!_impl_.request_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void SocketMessage::InternalSwap(SocketMessage* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.reply_to_, lhs_arena,
+      &other->_impl_.reply_to_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.body_, lhs_arena,
+      &other->_impl_.body_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SocketMessage, _impl_.end_)
+      + sizeof(SocketMessage::_impl_.end_)
+      - PROTOBUF_FIELD_OFFSET(SocketMessage, _impl_.request_)>(
+          reinterpret_cast<char*>(&_impl_.request_),
+          reinterpret_cast<char*>(&other->_impl_.request_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SocketMessage::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_http_2eproto_getter, &descriptor_table_http_2eproto_once,
+      file_level_metadata_http_2eproto[8]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
 }  // namespace http
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::http::Header*
+Arena::CreateMaybeMessage< ::http::Header >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::Header >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::Request*
+Arena::CreateMaybeMessage< ::http::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::Response*
+Arena::CreateMaybeMessage< ::http::Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::ResponseChunk*
+Arena::CreateMaybeMessage< ::http::ResponseChunk >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::ResponseChunk >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::RequestBatch*
+Arena::CreateMaybeMessage< ::http::RequestBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::RequestBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::ResponseBatch*
+Arena::CreateMaybeMessage< ::http::ResponseBatch >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::ResponseBatch >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::Cancel*
+Arena::CreateMaybeMessage< ::http::Cancel >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::Cancel >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::Flow*
+Arena::CreateMaybeMessage< ::http::Flow >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::Flow >(arena);
+}
+template<> PROTOBUF_NOINLINE ::http::SocketMessage*
+Arena::CreateMaybeMessage< ::http::SocketMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::http::SocketMessage >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -1,64 +1,176 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: http.proto
 
-#ifndef PROTOBUF_http_2eproto__INCLUDED
-#define PROTOBUF_http_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_http_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_http_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_http_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_http_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_http_2eproto;
 namespace http {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_http_2eproto();
-void protobuf_AssignDesc_http_2eproto();
-void protobuf_ShutdownFile_http_2eproto();
-
+class Cancel;
+struct CancelDefaultTypeInternal;
+extern CancelDefaultTypeInternal _Cancel_default_instance_;
+class Flow;
+struct FlowDefaultTypeInternal;
+extern FlowDefaultTypeInternal _Flow_default_instance_;
 class Header;
+struct HeaderDefaultTypeInternal;
+extern HeaderDefaultTypeInternal _Header_default_instance_;
 class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class RequestBatch;
+struct RequestBatchDefaultTypeInternal;
+extern RequestBatchDefaultTypeInternal _RequestBatch_default_instance_;
 class Response;
+struct ResponseDefaultTypeInternal;
+extern ResponseDefaultTypeInternal _Response_default_instance_;
+class ResponseBatch;
+struct ResponseBatchDefaultTypeInternal;
+extern ResponseBatchDefaultTypeInternal _ResponseBatch_default_instance_;
+class ResponseChunk;
+struct ResponseChunkDefaultTypeInternal;
+extern ResponseChunkDefaultTypeInternal _ResponseChunk_default_instance_;
+class SocketMessage;
+struct SocketMessageDefaultTypeInternal;
+extern SocketMessageDefaultTypeInternal _SocketMessage_default_instance_;
+}  // namespace http
+PROTOBUF_NAMESPACE_OPEN
+template<> ::http::Cancel* Arena::CreateMaybeMessage<::http::Cancel>(Arena*);
+template<> ::http::Flow* Arena::CreateMaybeMessage<::http::Flow>(Arena*);
+template<> ::http::Header* Arena::CreateMaybeMessage<::http::Header>(Arena*);
+template<> ::http::Request* Arena::CreateMaybeMessage<::http::Request>(Arena*);
+template<> ::http::RequestBatch* Arena::CreateMaybeMessage<::http::RequestBatch>(Arena*);
+template<> ::http::Response* Arena::CreateMaybeMessage<::http::Response>(Arena*);
+template<> ::http::ResponseBatch* Arena::CreateMaybeMessage<::http::ResponseBatch>(Arena*);
+template<> ::http::ResponseChunk* Arena::CreateMaybeMessage<::http::ResponseChunk>(Arena*);
+template<> ::http::SocketMessage* Arena::CreateMaybeMessage<::http::SocketMessage>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace http {
 
-enum Header_Key {
+enum Header_Key : int {
   Header_Key_HOST = 0,
   Header_Key_ACCEPT = 1,
-  Header_Key_USER_AGENT = 2
+  Header_Key_USER_AGENT = 2,
+  Header_Key_ACCEPT_CHARSET = 3,
+  Header_Key_ACCEPT_ENCODING = 4,
+  Header_Key_ACCEPT_LANGUAGE = 5,
+  Header_Key_ACCEPT_DATETIME = 6,
+  Header_Key_ACCESS_CONTROL_REQUEST_METHOD = 7,
+  Header_Key_ACCESS_CONTROL_REQUEST_HEADERS = 8,
+  Header_Key_AUTHORIZATION = 9,
+  Header_Key_CACHE_CONTROL = 10,
+  Header_Key_CONNECTION = 11,
+  Header_Key_CONTENT_ENCODING = 12,
+  Header_Key_CONTENT_LENGTH = 13,
+  Header_Key_CONTENT_MD5 = 14,
+  Header_Key_CONTENT_TYPE = 15,
+  Header_Key_COOKIE = 16,
+  Header_Key_DATE = 17,
+  Header_Key_DNT = 18,
+  Header_Key_EXPECT = 19,
+  Header_Key_FORWARDED = 20,
+  Header_Key_FROM = 21,
+  Header_Key_IF_MATCH = 22,
+  Header_Key_IF_MODIFIED_SINCE = 23,
+  Header_Key_IF_NONE_MATCH = 24,
+  Header_Key_IF_RANGE = 25,
+  Header_Key_IF_UNMODIFIED_SINCE = 26,
+  Header_Key_KEEP_ALIVE = 27,
+  Header_Key_MAX_FORWARDS = 28,
+  Header_Key_ORIGIN = 29,
+  Header_Key_PRAGMA = 30,
+  Header_Key_PRIORITY = 31,
+  Header_Key_PROXY_AUTHORIZATION = 32,
+  Header_Key_PROXY_CONNECTION = 33,
+  Header_Key_RANGE = 34,
+  Header_Key_REFERER = 35,
+  Header_Key_TE = 36,
+  Header_Key_TRAILER = 37,
+  Header_Key_TRANSFER_ENCODING = 38,
+  Header_Key_UPGRADE = 39,
+  Header_Key_UPGRADE_INSECURE_REQUESTS = 40,
+  Header_Key_VIA = 41,
+  Header_Key_WARNING = 42,
+  Header_Key_SEC_FETCH_DEST = 43,
+  Header_Key_SEC_FETCH_MODE = 44,
+  Header_Key_SEC_FETCH_SITE = 45,
+  Header_Key_SEC_FETCH_USER = 46,
+  Header_Key_SEC_WEBSOCKET_KEY = 47,
+  Header_Key_SEC_WEBSOCKET_VERSION = 48,
+  Header_Key_SEC_WEBSOCKET_PROTOCOL = 49,
+  Header_Key_SEC_WEBSOCKET_EXTENSIONS = 50,
+  Header_Key_X_REQUESTED_WITH = 51,
+  Header_Key_X_FORWARDED_FOR = 52,
+  Header_Key_X_FORWARDED_HOST = 53,
+  Header_Key_X_FORWARDED_PROTO = 54,
+  Header_Key_X_REAL_IP = 55,
+  Header_Key_X_REQUEST_ID = 56,
+  Header_Key_X_CORRELATION_ID = 57,
+  Header_Key_X_CSRF_TOKEN = 58,
+  Header_Key_X_HTTP_METHOD_OVERRIDE = 59,
+  Header_Key_X_REQUEST_TIMEOUT = 60,
+  Header_Key_X_TRAFFIC_CLASS = 61
 };
 bool Header_Key_IsValid(int value);
-const Header_Key Header_Key_Key_MIN = Header_Key_HOST;
-const Header_Key Header_Key_Key_MAX = Header_Key_USER_AGENT;
-const int Header_Key_Key_ARRAYSIZE = Header_Key_Key_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Header_Key_descriptor();
-inline const ::std::string& Header_Key_Name(Header_Key value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Header_Key_descriptor(), value);
+constexpr Header_Key Header_Key_Key_MIN = Header_Key_HOST;
+constexpr Header_Key Header_Key_Key_MAX = Header_Key_X_TRAFFIC_CLASS;
+constexpr int Header_Key_Key_ARRAYSIZE = Header_Key_Key_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Header_Key_descriptor();
+template<typename T>
+inline const std::string& Header_Key_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Header_Key>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Header_Key_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Header_Key_descriptor(), enum_t_value);
 }
 inline bool Header_Key_Parse(
-    const ::std::string& name, Header_Key* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Header_Key>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Header_Key* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Header_Key>(
     Header_Key_descriptor(), name, value);
 }
-enum Request_Method {
+enum Request_Method : int {
   Request_Method_DELETE = 0,
   Request_Method_GET = 1,
   Request_Method_HEAD = 2,
@@ -66,1137 +178,3817 @@ enum Request_Method {
   Request_Method_PUT = 4
 };
 bool Request_Method_IsValid(int value);
-const Request_Method Request_Method_Method_MIN = Request_Method_DELETE;
-const Request_Method Request_Method_Method_MAX = Request_Method_PUT;
-const int Request_Method_Method_ARRAYSIZE = Request_Method_Method_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* Request_Method_descriptor();
-inline const ::std::string& Request_Method_Name(Request_Method value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    Request_Method_descriptor(), value);
+constexpr Request_Method Request_Method_Method_MIN = Request_Method_DELETE;
+constexpr Request_Method Request_Method_Method_MAX = Request_Method_PUT;
+constexpr int Request_Method_Method_ARRAYSIZE = Request_Method_Method_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Request_Method_descriptor();
+template<typename T>
+inline const std::string& Request_Method_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Request_Method>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Request_Method_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Request_Method_descriptor(), enum_t_value);
 }
 inline bool Request_Method_Parse(
-    const ::std::string& name, Request_Method* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<Request_Method>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Request_Method* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Request_Method>(
     Request_Method_descriptor(), name, value);
 }
 // ===================================================================
 
-class Header : public ::google::protobuf::Message {
+class Header final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.Header) */ {
  public:
-  Header();
-  virtual ~Header();
+  inline Header() : Header(nullptr) {}
+  ~Header() override;
+  explicit PROTOBUF_CONSTEXPR Header(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Header(const Header& from);
+  Header(Header&& from) noexcept
+    : Header() {
+    *this = ::std::move(from);
+  }
 
   inline Header& operator=(const Header& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Header& operator=(Header&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Header& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Header& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Header* internal_default_instance() {
+    return reinterpret_cast<const Header*>(
+               &_Header_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Header* other);
+  friend void swap(Header& a, Header& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Header* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Header* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Header* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Header* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Header>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Header& from);
-  void MergeFrom(const Header& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Header& from) {
+    Header::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Header* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.Header";
+  }
+  protected:
+  explicit Header(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef Header_Key Key;
-  static const Key HOST = Header_Key_HOST;
-  static const Key ACCEPT = Header_Key_ACCEPT;
-  static const Key USER_AGENT = Header_Key_USER_AGENT;
+  static constexpr Key HOST =
+    Header_Key_HOST;
+  static constexpr Key ACCEPT =
+    Header_Key_ACCEPT;
+  static constexpr Key USER_AGENT =
+    Header_Key_USER_AGENT;
+  static constexpr Key ACCEPT_CHARSET =
+    Header_Key_ACCEPT_CHARSET;
+  static constexpr Key ACCEPT_ENCODING =
+    Header_Key_ACCEPT_ENCODING;
+  static constexpr Key ACCEPT_LANGUAGE =
+    Header_Key_ACCEPT_LANGUAGE;
+  static constexpr Key ACCEPT_DATETIME =
+    Header_Key_ACCEPT_DATETIME;
+  static constexpr Key ACCESS_CONTROL_REQUEST_METHOD =
+    Header_Key_ACCESS_CONTROL_REQUEST_METHOD;
+  static constexpr Key ACCESS_CONTROL_REQUEST_HEADERS =
+    Header_Key_ACCESS_CONTROL_REQUEST_HEADERS;
+  static constexpr Key AUTHORIZATION =
+    Header_Key_AUTHORIZATION;
+  static constexpr Key CACHE_CONTROL =
+    Header_Key_CACHE_CONTROL;
+  static constexpr Key CONNECTION =
+    Header_Key_CONNECTION;
+  static constexpr Key CONTENT_ENCODING =
+    Header_Key_CONTENT_ENCODING;
+  static constexpr Key CONTENT_LENGTH =
+    Header_Key_CONTENT_LENGTH;
+  static constexpr Key CONTENT_MD5 =
+    Header_Key_CONTENT_MD5;
+  static constexpr Key CONTENT_TYPE =
+    Header_Key_CONTENT_TYPE;
+  static constexpr Key COOKIE =
+    Header_Key_COOKIE;
+  static constexpr Key DATE =
+    Header_Key_DATE;
+  static constexpr Key DNT =
+    Header_Key_DNT;
+  static constexpr Key EXPECT =
+    Header_Key_EXPECT;
+  static constexpr Key FORWARDED =
+    Header_Key_FORWARDED;
+  static constexpr Key FROM =
+    Header_Key_FROM;
+  static constexpr Key IF_MATCH =
+    Header_Key_IF_MATCH;
+  static constexpr Key IF_MODIFIED_SINCE =
+    Header_Key_IF_MODIFIED_SINCE;
+  static constexpr Key IF_NONE_MATCH =
+    Header_Key_IF_NONE_MATCH;
+  static constexpr Key IF_RANGE =
+    Header_Key_IF_RANGE;
+  static constexpr Key IF_UNMODIFIED_SINCE =
+    Header_Key_IF_UNMODIFIED_SINCE;
+  static constexpr Key KEEP_ALIVE =
+    Header_Key_KEEP_ALIVE;
+  static constexpr Key MAX_FORWARDS =
+    Header_Key_MAX_FORWARDS;
+  static constexpr Key ORIGIN =
+    Header_Key_ORIGIN;
+  static constexpr Key PRAGMA =
+    Header_Key_PRAGMA;
+  static constexpr Key PRIORITY =
+    Header_Key_PRIORITY;
+  static constexpr Key PROXY_AUTHORIZATION =
+    Header_Key_PROXY_AUTHORIZATION;
+  static constexpr Key PROXY_CONNECTION =
+    Header_Key_PROXY_CONNECTION;
+  static constexpr Key RANGE =
+    Header_Key_RANGE;
+  static constexpr Key REFERER =
+    Header_Key_REFERER;
+  static constexpr Key TE =
+    Header_Key_TE;
+  static constexpr Key TRAILER =
+    Header_Key_TRAILER;
+  static constexpr Key TRANSFER_ENCODING =
+    Header_Key_TRANSFER_ENCODING;
+  static constexpr Key UPGRADE =
+    Header_Key_UPGRADE;
+  static constexpr Key UPGRADE_INSECURE_REQUESTS =
+    Header_Key_UPGRADE_INSECURE_REQUESTS;
+  static constexpr Key VIA =
+    Header_Key_VIA;
+  static constexpr Key WARNING =
+    Header_Key_WARNING;
+  static constexpr Key SEC_FETCH_DEST =
+    Header_Key_SEC_FETCH_DEST;
+  static constexpr Key SEC_FETCH_MODE =
+    Header_Key_SEC_FETCH_MODE;
+  static constexpr Key SEC_FETCH_SITE =
+    Header_Key_SEC_FETCH_SITE;
+  static constexpr Key SEC_FETCH_USER =
+    Header_Key_SEC_FETCH_USER;
+  static constexpr Key SEC_WEBSOCKET_KEY =
+    Header_Key_SEC_WEBSOCKET_KEY;
+  static constexpr Key SEC_WEBSOCKET_VERSION =
+    Header_Key_SEC_WEBSOCKET_VERSION;
+  static constexpr Key SEC_WEBSOCKET_PROTOCOL =
+    Header_Key_SEC_WEBSOCKET_PROTOCOL;
+  static constexpr Key SEC_WEBSOCKET_EXTENSIONS =
+    Header_Key_SEC_WEBSOCKET_EXTENSIONS;
+  static constexpr Key X_REQUESTED_WITH =
+    Header_Key_X_REQUESTED_WITH;
+  static constexpr Key X_FORWARDED_FOR =
+    Header_Key_X_FORWARDED_FOR;
+  static constexpr Key X_FORWARDED_HOST =
+    Header_Key_X_FORWARDED_HOST;
+  static constexpr Key X_FORWARDED_PROTO =
+    Header_Key_X_FORWARDED_PROTO;
+  static constexpr Key X_REAL_IP =
+    Header_Key_X_REAL_IP;
+  static constexpr Key X_REQUEST_ID =
+    Header_Key_X_REQUEST_ID;
+  static constexpr Key X_CORRELATION_ID =
+    Header_Key_X_CORRELATION_ID;
+  static constexpr Key X_CSRF_TOKEN =
+    Header_Key_X_CSRF_TOKEN;
+  static constexpr Key X_HTTP_METHOD_OVERRIDE =
+    Header_Key_X_HTTP_METHOD_OVERRIDE;
+  static constexpr Key X_REQUEST_TIMEOUT =
+    Header_Key_X_REQUEST_TIMEOUT;
+  static constexpr Key X_TRAFFIC_CLASS =
+    Header_Key_X_TRAFFIC_CLASS;
   static inline bool Key_IsValid(int value) {
     return Header_Key_IsValid(value);
   }
-  static const Key Key_MIN =
+  static constexpr Key Key_MIN =
     Header_Key_Key_MIN;
-  static const Key Key_MAX =
+  static constexpr Key Key_MAX =
     Header_Key_Key_MAX;
-  static const int Key_ARRAYSIZE =
+  static constexpr int Key_ARRAYSIZE =
     Header_Key_Key_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Key_descriptor() {
     return Header_Key_descriptor();
   }
-  static inline const ::std::string& Key_Name(Key value) {
-    return Header_Key_Name(value);
+  template<typename T>
+  static inline const std::string& Key_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Key>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Key_Name.");
+    return Header_Key_Name(enum_t_value);
   }
-  static inline bool Key_Parse(const ::std::string& name,
+  static inline bool Key_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Key* value) {
     return Header_Key_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // optional .http.Header.Key key = 1;
-  inline bool has_key() const;
-  inline void clear_key();
-  static const int kKeyFieldNumber = 1;
-  inline ::http::Header_Key key() const;
-  inline void set_key(::http::Header_Key value);
-
+  enum : int {
+    kCustomKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
+    kKeyFieldNumber = 1,
+  };
   // optional string custom_key = 2;
-  inline bool has_custom_key() const;
-  inline void clear_custom_key();
-  static const int kCustomKeyFieldNumber = 2;
-  inline const ::std::string& custom_key() const;
-  inline void set_custom_key(const ::std::string& value);
-  inline void set_custom_key(const char* value);
-  inline void set_custom_key(const char* value, size_t size);
-  inline ::std::string* mutable_custom_key();
-  inline ::std::string* release_custom_key();
-  inline void set_allocated_custom_key(::std::string* custom_key);
+  bool has_custom_key() const;
+  private:
+  bool _internal_has_custom_key() const;
+  public:
+  void clear_custom_key();
+  const std::string& custom_key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_custom_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_custom_key();
+  PROTOBUF_NODISCARD std::string* release_custom_key();
+  void set_allocated_custom_key(std::string* custom_key);
+  private:
+  const std::string& _internal_custom_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_custom_key(const std::string& value);
+  std::string* _internal_mutable_custom_key();
+  public:
 
   // required string value = 3;
-  inline bool has_value() const;
-  inline void clear_value();
-  static const int kValueFieldNumber = 3;
-  inline const ::std::string& value() const;
-  inline void set_value(const ::std::string& value);
-  inline void set_value(const char* value);
-  inline void set_value(const char* value, size_t size);
-  inline ::std::string* mutable_value();
-  inline ::std::string* release_value();
-  inline void set_allocated_value(::std::string* value);
+  bool has_value() const;
+  private:
+  bool _internal_has_value() const;
+  public:
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // optional .http.Header.Key key = 1;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  ::http::Header_Key key() const;
+  void set_key(::http::Header_Key value);
+  private:
+  ::http::Header_Key _internal_key() const;
+  void _internal_set_key(::http::Header_Key value);
+  public:
 
   // @@protoc_insertion_point(class_scope:http.Header)
  private:
-  inline void set_has_key();
-  inline void clear_has_key();
-  inline void set_has_custom_key();
-  inline void clear_has_custom_key();
-  inline void set_has_value();
-  inline void clear_has_value();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* custom_key_;
-  ::std::string* value_;
-  int key_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_http_2eproto();
-  friend void protobuf_AssignDesc_http_2eproto();
-  friend void protobuf_ShutdownFile_http_2eproto();
-
-  void InitAsDefaultInstance();
-  static Header* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr custom_key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int key_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Request : public ::google::protobuf::Message {
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.Request) */ {
  public:
-  Request();
-  virtual ~Request();
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
 
   inline Request& operator=(const Request& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Request& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Request* other);
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Request* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Request& from);
-  void MergeFrom(const Request& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef Request_Method Method;
-  static const Method DELETE = Request_Method_DELETE;
-  static const Method GET = Request_Method_GET;
-  static const Method HEAD = Request_Method_HEAD;
-  static const Method POST = Request_Method_POST;
-  static const Method PUT = Request_Method_PUT;
+  static constexpr Method DELETE =
+    Request_Method_DELETE;
+  static constexpr Method GET =
+    Request_Method_GET;
+  static constexpr Method HEAD =
+    Request_Method_HEAD;
+  static constexpr Method POST =
+    Request_Method_POST;
+  static constexpr Method PUT =
+    Request_Method_PUT;
   static inline bool Method_IsValid(int value) {
     return Request_Method_IsValid(value);
   }
-  static const Method Method_MIN =
+  static constexpr Method Method_MIN =
     Request_Method_Method_MIN;
-  static const Method Method_MAX =
+  static constexpr Method Method_MAX =
     Request_Method_Method_MAX;
-  static const int Method_ARRAYSIZE =
+  static constexpr int Method_ARRAYSIZE =
     Request_Method_Method_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Method_descriptor() {
     return Request_Method_descriptor();
   }
-  static inline const ::std::string& Method_Name(Method value) {
-    return Request_Method_Name(value);
+  template<typename T>
+  static inline const std::string& Method_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Method>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Method_Name.");
+    return Request_Method_Name(enum_t_value);
   }
-  static inline bool Method_Parse(const ::std::string& name,
+  static inline bool Method_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Method* value) {
     return Request_Method_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // required uint32 version_major = 1;
-  inline bool has_version_major() const;
-  inline void clear_version_major();
-  static const int kVersionMajorFieldNumber = 1;
-  inline ::google::protobuf::uint32 version_major() const;
-  inline void set_version_major(::google::protobuf::uint32 value);
-
-  // required uint32 version_minor = 2;
-  inline bool has_version_minor() const;
-  inline void clear_version_minor();
-  static const int kVersionMinorFieldNumber = 2;
-  inline ::google::protobuf::uint32 version_minor() const;
-  inline void set_version_minor(::google::protobuf::uint32 value);
-
-  // required uint32 stream_id = 8;
-  inline bool has_stream_id() const;
-  inline void clear_stream_id();
-  static const int kStreamIdFieldNumber = 8;
-  inline ::google::protobuf::uint32 stream_id() const;
-  inline void set_stream_id(::google::protobuf::uint32 value);
-
-  // optional .http.Request.Method method = 3;
-  inline bool has_method() const;
-  inline void clear_method();
-  static const int kMethodFieldNumber = 3;
-  inline ::http::Request_Method method() const;
-  inline void set_method(::http::Request_Method value);
+  enum : int {
+    kHeadersFieldNumber = 6,
+    kCustomMethodFieldNumber = 4,
+    kUrlFieldNumber = 5,
+    kBodyFieldNumber = 7,
+    kReplyToFieldNumber = 9,
+    kBulkReplyToFieldNumber = 10,
+    kVersionMajorFieldNumber = 1,
+    kVersionMinorFieldNumber = 2,
+    kStreamIdFieldNumber = 8,
+    kDeadlineFieldNumber = 11,
+    kMethodFieldNumber = 3,
+  };
+  // repeated .http.Header headers = 6;
+  int headers_size() const;
+  private:
+  int _internal_headers_size() const;
+  public:
+  void clear_headers();
+  ::http::Header* mutable_headers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >*
+      mutable_headers();
+  private:
+  const ::http::Header& _internal_headers(int index) const;
+  ::http::Header* _internal_add_headers();
+  public:
+  const ::http::Header& headers(int index) const;
+  ::http::Header* add_headers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >&
+      headers() const;
 
   // optional string custom_method = 4;
-  inline bool has_custom_method() const;
-  inline void clear_custom_method();
-  static const int kCustomMethodFieldNumber = 4;
-  inline const ::std::string& custom_method() const;
-  inline void set_custom_method(const ::std::string& value);
-  inline void set_custom_method(const char* value);
-  inline void set_custom_method(const char* value, size_t size);
-  inline ::std::string* mutable_custom_method();
-  inline ::std::string* release_custom_method();
-  inline void set_allocated_custom_method(::std::string* custom_method);
+  bool has_custom_method() const;
+  private:
+  bool _internal_has_custom_method() const;
+  public:
+  void clear_custom_method();
+  const std::string& custom_method() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_custom_method(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_custom_method();
+  PROTOBUF_NODISCARD std::string* release_custom_method();
+  void set_allocated_custom_method(std::string* custom_method);
+  private:
+  const std::string& _internal_custom_method() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_custom_method(const std::string& value);
+  std::string* _internal_mutable_custom_method();
+  public:
 
   // required string url = 5;
-  inline bool has_url() const;
-  inline void clear_url();
-  static const int kUrlFieldNumber = 5;
-  inline const ::std::string& url() const;
-  inline void set_url(const ::std::string& value);
-  inline void set_url(const char* value);
-  inline void set_url(const char* value, size_t size);
-  inline ::std::string* mutable_url();
-  inline ::std::string* release_url();
-  inline void set_allocated_url(::std::string* url);
-
-  // repeated .http.Header headers = 6;
-  inline int headers_size() const;
-  inline void clear_headers();
-  static const int kHeadersFieldNumber = 6;
-  inline const ::http::Header& headers(int index) const;
-  inline ::http::Header* mutable_headers(int index);
-  inline ::http::Header* add_headers();
-  inline const ::google::protobuf::RepeatedPtrField< ::http::Header >&
-      headers() const;
-  inline ::google::protobuf::RepeatedPtrField< ::http::Header >*
-      mutable_headers();
+  bool has_url() const;
+  private:
+  bool _internal_has_url() const;
+  public:
+  void clear_url();
+  const std::string& url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_url();
+  PROTOBUF_NODISCARD std::string* release_url();
+  void set_allocated_url(std::string* url);
+  private:
+  const std::string& _internal_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_url(const std::string& value);
+  std::string* _internal_mutable_url();
+  public:
 
   // optional bytes body = 7;
-  inline bool has_body() const;
-  inline void clear_body();
-  static const int kBodyFieldNumber = 7;
-  inline const ::std::string& body() const;
-  inline void set_body(const ::std::string& value);
-  inline void set_body(const char* value);
-  inline void set_body(const void* value, size_t size);
-  inline ::std::string* mutable_body();
-  inline ::std::string* release_body();
-  inline void set_allocated_body(::std::string* body);
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // optional string reply_to = 9;
+  bool has_reply_to() const;
+  private:
+  bool _internal_has_reply_to() const;
+  public:
+  void clear_reply_to();
+  const std::string& reply_to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply_to();
+  PROTOBUF_NODISCARD std::string* release_reply_to();
+  void set_allocated_reply_to(std::string* reply_to);
+  private:
+  const std::string& _internal_reply_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply_to(const std::string& value);
+  std::string* _internal_mutable_reply_to();
+  public:
+
+  // optional string bulk_reply_to = 10;
+  bool has_bulk_reply_to() const;
+  private:
+  bool _internal_has_bulk_reply_to() const;
+  public:
+  void clear_bulk_reply_to();
+  const std::string& bulk_reply_to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_bulk_reply_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_bulk_reply_to();
+  PROTOBUF_NODISCARD std::string* release_bulk_reply_to();
+  void set_allocated_bulk_reply_to(std::string* bulk_reply_to);
+  private:
+  const std::string& _internal_bulk_reply_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_bulk_reply_to(const std::string& value);
+  std::string* _internal_mutable_bulk_reply_to();
+  public:
+
+  // required uint32 version_major = 1;
+  bool has_version_major() const;
+  private:
+  bool _internal_has_version_major() const;
+  public:
+  void clear_version_major();
+  uint32_t version_major() const;
+  void set_version_major(uint32_t value);
+  private:
+  uint32_t _internal_version_major() const;
+  void _internal_set_version_major(uint32_t value);
+  public:
+
+  // required uint32 version_minor = 2;
+  bool has_version_minor() const;
+  private:
+  bool _internal_has_version_minor() const;
+  public:
+  void clear_version_minor();
+  uint32_t version_minor() const;
+  void set_version_minor(uint32_t value);
+  private:
+  uint32_t _internal_version_minor() const;
+  void _internal_set_version_minor(uint32_t value);
+  public:
+
+  // required uint64 stream_id = 8;
+  bool has_stream_id() const;
+  private:
+  bool _internal_has_stream_id() const;
+  public:
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
+
+  // optional uint64 deadline = 11;
+  bool has_deadline() const;
+  private:
+  bool _internal_has_deadline() const;
+  public:
+  void clear_deadline();
+  uint64_t deadline() const;
+  void set_deadline(uint64_t value);
+  private:
+  uint64_t _internal_deadline() const;
+  void _internal_set_deadline(uint64_t value);
+  public:
+
+  // optional .http.Request.Method method = 3;
+  bool has_method() const;
+  private:
+  bool _internal_has_method() const;
+  public:
+  void clear_method();
+  ::http::Request_Method method() const;
+  void set_method(::http::Request_Method value);
+  private:
+  ::http::Request_Method _internal_method() const;
+  void _internal_set_method(::http::Request_Method value);
+  public:
 
   // @@protoc_insertion_point(class_scope:http.Request)
  private:
-  inline void set_has_version_major();
-  inline void clear_has_version_major();
-  inline void set_has_version_minor();
-  inline void clear_has_version_minor();
-  inline void set_has_stream_id();
-  inline void clear_has_stream_id();
-  inline void set_has_method();
-  inline void clear_has_method();
-  inline void set_has_custom_method();
-  inline void clear_has_custom_method();
-  inline void set_has_url();
-  inline void clear_has_url();
-  inline void set_has_body();
-  inline void clear_has_body();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::uint32 version_major_;
-  ::google::protobuf::uint32 version_minor_;
-  ::google::protobuf::uint32 stream_id_;
-  int method_;
-  ::std::string* custom_method_;
-  ::std::string* url_;
-  ::google::protobuf::RepeatedPtrField< ::http::Header > headers_;
-  ::std::string* body_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(8 + 31) / 32];
-
-  friend void  protobuf_AddDesc_http_2eproto();
-  friend void protobuf_AssignDesc_http_2eproto();
-  friend void protobuf_ShutdownFile_http_2eproto();
-
-  void InitAsDefaultInstance();
-  static Request* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header > headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr custom_method_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr url_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_to_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr bulk_reply_to_;
+    uint32_t version_major_;
+    uint32_t version_minor_;
+    uint64_t stream_id_;
+    uint64_t deadline_;
+    int method_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Response : public ::google::protobuf::Message {
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.Response) */ {
  public:
-  Response();
-  virtual ~Response();
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
 
   inline Response& operator=(const Response& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Response& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(Response* other);
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Response* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Response& from);
-  void MergeFrom(const Response& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required uint32 stream_id = 1;
-  inline bool has_stream_id() const;
-  inline void clear_stream_id();
-  static const int kStreamIdFieldNumber = 1;
-  inline ::google::protobuf::uint32 stream_id() const;
-  inline void set_stream_id(::google::protobuf::uint32 value);
-
-  // required uint32 status = 2;
-  inline bool has_status() const;
-  inline void clear_status();
-  static const int kStatusFieldNumber = 2;
-  inline ::google::protobuf::uint32 status() const;
-  inline void set_status(::google::protobuf::uint32 value);
-
+  enum : int {
+    kHeadersFieldNumber = 3,
+    kBodyFieldNumber = 4,
+    kStreamIdFieldNumber = 1,
+    kStatusFieldNumber = 2,
+    kStreamedFieldNumber = 5,
+  };
   // repeated .http.Header headers = 3;
-  inline int headers_size() const;
-  inline void clear_headers();
-  static const int kHeadersFieldNumber = 3;
-  inline const ::http::Header& headers(int index) const;
-  inline ::http::Header* mutable_headers(int index);
-  inline ::http::Header* add_headers();
-  inline const ::google::protobuf::RepeatedPtrField< ::http::Header >&
-      headers() const;
-  inline ::google::protobuf::RepeatedPtrField< ::http::Header >*
+  int headers_size() const;
+  private:
+  int _internal_headers_size() const;
+  public:
+  void clear_headers();
+  ::http::Header* mutable_headers(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >*
       mutable_headers();
+  private:
+  const ::http::Header& _internal_headers(int index) const;
+  ::http::Header* _internal_add_headers();
+  public:
+  const ::http::Header& headers(int index) const;
+  ::http::Header* add_headers();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >&
+      headers() const;
 
   // optional bytes body = 4;
-  inline bool has_body() const;
-  inline void clear_body();
-  static const int kBodyFieldNumber = 4;
-  inline const ::std::string& body() const;
-  inline void set_body(const ::std::string& value);
-  inline void set_body(const char* value);
-  inline void set_body(const void* value, size_t size);
-  inline ::std::string* mutable_body();
-  inline ::std::string* release_body();
-  inline void set_allocated_body(::std::string* body);
-
-  // @@protoc_insertion_point(class_scope:http.Response)
- private:
-  inline void set_has_stream_id();
-  inline void clear_has_stream_id();
-  inline void set_has_status();
-  inline void clear_has_status();
-  inline void set_has_body();
-  inline void clear_has_body();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
 
-  ::google::protobuf::uint32 stream_id_;
-  ::google::protobuf::uint32 status_;
-  ::google::protobuf::RepeatedPtrField< ::http::Header > headers_;
-  ::std::string* body_;
+  // required uint64 stream_id = 1;
+  bool has_stream_id() const;
+  private:
+  bool _internal_has_stream_id() const;
+  public:
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
 
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
+  // required uint32 status = 2;
+  bool has_status() const;
+  private:
+  bool _internal_has_status() const;
+  public:
+  void clear_status();
+  uint32_t status() const;
+  void set_status(uint32_t value);
+  private:
+  uint32_t _internal_status() const;
+  void _internal_set_status(uint32_t value);
+  public:
 
-  friend void  protobuf_AddDesc_http_2eproto();
-  friend void protobuf_AssignDesc_http_2eproto();
-  friend void protobuf_ShutdownFile_http_2eproto();
+  // optional bool streamed = 5;
+  bool has_streamed() const;
+  private:
+  bool _internal_has_streamed() const;
+  public:
+  void clear_streamed();
+  bool streamed() const;
+  void set_streamed(bool value);
+  private:
+  bool _internal_streamed() const;
+  void _internal_set_streamed(bool value);
+  public:
 
-  void InitAsDefaultInstance();
-  static Response* default_instance_;
+  // @@protoc_insertion_point(class_scope:http.Response)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header > headers_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    uint64_t stream_id_;
+    uint32_t status_;
+    bool streamed_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
 };
-// ===================================================================
-
-
-// ===================================================================
+// -------------------------------------------------------------------
 
-// Header
+class ResponseChunk final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.ResponseChunk) */ {
+ public:
+  inline ResponseChunk() : ResponseChunk(nullptr) {}
+  ~ResponseChunk() override;
+  explicit PROTOBUF_CONSTEXPR ResponseChunk(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// optional .http.Header.Key key = 1;
-inline bool Header::has_key() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
-}
-inline void Header::set_has_key() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Header::clear_has_key() {
-  _has_bits_[0] &= ~0x00000001u;
-}
-inline void Header::clear_key() {
-  key_ = 0;
-  clear_has_key();
-}
-inline ::http::Header_Key Header::key() const {
-  return static_cast< ::http::Header_Key >(key_);
-}
-inline void Header::set_key(::http::Header_Key value) {
-  assert(::http::Header_Key_IsValid(value));
-  set_has_key();
-  key_ = value;
-}
+  ResponseChunk(const ResponseChunk& from);
+  ResponseChunk(ResponseChunk&& from) noexcept
+    : ResponseChunk() {
+    *this = ::std::move(from);
+  }
 
-// optional string custom_key = 2;
-inline bool Header::has_custom_key() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Header::set_has_custom_key() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Header::clear_has_custom_key() {
-  _has_bits_[0] &= ~0x00000002u;
-}
-inline void Header::clear_custom_key() {
-  if (custom_key_ != &::google::protobuf::internal::kEmptyString) {
-    custom_key_->clear();
+  inline ResponseChunk& operator=(const ResponseChunk& from) {
+    CopyFrom(from);
+    return *this;
   }
-  clear_has_custom_key();
-}
-inline const ::std::string& Header::custom_key() const {
-  return *custom_key_;
-}
-inline void Header::set_custom_key(const ::std::string& value) {
-  set_has_custom_key();
-  if (custom_key_ == &::google::protobuf::internal::kEmptyString) {
-    custom_key_ = new ::std::string;
+  inline ResponseChunk& operator=(ResponseChunk&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  custom_key_->assign(value);
-}
-inline void Header::set_custom_key(const char* value) {
-  set_has_custom_key();
-  if (custom_key_ == &::google::protobuf::internal::kEmptyString) {
-    custom_key_ = new ::std::string;
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
   }
-  custom_key_->assign(value);
-}
-inline void Header::set_custom_key(const char* value, size_t size) {
-  set_has_custom_key();
-  if (custom_key_ == &::google::protobuf::internal::kEmptyString) {
-    custom_key_ = new ::std::string;
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
-  custom_key_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Header::mutable_custom_key() {
-  set_has_custom_key();
-  if (custom_key_ == &::google::protobuf::internal::kEmptyString) {
-    custom_key_ = new ::std::string;
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  return custom_key_;
-}
-inline ::std::string* Header::release_custom_key() {
-  clear_has_custom_key();
-  if (custom_key_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = custom_key_;
-    custom_key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
   }
-}
-inline void Header::set_allocated_custom_key(::std::string* custom_key) {
-  if (custom_key_ != &::google::protobuf::internal::kEmptyString) {
-    delete custom_key_;
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
   }
-  if (custom_key) {
-    set_has_custom_key();
-    custom_key_ = custom_key;
-  } else {
-    clear_has_custom_key();
-    custom_key_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  static const ResponseChunk& default_instance() {
+    return *internal_default_instance();
   }
-}
-
-// required string value = 3;
-inline bool Header::has_value() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
-}
-inline void Header::set_has_value() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void Header::clear_has_value() {
-  _has_bits_[0] &= ~0x00000004u;
-}
-inline void Header::clear_value() {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    value_->clear();
+  static inline const ResponseChunk* internal_default_instance() {
+    return reinterpret_cast<const ResponseChunk*>(
+               &_ResponseChunk_default_instance_);
   }
-  clear_has_value();
-}
-inline const ::std::string& Header::value() const {
-  return *value_;
-}
-inline void Header::set_value(const ::std::string& value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ResponseChunk& a, ResponseChunk& b) {
+    a.Swap(&b);
   }
-  value_->assign(value);
-}
-inline void Header::set_value(const char* value) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+  inline void Swap(ResponseChunk* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
   }
-  value_->assign(value);
-}
-inline void Header::set_value(const char* value, size_t size) {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+  void UnsafeArenaSwap(ResponseChunk* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
   }
-  value_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Header::mutable_value() {
-  set_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    value_ = new ::std::string;
+
+  // implements Message ----------------------------------------------
+
+  ResponseChunk* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResponseChunk>(arena);
   }
-  return value_;
-}
-inline ::std::string* Header::release_value() {
-  clear_has_value();
-  if (value_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = value_;
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResponseChunk& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponseChunk& from) {
+    ResponseChunk::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResponseChunk* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.ResponseChunk";
+  }
+  protected:
+  explicit ResponseChunk(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBodyFieldNumber = 4,
+    kStreamIdFieldNumber = 1,
+    kEndFieldNumber = 5,
+  };
+  // optional bytes body = 4;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // required uint64 stream_id = 1;
+  bool has_stream_id() const;
+  private:
+  bool _internal_has_stream_id() const;
+  public:
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
+
+  // optional bool end = 5;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  bool end() const;
+  void set_end(bool value);
+  private:
+  bool _internal_end() const;
+  void _internal_set_end(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:http.ResponseChunk)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    uint64_t stream_id_;
+    bool end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RequestBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.RequestBatch) */ {
+ public:
+  inline RequestBatch() : RequestBatch(nullptr) {}
+  ~RequestBatch() override;
+  explicit PROTOBUF_CONSTEXPR RequestBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RequestBatch(const RequestBatch& from);
+  RequestBatch(RequestBatch&& from) noexcept
+    : RequestBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline RequestBatch& operator=(const RequestBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RequestBatch& operator=(RequestBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RequestBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RequestBatch* internal_default_instance() {
+    return reinterpret_cast<const RequestBatch*>(
+               &_RequestBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(RequestBatch& a, RequestBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RequestBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RequestBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RequestBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RequestBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RequestBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RequestBatch& from) {
+    RequestBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RequestBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.RequestBatch";
+  }
+  protected:
+  explicit RequestBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestsFieldNumber = 1,
+  };
+  // repeated bytes requests = 1;
+  int requests_size() const;
+  private:
+  int _internal_requests_size() const;
+  public:
+  void clear_requests();
+  const std::string& requests(int index) const;
+  std::string* mutable_requests(int index);
+  void set_requests(int index, const std::string& value);
+  void set_requests(int index, std::string&& value);
+  void set_requests(int index, const char* value);
+  void set_requests(int index, const void* value, size_t size);
+  std::string* add_requests();
+  void add_requests(const std::string& value);
+  void add_requests(std::string&& value);
+  void add_requests(const char* value);
+  void add_requests(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& requests() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_requests();
+  private:
+  const std::string& _internal_requests(int index) const;
+  std::string* _internal_add_requests();
+  public:
+
+  // @@protoc_insertion_point(class_scope:http.RequestBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> requests_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResponseBatch final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.ResponseBatch) */ {
+ public:
+  inline ResponseBatch() : ResponseBatch(nullptr) {}
+  ~ResponseBatch() override;
+  explicit PROTOBUF_CONSTEXPR ResponseBatch(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResponseBatch(const ResponseBatch& from);
+  ResponseBatch(ResponseBatch&& from) noexcept
+    : ResponseBatch() {
+    *this = ::std::move(from);
+  }
+
+  inline ResponseBatch& operator=(const ResponseBatch& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResponseBatch& operator=(ResponseBatch&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResponseBatch& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResponseBatch* internal_default_instance() {
+    return reinterpret_cast<const ResponseBatch*>(
+               &_ResponseBatch_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(ResponseBatch& a, ResponseBatch& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResponseBatch* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResponseBatch* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResponseBatch* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResponseBatch>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResponseBatch& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResponseBatch& from) {
+    ResponseBatch::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResponseBatch* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.ResponseBatch";
+  }
+  protected:
+  explicit ResponseBatch(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResponsesFieldNumber = 1,
+  };
+  // repeated bytes responses = 1;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  const std::string& responses(int index) const;
+  std::string* mutable_responses(int index);
+  void set_responses(int index, const std::string& value);
+  void set_responses(int index, std::string&& value);
+  void set_responses(int index, const char* value);
+  void set_responses(int index, const void* value, size_t size);
+  std::string* add_responses();
+  void add_responses(const std::string& value);
+  void add_responses(std::string&& value);
+  void add_responses(const char* value);
+  void add_responses(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& responses() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_responses();
+  private:
+  const std::string& _internal_responses(int index) const;
+  std::string* _internal_add_responses();
+  public:
+
+  // @@protoc_insertion_point(class_scope:http.ResponseBatch)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> responses_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Cancel final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.Cancel) */ {
+ public:
+  inline Cancel() : Cancel(nullptr) {}
+  ~Cancel() override;
+  explicit PROTOBUF_CONSTEXPR Cancel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Cancel(const Cancel& from);
+  Cancel(Cancel&& from) noexcept
+    : Cancel() {
+    *this = ::std::move(from);
+  }
+
+  inline Cancel& operator=(const Cancel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Cancel& operator=(Cancel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Cancel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Cancel* internal_default_instance() {
+    return reinterpret_cast<const Cancel*>(
+               &_Cancel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(Cancel& a, Cancel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Cancel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Cancel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Cancel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Cancel>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Cancel& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Cancel& from) {
+    Cancel::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Cancel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.Cancel";
+  }
+  protected:
+  explicit Cancel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStreamIdsFieldNumber = 1,
+  };
+  // repeated uint64 stream_ids = 1;
+  int stream_ids_size() const;
+  private:
+  int _internal_stream_ids_size() const;
+  public:
+  void clear_stream_ids();
+  private:
+  uint64_t _internal_stream_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_stream_ids() const;
+  void _internal_add_stream_ids(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_stream_ids();
+  public:
+  uint64_t stream_ids(int index) const;
+  void set_stream_ids(int index, uint64_t value);
+  void add_stream_ids(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      stream_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_stream_ids();
+
+  // @@protoc_insertion_point(class_scope:http.Cancel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > stream_ids_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Flow final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.Flow) */ {
+ public:
+  inline Flow() : Flow(nullptr) {}
+  ~Flow() override;
+  explicit PROTOBUF_CONSTEXPR Flow(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Flow(const Flow& from);
+  Flow(Flow&& from) noexcept
+    : Flow() {
+    *this = ::std::move(from);
+  }
+
+  inline Flow& operator=(const Flow& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Flow& operator=(Flow&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Flow& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Flow* internal_default_instance() {
+    return reinterpret_cast<const Flow*>(
+               &_Flow_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Flow& a, Flow& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Flow* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Flow* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Flow* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Flow>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Flow& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Flow& from) {
+    Flow::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Flow* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.Flow";
+  }
+  protected:
+  explicit Flow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPausedFieldNumber = 1,
+    kResumedFieldNumber = 2,
+  };
+  // repeated uint64 paused = 1;
+  int paused_size() const;
+  private:
+  int _internal_paused_size() const;
+  public:
+  void clear_paused();
+  private:
+  uint64_t _internal_paused(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_paused() const;
+  void _internal_add_paused(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_paused();
+  public:
+  uint64_t paused(int index) const;
+  void set_paused(int index, uint64_t value);
+  void add_paused(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      paused() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_paused();
+
+  // repeated uint64 resumed = 2;
+  int resumed_size() const;
+  private:
+  int _internal_resumed_size() const;
+  public:
+  void clear_resumed();
+  private:
+  uint64_t _internal_resumed(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_resumed() const;
+  void _internal_add_resumed(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_resumed();
+  public:
+  uint64_t resumed(int index) const;
+  void set_resumed(int index, uint64_t value);
+  void add_resumed(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      resumed() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_resumed();
+
+  // @@protoc_insertion_point(class_scope:http.Flow)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > paused_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > resumed_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SocketMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:http.SocketMessage) */ {
+ public:
+  inline SocketMessage() : SocketMessage(nullptr) {}
+  ~SocketMessage() override;
+  explicit PROTOBUF_CONSTEXPR SocketMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SocketMessage(const SocketMessage& from);
+  SocketMessage(SocketMessage&& from) noexcept
+    : SocketMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline SocketMessage& operator=(const SocketMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SocketMessage& operator=(SocketMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SocketMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SocketMessage* internal_default_instance() {
+    return reinterpret_cast<const SocketMessage*>(
+               &_SocketMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SocketMessage& a, SocketMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SocketMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SocketMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SocketMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SocketMessage>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SocketMessage& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SocketMessage& from) {
+    SocketMessage::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SocketMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "http.SocketMessage";
+  }
+  protected:
+  explicit SocketMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplyToFieldNumber = 2,
+    kBodyFieldNumber = 4,
+    kRequestFieldNumber = 6,
+    kStreamIdFieldNumber = 1,
+    kBinaryFieldNumber = 3,
+    kEndFieldNumber = 5,
+  };
+  // optional string reply_to = 2;
+  bool has_reply_to() const;
+  private:
+  bool _internal_has_reply_to() const;
+  public:
+  void clear_reply_to();
+  const std::string& reply_to() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_reply_to(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_reply_to();
+  PROTOBUF_NODISCARD std::string* release_reply_to();
+  void set_allocated_reply_to(std::string* reply_to);
+  private:
+  const std::string& _internal_reply_to() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_reply_to(const std::string& value);
+  std::string* _internal_mutable_reply_to();
+  public:
+
+  // optional bytes body = 4;
+  bool has_body() const;
+  private:
+  bool _internal_has_body() const;
+  public:
+  void clear_body();
+  const std::string& body() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_body(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_body();
+  PROTOBUF_NODISCARD std::string* release_body();
+  void set_allocated_body(std::string* body);
+  private:
+  const std::string& _internal_body() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_body(const std::string& value);
+  std::string* _internal_mutable_body();
+  public:
+
+  // optional .http.Request request = 6;
+  bool has_request() const;
+  private:
+  bool _internal_has_request() const;
+  public:
+  void clear_request();
+  const ::http::Request& request() const;
+  PROTOBUF_NODISCARD ::http::Request* release_request();
+  ::http::Request* mutable_request();
+  void set_allocated_request(::http::Request* request);
+  private:
+  const ::http::Request& _internal_request() const;
+  ::http::Request* _internal_mutable_request();
+  public:
+  void unsafe_arena_set_allocated_request(
+      ::http::Request* request);
+  ::http::Request* unsafe_arena_release_request();
+
+  // required uint64 stream_id = 1;
+  bool has_stream_id() const;
+  private:
+  bool _internal_has_stream_id() const;
+  public:
+  void clear_stream_id();
+  uint64_t stream_id() const;
+  void set_stream_id(uint64_t value);
+  private:
+  uint64_t _internal_stream_id() const;
+  void _internal_set_stream_id(uint64_t value);
+  public:
+
+  // optional bool binary = 3;
+  bool has_binary() const;
+  private:
+  bool _internal_has_binary() const;
+  public:
+  void clear_binary();
+  bool binary() const;
+  void set_binary(bool value);
+  private:
+  bool _internal_binary() const;
+  void _internal_set_binary(bool value);
+  public:
+
+  // optional bool end = 5;
+  bool has_end() const;
+  private:
+  bool _internal_has_end() const;
+  public:
+  void clear_end();
+  bool end() const;
+  void set_end(bool value);
+  private:
+  bool _internal_end() const;
+  void _internal_set_end(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:http.SocketMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr reply_to_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr body_;
+    ::http::Request* request_;
+    uint64_t stream_id_;
+    bool binary_;
+    bool end_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Header
+
+// optional .http.Header.Key key = 1;
+inline bool Header::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Header::has_key() const {
+  return _internal_has_key();
+}
+inline void Header::clear_key() {
+  _impl_.key_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline ::http::Header_Key Header::_internal_key() const {
+  return static_cast< ::http::Header_Key >(_impl_.key_);
+}
+inline ::http::Header_Key Header::key() const {
+  // @@protoc_insertion_point(field_get:http.Header.key)
+  return _internal_key();
+}
+inline void Header::_internal_set_key(::http::Header_Key value) {
+  assert(::http::Header_Key_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.key_ = value;
+}
+inline void Header::set_key(::http::Header_Key value) {
+  _internal_set_key(value);
+  // @@protoc_insertion_point(field_set:http.Header.key)
+}
+
+// optional string custom_key = 2;
+inline bool Header::_internal_has_custom_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Header::has_custom_key() const {
+  return _internal_has_custom_key();
+}
+inline void Header::clear_custom_key() {
+  _impl_.custom_key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Header::custom_key() const {
+  // @@protoc_insertion_point(field_get:http.Header.custom_key)
+  return _internal_custom_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Header::set_custom_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.custom_key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Header.custom_key)
+}
+inline std::string* Header::mutable_custom_key() {
+  std::string* _s = _internal_mutable_custom_key();
+  // @@protoc_insertion_point(field_mutable:http.Header.custom_key)
+  return _s;
+}
+inline const std::string& Header::_internal_custom_key() const {
+  return _impl_.custom_key_.Get();
+}
+inline void Header::_internal_set_custom_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.custom_key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Header::_internal_mutable_custom_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.custom_key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Header::release_custom_key() {
+  // @@protoc_insertion_point(field_release:http.Header.custom_key)
+  if (!_internal_has_custom_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.custom_key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.custom_key_.IsDefault()) {
+    _impl_.custom_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Header::set_allocated_custom_key(std::string* custom_key) {
+  if (custom_key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.custom_key_.SetAllocated(custom_key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.custom_key_.IsDefault()) {
+    _impl_.custom_key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Header.custom_key)
+}
+
+// required string value = 3;
+inline bool Header::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Header::has_value() const {
+  return _internal_has_value();
+}
+inline void Header::clear_value() {
+  _impl_.value_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Header::value() const {
+  // @@protoc_insertion_point(field_get:http.Header.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Header::set_value(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Header.value)
+}
+inline std::string* Header::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:http.Header.value)
+  return _s;
+}
+inline const std::string& Header::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Header::_internal_set_value(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Header::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Header::release_value() {
+  // @@protoc_insertion_point(field_release:http.Header.value)
+  if (!_internal_has_value()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.value_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Header::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Header.value)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// required uint32 version_major = 1;
+inline bool Request::_internal_has_version_major() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Request::has_version_major() const {
+  return _internal_has_version_major();
+}
+inline void Request::clear_version_major() {
+  _impl_.version_major_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t Request::_internal_version_major() const {
+  return _impl_.version_major_;
+}
+inline uint32_t Request::version_major() const {
+  // @@protoc_insertion_point(field_get:http.Request.version_major)
+  return _internal_version_major();
+}
+inline void Request::_internal_set_version_major(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.version_major_ = value;
+}
+inline void Request::set_version_major(uint32_t value) {
+  _internal_set_version_major(value);
+  // @@protoc_insertion_point(field_set:http.Request.version_major)
+}
+
+// required uint32 version_minor = 2;
+inline bool Request::_internal_has_version_minor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Request::has_version_minor() const {
+  return _internal_has_version_minor();
+}
+inline void Request::clear_version_minor() {
+  _impl_.version_minor_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t Request::_internal_version_minor() const {
+  return _impl_.version_minor_;
+}
+inline uint32_t Request::version_minor() const {
+  // @@protoc_insertion_point(field_get:http.Request.version_minor)
+  return _internal_version_minor();
+}
+inline void Request::_internal_set_version_minor(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.version_minor_ = value;
+}
+inline void Request::set_version_minor(uint32_t value) {
+  _internal_set_version_minor(value);
+  // @@protoc_insertion_point(field_set:http.Request.version_minor)
+}
+
+// required uint64 stream_id = 8;
+inline bool Request::_internal_has_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool Request::has_stream_id() const {
+  return _internal_has_stream_id();
+}
+inline void Request::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint64_t Request::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint64_t Request::stream_id() const {
+  // @@protoc_insertion_point(field_get:http.Request.stream_id)
+  return _internal_stream_id();
+}
+inline void Request::_internal_set_stream_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.stream_id_ = value;
+}
+inline void Request::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:http.Request.stream_id)
+}
+
+// optional .http.Request.Method method = 3;
+inline bool Request::_internal_has_method() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool Request::has_method() const {
+  return _internal_has_method();
+}
+inline void Request::clear_method() {
+  _impl_.method_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline ::http::Request_Method Request::_internal_method() const {
+  return static_cast< ::http::Request_Method >(_impl_.method_);
+}
+inline ::http::Request_Method Request::method() const {
+  // @@protoc_insertion_point(field_get:http.Request.method)
+  return _internal_method();
+}
+inline void Request::_internal_set_method(::http::Request_Method value) {
+  assert(::http::Request_Method_IsValid(value));
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.method_ = value;
+}
+inline void Request::set_method(::http::Request_Method value) {
+  _internal_set_method(value);
+  // @@protoc_insertion_point(field_set:http.Request.method)
+}
+
+// optional string custom_method = 4;
+inline bool Request::_internal_has_custom_method() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Request::has_custom_method() const {
+  return _internal_has_custom_method();
+}
+inline void Request::clear_custom_method() {
+  _impl_.custom_method_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Request::custom_method() const {
+  // @@protoc_insertion_point(field_get:http.Request.custom_method)
+  return _internal_custom_method();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_custom_method(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.custom_method_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Request.custom_method)
+}
+inline std::string* Request::mutable_custom_method() {
+  std::string* _s = _internal_mutable_custom_method();
+  // @@protoc_insertion_point(field_mutable:http.Request.custom_method)
+  return _s;
+}
+inline const std::string& Request::_internal_custom_method() const {
+  return _impl_.custom_method_.Get();
+}
+inline void Request::_internal_set_custom_method(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.custom_method_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_custom_method() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.custom_method_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_custom_method() {
+  // @@protoc_insertion_point(field_release:http.Request.custom_method)
+  if (!_internal_has_custom_method()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.custom_method_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.custom_method_.IsDefault()) {
+    _impl_.custom_method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_custom_method(std::string* custom_method) {
+  if (custom_method != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.custom_method_.SetAllocated(custom_method, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.custom_method_.IsDefault()) {
+    _impl_.custom_method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Request.custom_method)
+}
+
+// required string url = 5;
+inline bool Request::_internal_has_url() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Request::has_url() const {
+  return _internal_has_url();
+}
+inline void Request::clear_url() {
+  _impl_.url_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Request::url() const {
+  // @@protoc_insertion_point(field_get:http.Request.url)
+  return _internal_url();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_url(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.url_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Request.url)
+}
+inline std::string* Request::mutable_url() {
+  std::string* _s = _internal_mutable_url();
+  // @@protoc_insertion_point(field_mutable:http.Request.url)
+  return _s;
+}
+inline const std::string& Request::_internal_url() const {
+  return _impl_.url_.Get();
+}
+inline void Request::_internal_set_url(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.url_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_url() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.url_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_url() {
+  // @@protoc_insertion_point(field_release:http.Request.url)
+  if (!_internal_has_url()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.url_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.url_.IsDefault()) {
+    _impl_.url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_url(std::string* url) {
+  if (url != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.url_.SetAllocated(url, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.url_.IsDefault()) {
+    _impl_.url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Request.url)
+}
+
+// repeated .http.Header headers = 6;
+inline int Request::_internal_headers_size() const {
+  return _impl_.headers_.size();
+}
+inline int Request::headers_size() const {
+  return _internal_headers_size();
+}
+inline void Request::clear_headers() {
+  _impl_.headers_.Clear();
+}
+inline ::http::Header* Request::mutable_headers(int index) {
+  // @@protoc_insertion_point(field_mutable:http.Request.headers)
+  return _impl_.headers_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >*
+Request::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_list:http.Request.headers)
+  return &_impl_.headers_;
+}
+inline const ::http::Header& Request::_internal_headers(int index) const {
+  return _impl_.headers_.Get(index);
+}
+inline const ::http::Header& Request::headers(int index) const {
+  // @@protoc_insertion_point(field_get:http.Request.headers)
+  return _internal_headers(index);
+}
+inline ::http::Header* Request::_internal_add_headers() {
+  return _impl_.headers_.Add();
+}
+inline ::http::Header* Request::add_headers() {
+  ::http::Header* _add = _internal_add_headers();
+  // @@protoc_insertion_point(field_add:http.Request.headers)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >&
+Request::headers() const {
+  // @@protoc_insertion_point(field_list:http.Request.headers)
+  return _impl_.headers_;
+}
+
+// optional bytes body = 7;
+inline bool Request::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Request::has_body() const {
+  return _internal_has_body();
+}
+inline void Request::clear_body() {
+  _impl_.body_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& Request::body() const {
+  // @@protoc_insertion_point(field_get:http.Request.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_body(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Request.body)
+}
+inline std::string* Request::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:http.Request.body)
+  return _s;
+}
+inline const std::string& Request::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void Request::_internal_set_body(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_body() {
+  // @@protoc_insertion_point(field_release:http.Request.body)
+  if (!_internal_has_body()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.body_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Request.body)
+}
+
+// optional string reply_to = 9;
+inline bool Request::_internal_has_reply_to() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Request::has_reply_to() const {
+  return _internal_has_reply_to();
+}
+inline void Request::clear_reply_to() {
+  _impl_.reply_to_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Header::set_allocated_value(::std::string* value) {
-  if (value_ != &::google::protobuf::internal::kEmptyString) {
-    delete value_;
+inline const std::string& Request::reply_to() const {
+  // @@protoc_insertion_point(field_get:http.Request.reply_to)
+  return _internal_reply_to();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_reply_to(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.reply_to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Request.reply_to)
+}
+inline std::string* Request::mutable_reply_to() {
+  std::string* _s = _internal_mutable_reply_to();
+  // @@protoc_insertion_point(field_mutable:http.Request.reply_to)
+  return _s;
+}
+inline const std::string& Request::_internal_reply_to() const {
+  return _impl_.reply_to_.Get();
+}
+inline void Request::_internal_set_reply_to(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.reply_to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_reply_to() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.reply_to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_reply_to() {
+  // @@protoc_insertion_point(field_release:http.Request.reply_to)
+  if (!_internal_has_reply_to()) {
+    return nullptr;
   }
-  if (value) {
-    set_has_value();
-    value_ = value;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.reply_to_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_to_.IsDefault()) {
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_reply_to(std::string* reply_to) {
+  if (reply_to != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    clear_has_value();
-    value_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
+  _impl_.reply_to_.SetAllocated(reply_to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_to_.IsDefault()) {
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Request.reply_to)
 }
 
-// -------------------------------------------------------------------
-
-// Request
-
-// required uint32 version_major = 1;
-inline bool Request::has_version_major() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// optional string bulk_reply_to = 10;
+inline bool Request::_internal_has_bulk_reply_to() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline void Request::set_has_version_major() {
-  _has_bits_[0] |= 0x00000001u;
+inline bool Request::has_bulk_reply_to() const {
+  return _internal_has_bulk_reply_to();
 }
-inline void Request::clear_has_version_major() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void Request::clear_bulk_reply_to() {
+  _impl_.bulk_reply_to_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void Request::clear_version_major() {
-  version_major_ = 0u;
-  clear_has_version_major();
+inline const std::string& Request::bulk_reply_to() const {
+  // @@protoc_insertion_point(field_get:http.Request.bulk_reply_to)
+  return _internal_bulk_reply_to();
 }
-inline ::google::protobuf::uint32 Request::version_major() const {
-  return version_major_;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Request::set_bulk_reply_to(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000010u;
+ _impl_.bulk_reply_to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Request.bulk_reply_to)
 }
-inline void Request::set_version_major(::google::protobuf::uint32 value) {
-  set_has_version_major();
-  version_major_ = value;
+inline std::string* Request::mutable_bulk_reply_to() {
+  std::string* _s = _internal_mutable_bulk_reply_to();
+  // @@protoc_insertion_point(field_mutable:http.Request.bulk_reply_to)
+  return _s;
+}
+inline const std::string& Request::_internal_bulk_reply_to() const {
+  return _impl_.bulk_reply_to_.Get();
+}
+inline void Request::_internal_set_bulk_reply_to(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.bulk_reply_to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Request::_internal_mutable_bulk_reply_to() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  return _impl_.bulk_reply_to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Request::release_bulk_reply_to() {
+  // @@protoc_insertion_point(field_release:http.Request.bulk_reply_to)
+  if (!_internal_has_bulk_reply_to()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  auto* p = _impl_.bulk_reply_to_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bulk_reply_to_.IsDefault()) {
+    _impl_.bulk_reply_to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Request::set_allocated_bulk_reply_to(std::string* bulk_reply_to) {
+  if (bulk_reply_to != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.bulk_reply_to_.SetAllocated(bulk_reply_to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.bulk_reply_to_.IsDefault()) {
+    _impl_.bulk_reply_to_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Request.bulk_reply_to)
 }
 
-// required uint32 version_minor = 2;
-inline bool Request::has_version_minor() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// optional uint64 deadline = 11;
+inline bool Request::_internal_has_deadline() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
 }
-inline void Request::set_has_version_minor() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Request::has_deadline() const {
+  return _internal_has_deadline();
 }
-inline void Request::clear_has_version_minor() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Request::clear_deadline() {
+  _impl_.deadline_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
 }
-inline void Request::clear_version_minor() {
-  version_minor_ = 0u;
-  clear_has_version_minor();
+inline uint64_t Request::_internal_deadline() const {
+  return _impl_.deadline_;
+}
+inline uint64_t Request::deadline() const {
+  // @@protoc_insertion_point(field_get:http.Request.deadline)
+  return _internal_deadline();
 }
-inline ::google::protobuf::uint32 Request::version_minor() const {
-  return version_minor_;
+inline void Request::_internal_set_deadline(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.deadline_ = value;
 }
-inline void Request::set_version_minor(::google::protobuf::uint32 value) {
-  set_has_version_minor();
-  version_minor_ = value;
+inline void Request::set_deadline(uint64_t value) {
+  _internal_set_deadline(value);
+  // @@protoc_insertion_point(field_set:http.Request.deadline)
 }
 
-// required uint32 stream_id = 8;
-inline bool Request::has_stream_id() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+// -------------------------------------------------------------------
+
+// Response
+
+// required uint64 stream_id = 1;
+inline bool Response::_internal_has_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Response::has_stream_id() const {
+  return _internal_has_stream_id();
 }
-inline void Request::set_has_stream_id() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Response::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Request::clear_has_stream_id() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint64_t Response::_internal_stream_id() const {
+  return _impl_.stream_id_;
 }
-inline void Request::clear_stream_id() {
-  stream_id_ = 0u;
-  clear_has_stream_id();
+inline uint64_t Response::stream_id() const {
+  // @@protoc_insertion_point(field_get:http.Response.stream_id)
+  return _internal_stream_id();
 }
-inline ::google::protobuf::uint32 Request::stream_id() const {
-  return stream_id_;
+inline void Response::_internal_set_stream_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.stream_id_ = value;
 }
-inline void Request::set_stream_id(::google::protobuf::uint32 value) {
-  set_has_stream_id();
-  stream_id_ = value;
+inline void Response::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:http.Response.stream_id)
 }
 
-// optional .http.Request.Method method = 3;
-inline bool Request::has_method() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// required uint32 status = 2;
+inline bool Response::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Request::set_has_method() {
-  _has_bits_[0] |= 0x00000008u;
+inline bool Response::has_status() const {
+  return _internal_has_status();
 }
-inline void Request::clear_has_method() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void Response::clear_status() {
+  _impl_.status_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Request::clear_method() {
-  method_ = 0;
-  clear_has_method();
+inline uint32_t Response::_internal_status() const {
+  return _impl_.status_;
 }
-inline ::http::Request_Method Request::method() const {
-  return static_cast< ::http::Request_Method >(method_);
+inline uint32_t Response::status() const {
+  // @@protoc_insertion_point(field_get:http.Response.status)
+  return _internal_status();
 }
-inline void Request::set_method(::http::Request_Method value) {
-  assert(::http::Request_Method_IsValid(value));
-  set_has_method();
-  method_ = value;
+inline void Response::_internal_set_status(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.status_ = value;
+}
+inline void Response::set_status(uint32_t value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:http.Response.status)
 }
 
-// optional string custom_method = 4;
-inline bool Request::has_custom_method() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+// repeated .http.Header headers = 3;
+inline int Response::_internal_headers_size() const {
+  return _impl_.headers_.size();
 }
-inline void Request::set_has_custom_method() {
-  _has_bits_[0] |= 0x00000010u;
+inline int Response::headers_size() const {
+  return _internal_headers_size();
 }
-inline void Request::clear_has_custom_method() {
-  _has_bits_[0] &= ~0x00000010u;
+inline void Response::clear_headers() {
+  _impl_.headers_.Clear();
 }
-inline void Request::clear_custom_method() {
-  if (custom_method_ != &::google::protobuf::internal::kEmptyString) {
-    custom_method_->clear();
-  }
-  clear_has_custom_method();
+inline ::http::Header* Response::mutable_headers(int index) {
+  // @@protoc_insertion_point(field_mutable:http.Response.headers)
+  return _impl_.headers_.Mutable(index);
 }
-inline const ::std::string& Request::custom_method() const {
-  return *custom_method_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >*
+Response::mutable_headers() {
+  // @@protoc_insertion_point(field_mutable_list:http.Response.headers)
+  return &_impl_.headers_;
 }
-inline void Request::set_custom_method(const ::std::string& value) {
-  set_has_custom_method();
-  if (custom_method_ == &::google::protobuf::internal::kEmptyString) {
-    custom_method_ = new ::std::string;
-  }
-  custom_method_->assign(value);
+inline const ::http::Header& Response::_internal_headers(int index) const {
+  return _impl_.headers_.Get(index);
 }
-inline void Request::set_custom_method(const char* value) {
-  set_has_custom_method();
-  if (custom_method_ == &::google::protobuf::internal::kEmptyString) {
-    custom_method_ = new ::std::string;
-  }
-  custom_method_->assign(value);
+inline const ::http::Header& Response::headers(int index) const {
+  // @@protoc_insertion_point(field_get:http.Response.headers)
+  return _internal_headers(index);
 }
-inline void Request::set_custom_method(const char* value, size_t size) {
-  set_has_custom_method();
-  if (custom_method_ == &::google::protobuf::internal::kEmptyString) {
-    custom_method_ = new ::std::string;
-  }
-  custom_method_->assign(reinterpret_cast<const char*>(value), size);
+inline ::http::Header* Response::_internal_add_headers() {
+  return _impl_.headers_.Add();
 }
-inline ::std::string* Request::mutable_custom_method() {
-  set_has_custom_method();
-  if (custom_method_ == &::google::protobuf::internal::kEmptyString) {
-    custom_method_ = new ::std::string;
-  }
-  return custom_method_;
+inline ::http::Header* Response::add_headers() {
+  ::http::Header* _add = _internal_add_headers();
+  // @@protoc_insertion_point(field_add:http.Response.headers)
+  return _add;
 }
-inline ::std::string* Request::release_custom_method() {
-  clear_has_custom_method();
-  if (custom_method_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = custom_method_;
-    custom_method_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::http::Header >&
+Response::headers() const {
+  // @@protoc_insertion_point(field_list:http.Response.headers)
+  return _impl_.headers_;
 }
-inline void Request::set_allocated_custom_method(::std::string* custom_method) {
-  if (custom_method_ != &::google::protobuf::internal::kEmptyString) {
-    delete custom_method_;
-  }
-  if (custom_method) {
-    set_has_custom_method();
-    custom_method_ = custom_method;
+
+// optional bytes body = 4;
+inline bool Response::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Response::has_body() const {
+  return _internal_has_body();
+}
+inline void Response::clear_body() {
+  _impl_.body_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Response::body() const {
+  // @@protoc_insertion_point(field_get:http.Response.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_body(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.Response.body)
+}
+inline std::string* Response::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:http.Response.body)
+  return _s;
+}
+inline const std::string& Response::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void Response::_internal_set_body(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_body() {
+  // @@protoc_insertion_point(field_release:http.Response.body)
+  if (!_internal_has_body()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.body_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Response::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_custom_method();
-    custom_method_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.Response.body)
 }
 
-// required string url = 5;
-inline bool Request::has_url() const {
-  return (_has_bits_[0] & 0x00000020u) != 0;
+// optional bool streamed = 5;
+inline bool Response::_internal_has_streamed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
 }
-inline void Request::set_has_url() {
-  _has_bits_[0] |= 0x00000020u;
+inline bool Response::has_streamed() const {
+  return _internal_has_streamed();
 }
-inline void Request::clear_has_url() {
-  _has_bits_[0] &= ~0x00000020u;
+inline void Response::clear_streamed() {
+  _impl_.streamed_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Request::clear_url() {
-  if (url_ != &::google::protobuf::internal::kEmptyString) {
-    url_->clear();
-  }
-  clear_has_url();
+inline bool Response::_internal_streamed() const {
+  return _impl_.streamed_;
 }
-inline const ::std::string& Request::url() const {
-  return *url_;
+inline bool Response::streamed() const {
+  // @@protoc_insertion_point(field_get:http.Response.streamed)
+  return _internal_streamed();
 }
-inline void Request::set_url(const ::std::string& value) {
-  set_has_url();
-  if (url_ == &::google::protobuf::internal::kEmptyString) {
-    url_ = new ::std::string;
-  }
-  url_->assign(value);
+inline void Response::_internal_set_streamed(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.streamed_ = value;
 }
-inline void Request::set_url(const char* value) {
-  set_has_url();
-  if (url_ == &::google::protobuf::internal::kEmptyString) {
-    url_ = new ::std::string;
-  }
-  url_->assign(value);
+inline void Response::set_streamed(bool value) {
+  _internal_set_streamed(value);
+  // @@protoc_insertion_point(field_set:http.Response.streamed)
 }
-inline void Request::set_url(const char* value, size_t size) {
-  set_has_url();
-  if (url_ == &::google::protobuf::internal::kEmptyString) {
-    url_ = new ::std::string;
-  }
-  url_->assign(reinterpret_cast<const char*>(value), size);
+
+// -------------------------------------------------------------------
+
+// ResponseChunk
+
+// required uint64 stream_id = 1;
+inline bool ResponseChunk::_internal_has_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline ::std::string* Request::mutable_url() {
-  set_has_url();
-  if (url_ == &::google::protobuf::internal::kEmptyString) {
-    url_ = new ::std::string;
-  }
-  return url_;
+inline bool ResponseChunk::has_stream_id() const {
+  return _internal_has_stream_id();
 }
-inline ::std::string* Request::release_url() {
-  clear_has_url();
-  if (url_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = url_;
-    url_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void ResponseChunk::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Request::set_allocated_url(::std::string* url) {
-  if (url_ != &::google::protobuf::internal::kEmptyString) {
-    delete url_;
-  }
-  if (url) {
-    set_has_url();
-    url_ = url;
+inline uint64_t ResponseChunk::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint64_t ResponseChunk::stream_id() const {
+  // @@protoc_insertion_point(field_get:http.ResponseChunk.stream_id)
+  return _internal_stream_id();
+}
+inline void ResponseChunk::_internal_set_stream_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.stream_id_ = value;
+}
+inline void ResponseChunk::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:http.ResponseChunk.stream_id)
+}
+
+// optional bytes body = 4;
+inline bool ResponseChunk::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResponseChunk::has_body() const {
+  return _internal_has_body();
+}
+inline void ResponseChunk::clear_body() {
+  _impl_.body_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ResponseChunk::body() const {
+  // @@protoc_insertion_point(field_get:http.ResponseChunk.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResponseChunk::set_body(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.ResponseChunk.body)
+}
+inline std::string* ResponseChunk::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:http.ResponseChunk.body)
+  return _s;
+}
+inline const std::string& ResponseChunk::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void ResponseChunk::_internal_set_body(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResponseChunk::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResponseChunk::release_body() {
+  // @@protoc_insertion_point(field_release:http.ResponseChunk.body)
+  if (!_internal_has_body()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.body_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ResponseChunk::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    clear_has_url();
-    url_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.ResponseChunk.body)
 }
 
-// repeated .http.Header headers = 6;
-inline int Request::headers_size() const {
-  return headers_.size();
+// optional bool end = 5;
+inline bool ResponseChunk::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void Request::clear_headers() {
-  headers_.Clear();
+inline bool ResponseChunk::has_end() const {
+  return _internal_has_end();
 }
-inline const ::http::Header& Request::headers(int index) const {
-  return headers_.Get(index);
+inline void ResponseChunk::clear_end() {
+  _impl_.end_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline ::http::Header* Request::mutable_headers(int index) {
-  return headers_.Mutable(index);
+inline bool ResponseChunk::_internal_end() const {
+  return _impl_.end_;
 }
-inline ::http::Header* Request::add_headers() {
-  return headers_.Add();
+inline bool ResponseChunk::end() const {
+  // @@protoc_insertion_point(field_get:http.ResponseChunk.end)
+  return _internal_end();
 }
-inline const ::google::protobuf::RepeatedPtrField< ::http::Header >&
-Request::headers() const {
-  return headers_;
+inline void ResponseChunk::_internal_set_end(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.end_ = value;
 }
-inline ::google::protobuf::RepeatedPtrField< ::http::Header >*
-Request::mutable_headers() {
-  return &headers_;
+inline void ResponseChunk::set_end(bool value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:http.ResponseChunk.end)
 }
 
-// optional bytes body = 7;
-inline bool Request::has_body() const {
-  return (_has_bits_[0] & 0x00000080u) != 0;
+// -------------------------------------------------------------------
+
+// RequestBatch
+
+// repeated bytes requests = 1;
+inline int RequestBatch::_internal_requests_size() const {
+  return _impl_.requests_.size();
 }
-inline void Request::set_has_body() {
-  _has_bits_[0] |= 0x00000080u;
+inline int RequestBatch::requests_size() const {
+  return _internal_requests_size();
 }
-inline void Request::clear_has_body() {
-  _has_bits_[0] &= ~0x00000080u;
+inline void RequestBatch::clear_requests() {
+  _impl_.requests_.Clear();
 }
-inline void Request::clear_body() {
-  if (body_ != &::google::protobuf::internal::kEmptyString) {
-    body_->clear();
-  }
-  clear_has_body();
+inline std::string* RequestBatch::add_requests() {
+  std::string* _s = _internal_add_requests();
+  // @@protoc_insertion_point(field_add_mutable:http.RequestBatch.requests)
+  return _s;
 }
-inline const ::std::string& Request::body() const {
-  return *body_;
+inline const std::string& RequestBatch::_internal_requests(int index) const {
+  return _impl_.requests_.Get(index);
 }
-inline void Request::set_body(const ::std::string& value) {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
-  }
-  body_->assign(value);
+inline const std::string& RequestBatch::requests(int index) const {
+  // @@protoc_insertion_point(field_get:http.RequestBatch.requests)
+  return _internal_requests(index);
 }
-inline void Request::set_body(const char* value) {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
-  }
-  body_->assign(value);
+inline std::string* RequestBatch::mutable_requests(int index) {
+  // @@protoc_insertion_point(field_mutable:http.RequestBatch.requests)
+  return _impl_.requests_.Mutable(index);
 }
-inline void Request::set_body(const void* value, size_t size) {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
-  }
-  body_->assign(reinterpret_cast<const char*>(value), size);
+inline void RequestBatch::set_requests(int index, const std::string& value) {
+  _impl_.requests_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:http.RequestBatch.requests)
 }
-inline ::std::string* Request::mutable_body() {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
-  }
-  return body_;
+inline void RequestBatch::set_requests(int index, std::string&& value) {
+  _impl_.requests_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:http.RequestBatch.requests)
 }
-inline ::std::string* Request::release_body() {
-  clear_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
-  } else {
-    ::std::string* temp = body_;
-    body_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
+inline void RequestBatch::set_requests(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.requests_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:http.RequestBatch.requests)
 }
-inline void Request::set_allocated_body(::std::string* body) {
-  if (body_ != &::google::protobuf::internal::kEmptyString) {
-    delete body_;
-  }
-  if (body) {
-    set_has_body();
-    body_ = body;
-  } else {
-    clear_has_body();
-    body_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  }
+inline void RequestBatch::set_requests(int index, const void* value, size_t size) {
+  _impl_.requests_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:http.RequestBatch.requests)
+}
+inline std::string* RequestBatch::_internal_add_requests() {
+  return _impl_.requests_.Add();
+}
+inline void RequestBatch::add_requests(const std::string& value) {
+  _impl_.requests_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:http.RequestBatch.requests)
+}
+inline void RequestBatch::add_requests(std::string&& value) {
+  _impl_.requests_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:http.RequestBatch.requests)
+}
+inline void RequestBatch::add_requests(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.requests_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:http.RequestBatch.requests)
+}
+inline void RequestBatch::add_requests(const void* value, size_t size) {
+  _impl_.requests_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:http.RequestBatch.requests)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+RequestBatch::requests() const {
+  // @@protoc_insertion_point(field_list:http.RequestBatch.requests)
+  return _impl_.requests_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+RequestBatch::mutable_requests() {
+  // @@protoc_insertion_point(field_mutable_list:http.RequestBatch.requests)
+  return &_impl_.requests_;
 }
 
 // -------------------------------------------------------------------
 
-// Response
+// ResponseBatch
 
-// required uint32 stream_id = 1;
-inline bool Response::has_stream_id() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+// repeated bytes responses = 1;
+inline int ResponseBatch::_internal_responses_size() const {
+  return _impl_.responses_.size();
 }
-inline void Response::set_has_stream_id() {
-  _has_bits_[0] |= 0x00000001u;
+inline int ResponseBatch::responses_size() const {
+  return _internal_responses_size();
 }
-inline void Response::clear_has_stream_id() {
-  _has_bits_[0] &= ~0x00000001u;
+inline void ResponseBatch::clear_responses() {
+  _impl_.responses_.Clear();
 }
-inline void Response::clear_stream_id() {
-  stream_id_ = 0u;
-  clear_has_stream_id();
+inline std::string* ResponseBatch::add_responses() {
+  std::string* _s = _internal_add_responses();
+  // @@protoc_insertion_point(field_add_mutable:http.ResponseBatch.responses)
+  return _s;
+}
+inline const std::string& ResponseBatch::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const std::string& ResponseBatch::responses(int index) const {
+  // @@protoc_insertion_point(field_get:http.ResponseBatch.responses)
+  return _internal_responses(index);
+}
+inline std::string* ResponseBatch::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:http.ResponseBatch.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline void ResponseBatch::set_responses(int index, const std::string& value) {
+  _impl_.responses_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:http.ResponseBatch.responses)
+}
+inline void ResponseBatch::set_responses(int index, std::string&& value) {
+  _impl_.responses_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:http.ResponseBatch.responses)
 }
-inline ::google::protobuf::uint32 Response::stream_id() const {
-  return stream_id_;
+inline void ResponseBatch::set_responses(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.responses_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:http.ResponseBatch.responses)
 }
-inline void Response::set_stream_id(::google::protobuf::uint32 value) {
-  set_has_stream_id();
-  stream_id_ = value;
+inline void ResponseBatch::set_responses(int index, const void* value, size_t size) {
+  _impl_.responses_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:http.ResponseBatch.responses)
+}
+inline std::string* ResponseBatch::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline void ResponseBatch::add_responses(const std::string& value) {
+  _impl_.responses_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:http.ResponseBatch.responses)
+}
+inline void ResponseBatch::add_responses(std::string&& value) {
+  _impl_.responses_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:http.ResponseBatch.responses)
+}
+inline void ResponseBatch::add_responses(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.responses_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:http.ResponseBatch.responses)
+}
+inline void ResponseBatch::add_responses(const void* value, size_t size) {
+  _impl_.responses_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:http.ResponseBatch.responses)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+ResponseBatch::responses() const {
+  // @@protoc_insertion_point(field_list:http.ResponseBatch.responses)
+  return _impl_.responses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+ResponseBatch::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:http.ResponseBatch.responses)
+  return &_impl_.responses_;
 }
 
-// required uint32 status = 2;
-inline bool Response::has_status() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+// -------------------------------------------------------------------
+
+// Cancel
+
+// repeated uint64 stream_ids = 1;
+inline int Cancel::_internal_stream_ids_size() const {
+  return _impl_.stream_ids_.size();
 }
-inline void Response::set_has_status() {
-  _has_bits_[0] |= 0x00000002u;
+inline int Cancel::stream_ids_size() const {
+  return _internal_stream_ids_size();
 }
-inline void Response::clear_has_status() {
-  _has_bits_[0] &= ~0x00000002u;
+inline void Cancel::clear_stream_ids() {
+  _impl_.stream_ids_.Clear();
 }
-inline void Response::clear_status() {
-  status_ = 0u;
-  clear_has_status();
+inline uint64_t Cancel::_internal_stream_ids(int index) const {
+  return _impl_.stream_ids_.Get(index);
+}
+inline uint64_t Cancel::stream_ids(int index) const {
+  // @@protoc_insertion_point(field_get:http.Cancel.stream_ids)
+  return _internal_stream_ids(index);
+}
+inline void Cancel::set_stream_ids(int index, uint64_t value) {
+  _impl_.stream_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:http.Cancel.stream_ids)
+}
+inline void Cancel::_internal_add_stream_ids(uint64_t value) {
+  _impl_.stream_ids_.Add(value);
 }
-inline ::google::protobuf::uint32 Response::status() const {
-  return status_;
+inline void Cancel::add_stream_ids(uint64_t value) {
+  _internal_add_stream_ids(value);
+  // @@protoc_insertion_point(field_add:http.Cancel.stream_ids)
 }
-inline void Response::set_status(::google::protobuf::uint32 value) {
-  set_has_status();
-  status_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Cancel::_internal_stream_ids() const {
+  return _impl_.stream_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Cancel::stream_ids() const {
+  // @@protoc_insertion_point(field_list:http.Cancel.stream_ids)
+  return _internal_stream_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Cancel::_internal_mutable_stream_ids() {
+  return &_impl_.stream_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Cancel::mutable_stream_ids() {
+  // @@protoc_insertion_point(field_mutable_list:http.Cancel.stream_ids)
+  return _internal_mutable_stream_ids();
 }
 
-// repeated .http.Header headers = 3;
-inline int Response::headers_size() const {
-  return headers_.size();
+// -------------------------------------------------------------------
+
+// Flow
+
+// repeated uint64 paused = 1;
+inline int Flow::_internal_paused_size() const {
+  return _impl_.paused_.size();
 }
-inline void Response::clear_headers() {
-  headers_.Clear();
+inline int Flow::paused_size() const {
+  return _internal_paused_size();
 }
-inline const ::http::Header& Response::headers(int index) const {
-  return headers_.Get(index);
+inline void Flow::clear_paused() {
+  _impl_.paused_.Clear();
 }
-inline ::http::Header* Response::mutable_headers(int index) {
-  return headers_.Mutable(index);
+inline uint64_t Flow::_internal_paused(int index) const {
+  return _impl_.paused_.Get(index);
 }
-inline ::http::Header* Response::add_headers() {
-  return headers_.Add();
+inline uint64_t Flow::paused(int index) const {
+  // @@protoc_insertion_point(field_get:http.Flow.paused)
+  return _internal_paused(index);
 }
-inline const ::google::protobuf::RepeatedPtrField< ::http::Header >&
-Response::headers() const {
-  return headers_;
+inline void Flow::set_paused(int index, uint64_t value) {
+  _impl_.paused_.Set(index, value);
+  // @@protoc_insertion_point(field_set:http.Flow.paused)
 }
-inline ::google::protobuf::RepeatedPtrField< ::http::Header >*
-Response::mutable_headers() {
-  return &headers_;
+inline void Flow::_internal_add_paused(uint64_t value) {
+  _impl_.paused_.Add(value);
+}
+inline void Flow::add_paused(uint64_t value) {
+  _internal_add_paused(value);
+  // @@protoc_insertion_point(field_add:http.Flow.paused)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Flow::_internal_paused() const {
+  return _impl_.paused_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Flow::paused() const {
+  // @@protoc_insertion_point(field_list:http.Flow.paused)
+  return _internal_paused();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Flow::_internal_mutable_paused() {
+  return &_impl_.paused_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Flow::mutable_paused() {
+  // @@protoc_insertion_point(field_mutable_list:http.Flow.paused)
+  return _internal_mutable_paused();
 }
 
-// optional bytes body = 4;
-inline bool Response::has_body() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+// repeated uint64 resumed = 2;
+inline int Flow::_internal_resumed_size() const {
+  return _impl_.resumed_.size();
 }
-inline void Response::set_has_body() {
-  _has_bits_[0] |= 0x00000008u;
+inline int Flow::resumed_size() const {
+  return _internal_resumed_size();
 }
-inline void Response::clear_has_body() {
-  _has_bits_[0] &= ~0x00000008u;
+inline void Flow::clear_resumed() {
+  _impl_.resumed_.Clear();
 }
-inline void Response::clear_body() {
-  if (body_ != &::google::protobuf::internal::kEmptyString) {
-    body_->clear();
-  }
-  clear_has_body();
+inline uint64_t Flow::_internal_resumed(int index) const {
+  return _impl_.resumed_.Get(index);
 }
-inline const ::std::string& Response::body() const {
-  return *body_;
+inline uint64_t Flow::resumed(int index) const {
+  // @@protoc_insertion_point(field_get:http.Flow.resumed)
+  return _internal_resumed(index);
 }
-inline void Response::set_body(const ::std::string& value) {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
-  }
-  body_->assign(value);
+inline void Flow::set_resumed(int index, uint64_t value) {
+  _impl_.resumed_.Set(index, value);
+  // @@protoc_insertion_point(field_set:http.Flow.resumed)
 }
-inline void Response::set_body(const char* value) {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
-  }
-  body_->assign(value);
+inline void Flow::_internal_add_resumed(uint64_t value) {
+  _impl_.resumed_.Add(value);
+}
+inline void Flow::add_resumed(uint64_t value) {
+  _internal_add_resumed(value);
+  // @@protoc_insertion_point(field_add:http.Flow.resumed)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Flow::_internal_resumed() const {
+  return _impl_.resumed_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Flow::resumed() const {
+  // @@protoc_insertion_point(field_list:http.Flow.resumed)
+  return _internal_resumed();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Flow::_internal_mutable_resumed() {
+  return &_impl_.resumed_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Flow::mutable_resumed() {
+  // @@protoc_insertion_point(field_mutable_list:http.Flow.resumed)
+  return _internal_mutable_resumed();
+}
+
+// -------------------------------------------------------------------
+
+// SocketMessage
+
+// required uint64 stream_id = 1;
+inline bool SocketMessage::_internal_has_stream_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SocketMessage::has_stream_id() const {
+  return _internal_has_stream_id();
+}
+inline void SocketMessage::clear_stream_id() {
+  _impl_.stream_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SocketMessage::_internal_stream_id() const {
+  return _impl_.stream_id_;
+}
+inline uint64_t SocketMessage::stream_id() const {
+  // @@protoc_insertion_point(field_get:http.SocketMessage.stream_id)
+  return _internal_stream_id();
+}
+inline void SocketMessage::_internal_set_stream_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.stream_id_ = value;
+}
+inline void SocketMessage::set_stream_id(uint64_t value) {
+  _internal_set_stream_id(value);
+  // @@protoc_insertion_point(field_set:http.SocketMessage.stream_id)
+}
+
+// optional string reply_to = 2;
+inline bool SocketMessage::_internal_has_reply_to() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SocketMessage::has_reply_to() const {
+  return _internal_has_reply_to();
+}
+inline void SocketMessage::clear_reply_to() {
+  _impl_.reply_to_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SocketMessage::reply_to() const {
+  // @@protoc_insertion_point(field_get:http.SocketMessage.reply_to)
+  return _internal_reply_to();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SocketMessage::set_reply_to(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.reply_to_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.SocketMessage.reply_to)
+}
+inline std::string* SocketMessage::mutable_reply_to() {
+  std::string* _s = _internal_mutable_reply_to();
+  // @@protoc_insertion_point(field_mutable:http.SocketMessage.reply_to)
+  return _s;
 }
-inline void Response::set_body(const void* value, size_t size) {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
+inline const std::string& SocketMessage::_internal_reply_to() const {
+  return _impl_.reply_to_.Get();
+}
+inline void SocketMessage::_internal_set_reply_to(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.reply_to_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SocketMessage::_internal_mutable_reply_to() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.reply_to_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SocketMessage::release_reply_to() {
+  // @@protoc_insertion_point(field_release:http.SocketMessage.reply_to)
+  if (!_internal_has_reply_to()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.reply_to_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_to_.IsDefault()) {
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
   }
-  body_->assign(reinterpret_cast<const char*>(value), size);
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::std::string* Response::mutable_body() {
-  set_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    body_ = new ::std::string;
+inline void SocketMessage::set_allocated_reply_to(std::string* reply_to) {
+  if (reply_to != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.reply_to_.SetAllocated(reply_to, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.reply_to_.IsDefault()) {
+    _impl_.reply_to_.Set("", GetArenaForAllocation());
   }
-  return body_;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.SocketMessage.reply_to)
+}
+
+// optional bool binary = 3;
+inline bool SocketMessage::_internal_has_binary() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
 }
-inline ::std::string* Response::release_body() {
-  clear_has_body();
-  if (body_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+inline bool SocketMessage::has_binary() const {
+  return _internal_has_binary();
+}
+inline void SocketMessage::clear_binary() {
+  _impl_.binary_ = false;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline bool SocketMessage::_internal_binary() const {
+  return _impl_.binary_;
+}
+inline bool SocketMessage::binary() const {
+  // @@protoc_insertion_point(field_get:http.SocketMessage.binary)
+  return _internal_binary();
+}
+inline void SocketMessage::_internal_set_binary(bool value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.binary_ = value;
+}
+inline void SocketMessage::set_binary(bool value) {
+  _internal_set_binary(value);
+  // @@protoc_insertion_point(field_set:http.SocketMessage.binary)
+}
+
+// optional bytes body = 4;
+inline bool SocketMessage::_internal_has_body() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SocketMessage::has_body() const {
+  return _internal_has_body();
+}
+inline void SocketMessage::clear_body() {
+  _impl_.body_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SocketMessage::body() const {
+  // @@protoc_insertion_point(field_get:http.SocketMessage.body)
+  return _internal_body();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SocketMessage::set_body(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.body_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:http.SocketMessage.body)
+}
+inline std::string* SocketMessage::mutable_body() {
+  std::string* _s = _internal_mutable_body();
+  // @@protoc_insertion_point(field_mutable:http.SocketMessage.body)
+  return _s;
+}
+inline const std::string& SocketMessage::_internal_body() const {
+  return _impl_.body_.Get();
+}
+inline void SocketMessage::_internal_set_body(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.body_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SocketMessage::_internal_mutable_body() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.body_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SocketMessage::release_body() {
+  // @@protoc_insertion_point(field_release:http.SocketMessage.body)
+  if (!_internal_has_body()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.body_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SocketMessage::set_allocated_body(std::string* body) {
+  if (body != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = body_;
-    body_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
+  _impl_.body_.SetAllocated(body, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.body_.IsDefault()) {
+    _impl_.body_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:http.SocketMessage.body)
+}
+
+// optional bool end = 5;
+inline bool SocketMessage::_internal_has_end() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SocketMessage::has_end() const {
+  return _internal_has_end();
+}
+inline void SocketMessage::clear_end() {
+  _impl_.end_ = false;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline bool SocketMessage::_internal_end() const {
+  return _impl_.end_;
+}
+inline bool SocketMessage::end() const {
+  // @@protoc_insertion_point(field_get:http.SocketMessage.end)
+  return _internal_end();
+}
+inline void SocketMessage::_internal_set_end(bool value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.end_ = value;
 }
-inline void Response::set_allocated_body(::std::string* body) {
-  if (body_ != &::google::protobuf::internal::kEmptyString) {
-    delete body_;
+inline void SocketMessage::set_end(bool value) {
+  _internal_set_end(value);
+  // @@protoc_insertion_point(field_set:http.SocketMessage.end)
+}
+
+// optional .http.Request request = 6;
+inline bool SocketMessage::_internal_has_request() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.request_ != nullptr);
+  return value;
+}
+inline bool SocketMessage::has_request() const {
+  return _internal_has_request();
+}
+inline void SocketMessage::clear_request() {
+  if (_impl_.request_ != nullptr) _impl_.request_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::http::Request& SocketMessage::_internal_request() const {
+  const ::http::Request* p = _impl_.request_;
+  return p != nullptr ? *p : reinterpret_cast<const ::http::Request&>(
+      ::http::_Request_default_instance_);
+}
+inline const ::http::Request& SocketMessage::request() const {
+  // @@protoc_insertion_point(field_get:http.SocketMessage.request)
+  return _internal_request();
+}
+inline void SocketMessage::unsafe_arena_set_allocated_request(
+    ::http::Request* request) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.request_);
   }
-  if (body) {
-    set_has_body();
-    body_ = body;
+  _impl_.request_ = request;
+  if (request) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:http.SocketMessage.request)
+}
+inline ::http::Request* SocketMessage::release_request() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::http::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::http::Request* SocketMessage::unsafe_arena_release_request() {
+  // @@protoc_insertion_point(field_release:http.SocketMessage.request)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::http::Request* temp = _impl_.request_;
+  _impl_.request_ = nullptr;
+  return temp;
+}
+inline ::http::Request* SocketMessage::_internal_mutable_request() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.request_ == nullptr) {
+    auto* p = CreateMaybeMessage<::http::Request>(GetArenaForAllocation());
+    _impl_.request_ = p;
+  }
+  return _impl_.request_;
+}
+inline ::http::Request* SocketMessage::mutable_request() {
+  ::http::Request* _msg = _internal_mutable_request();
+  // @@protoc_insertion_point(field_mutable:http.SocketMessage.request)
+  return _msg;
+}
+inline void SocketMessage::set_allocated_request(::http::Request* request) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.request_;
+  }
+  if (request) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(request);
+    if (message_arena != submessage_arena) {
+      request = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, request, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
   } else {
-    clear_has_body();
-    body_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+    _impl_._has_bits_[0] &= ~0x00000004u;
   }
+  _impl_.request_ = request;
+  // @@protoc_insertion_point(field_set_allocated:http.SocketMessage.request)
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace http
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::http::Header_Key> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::http::Header_Key>() {
   return ::http::Header_Key_descriptor();
 }
+template <> struct is_proto_enum< ::http::Request_Method> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::http::Request_Method>() {
   return ::http::Request_Method_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_http_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_http_2eproto
@@ -0,0 +1,75 @@
+#include "limiter.hpp"
+
+#include <math.h>
+
+static const double cInitialLimit = 20;
+static const double cMinLimit = 4;
+
+// Weights of a new sample in the fast and slow averages.
+static const double cFastWeight = 0.1;
+static const double cSlowWeight = 1.0 / 500;
+
+// How far the fast average may exceed the slow one before the limit
+// starts coming down.
+static const double cTolerance = 1.5;
+
+// How much of each recomputed limit is applied at once.
+static const double cSmoothing = 0.2;
+
+Limiter::Limiter()
+  : enabled_(false)
+  , limit_(cInitialLimit)
+  , min_limit_(cMinLimit)
+  , max_limit_(cInitialLimit)
+  , rtt_(0)
+  , rtt_noload_(0)
+  , inflight_(0)
+{}
+
+void Limiter::enable(int max_limit) {
+  enabled_ = true;
+  max_limit_ = max_limit;
+
+  if(min_limit_ > max_limit_) min_limit_ = max_limit_;
+  if(limit_ > max_limit_) limit_ = max_limit_;
+}
+
+bool Limiter::acquire() {
+  if(enabled_ && inflight_ >= (int)limit_) return false;
+
+  inflight_++;
+  return true;
+}
+
+void Limiter::release(double rtt) {
+  inflight_--;
+
+  if(!enabled_ || rtt < 0) return;
+
+  if(rtt_ == 0) {
+    rtt_ = rtt_noload_ = rtt;
+    return;
+  }
+
+  rtt_ += (rtt - rtt_) * cFastWeight;
+  rtt_noload_ += (rtt - rtt_noload_) * cSlowWeight;
+
+  // A sustained shift in load (or a better worker pool) drags the slow
+  // average along eventually, but it shouldn't take forever to adapt
+  // once latency settles somewhere much lower.
+  if(rtt_noload_ > rtt_ * 2) rtt_noload_ *= 0.95;
+
+  double gradient = cTolerance * rtt_noload_ / rtt_;
+  if(gradient > 1.0) gradient = 1.0;
+  if(gradient < 0.5) gradient = 0.5;
+
+  double next = limit_ * gradient + sqrt(limit_);
+
+  // Don't grow the limit while it isn't what's holding requests back.
+  if(next > limit_ && inflight_ < limit_ / 2) return;
+
+  limit_ = limit_ * (1 - cSmoothing) + next * cSmoothing;
+
+  if(limit_ < min_limit_) limit_ = min_limit_;
+  if(limit_ > max_limit_) limit_ = max_limit_;
+}
@@ -0,0 +1,53 @@
+#ifndef LIMITER_HPP
+#define LIMITER_HPP
+
+// An adaptive cap on requests outstanding at the broker, after the
+// gradient approach: a fast moving average of reply RTTs is compared to
+// a slow one standing in for the no-load RTT. While they agree the limit
+// grows by about sqrt(limit) per sample; once queueing shows up as the
+// fast average pulling away, the limit shrinks in proportion. Requests
+// over the limit are turned away at the door rather than queued.
+class Limiter {
+  bool enabled_;
+
+  double limit_;
+  double min_limit_;
+  double max_limit_;
+
+  double rtt_;        // fast EMA, seconds
+  double rtt_noload_; // slow EMA, seconds
+
+  int inflight_;
+
+public:
+  Limiter();
+
+  void enable(int max_limit);
+
+  bool enabled_p() {
+    return enabled_;
+  }
+
+  int limit() {
+    return (int)limit_;
+  }
+
+  double rtt() {
+    return rtt_;
+  }
+
+  double rtt_noload() {
+    return rtt_noload_;
+  }
+
+  int inflight() {
+    return inflight_;
+  }
+
+  bool acquire();
+
+  // rtt is negative when the request ended without a reply to time.
+  void release(double rtt);
+};
+
+#endif
@@ -4,19 +4,84 @@
 #include <string.h>
 
 #include <unistd.h>
+#include <pthread.h>
 #include <sys/socket.h>
 
 #include <iostream>
+#include <vector>
 
 #include "util.hpp"
 #include "server.hpp"
 #include "connection.hpp"
+#include "broker_thread.hpp"
+#include "cache.hpp"
 #include "config.hpp"
+#include "hot_restart.hpp"
 
 extern char *optarg;
 
 Server *server=NULL;
 
+static void* run_loop(void* arg) {
+  ((Server*)arg)->start();
+  return NULL;
+}
+
+// Settings every loop gets a copy of. Exits on a bad one.
+static void configure(Server& s, std::vector<std::string>& classes,
+                      std::vector<std::string>& routes, int max_concurrency,
+                      int breaker_threshold, const Timeouts& timeouts) {
+  for(size_t i = 0; i < classes.size(); i++) {
+    if(!s.fair_queue().add_class(classes[i])) exit(1);
+  }
+
+  for(size_t i = 0; i < routes.size(); i++) {
+    if(!s.routes().add(routes[i])) exit(1);
+  }
+
+  const std::vector<Routes::Route>& all = s.routes().all();
+
+  for(size_t i = 0; i < all.size(); i++) {
+    const std::string& cls = all[i].traffic_class;
+
+    if(!cls.empty() && s.fair_queue().find(cls) < 0) {
+      printf("Route %s uses unknown traffic class %s\n",
+             all[i].prefix.c_str(), cls.c_str());
+      exit(1);
+    }
+  }
+
+  if(max_concurrency) s.limiter().enable(max_concurrency);
+
+  s.set_breaker_threshold(breaker_threshold);
+  s.set_timeouts(timeouts);
+}
+
+// Takes the listening sockets over from an older process, if there is
+// one, and waits for the next. Done once everything else is ready, since
+// the old process stops accepting as soon as it's asked; connections wait
+// in the sockets' backlogs only until the loops start.
+static void hot_restart(HotRestart& restart, std::vector<Server*>& servers) {
+  std::vector<int> fds;
+
+  if(restart.take_over(fds)) {
+    for(size_t i = 0; i < fds.size(); i++) {
+      if(i < servers.size()) {
+        servers[i]->adopt(fds[i], restart.handed_at());
+      } else {
+        printf("More listening sockets taken over than loops, closing one\n");
+        close(fds[i]);
+      }
+    }
+  }
+
+  if(!restart.listen(servers)) exit(1);
+
+  for(size_t i = 0; i < servers.size(); i++) {
+    servers[i]->set_restart(&restart);
+  }
+}
+
 int main(int argc, char** argv) {
   bool daemon = false;
 
@@ -27,8 +92,28 @@ int main(int argc, char** argv) {
 
   std::string data_dir = "harq.db";
 
+  std::string broker_addr = "127.0.0.1:7621";
+
+  size_t bulk_threshold = 0;
+
+  size_t deflate_threshold = 0;
+  std::string dictionary = "";
+  std::string sample_path = "";
+
+  std::vector<std::string> routes;
+  std::vector<std::string> classes;
+
+  int max_concurrency = 0;
+  int breaker_threshold = 0;
+  size_t cache_budget = 0;
+  Timeouts timeouts;
+  std::string restart_path = "";
+
+  int loops = 1;
+  bool broker_thread = false;
+
   int ch = 0;
-  while((ch = getopt(argc, argv, "hDb:p:d:m:")) != -1) {
+  while((ch = getopt(argc, argv, "hDTb:p:d:m:n:q:r:w:l:B:C:L:t:U:z:Z:S:")) != -1) {
     switch(ch) {
     default:
     case 'h':
@@ -39,7 +124,40 @@ int main(int argc, char** argv) {
         << "\t-b host-ip:\t listen host\n"
         << "\t-p port:\t listen port\n"
         << "\t-d data-dir:\t data dir\n"
-        << "\t-m master:\t master\n";
+        << "\t-m master:\t master\n"
+        << "\t-n loops:\t HTTP loops (threads), implies -T when > 1\n"
+        << "\t-T:\t\t dedicated broker I/O thread\n"
+        << "\t-q broker:\t broker address, host:port or unix:/path\n"
+        << "\t\t\t (unix:@name for an abstract socket,\n"
+        << "\t\t\t  shm:/path for shared memory via a unix socket)\n"
+        << "\t-r route:\t prefix=destination[,compact][,cancel]\n"
+        << "\t\t\t [,timeout=ms][,class=name][,max_inflight=n]\n"
+        << "\t\t\t [,max_bytes=n], send requests for URLs under\n"
+        << "\t\t\t prefix to destination (repeatable)\n"
+        << "\t-w class:\t name=weight, a traffic class sharing a busy\n"
+        << "\t\t\t broker link by weight (repeatable); requests\n"
+        << "\t\t\t pick one by route or X-Traffic-Class\n"
+        << "\t-l max:\t\t adaptively limit outstanding broker requests\n"
+        << "\t\t\t (per loop) to at most max, 503ing the rest\n"
+        << "\t-B percent:\t open a destination's circuit breaker once\n"
+        << "\t\t\t this many of its recent requests failed\n"
+        << "\t-C bytes:\t cache GET responses by their Cache-Control,\n"
+        << "\t\t\t using up to this much memory\n"
+        << "\t-L bytes:\t send requests of at least this size on a\n"
+        << "\t\t\t separate bulk broker link (without -T/-n)\n"
+        << "\t-t timeouts:\t idle:header:body, seconds a client may sit\n"
+        << "\t\t\t idle between requests, take over a request's\n"
+        << "\t\t\t headers, and go between body reads; 0 for\n"
+        << "\t\t\t none (default 60:20:30)\n"
+        << "\t-U path:\t hot restart: take the listening sockets over\n"
+        << "\t\t\t from the process at this unix socket, if any,\n"
+        << "\t\t\t and hand them to the next one started with it\n"
+        << "\t\t\t (keep the same -n across restarts)\n"
+        << "\t-z bytes:\t deflate broker payloads of at least this size;\n"
+        << "\t\t\t the broker and workers must support it, as it's\n"
+        << "\t\t\t announced to them, not negotiated\n"
+        << "\t-Z dict:\t preset deflate dictionary file\n"
+        << "\t-S file:\t write sampled payloads to file for use with -Z\n";
 
       exit(0);
     case 'D':
@@ -61,6 +179,77 @@ int main(int argc, char** argv) {
     case 'm':
       master_port = atoi(optarg);
       break;
+    case 'n':
+      loops = atoi(optarg);
+      if(loops < 1 || loops > (1 << BrokerThread::cProducerBits)) {
+        printf("Bad loops(-n) value\n");
+        exit(1);
+      }
+      break;
+    case 'T':
+      broker_thread = true;
+      break;
+    case 'q':
+      broker_addr = optarg;
+      break;
+    case 'r':
+      routes.push_back(optarg);
+      break;
+    case 'w':
+      classes.push_back(optarg);
+      break;
+    case 'l':
+      max_concurrency = atoi(optarg);
+      if(max_concurrency < 1) {
+        printf("Bad concurrency limit(-l) value\n");
+        exit(1);
+      }
+      break;
+    case 'B':
+      breaker_threshold = atoi(optarg);
+      if(breaker_threshold < 1 || breaker_threshold > 100) {
+        printf("Bad breaker threshold(-B) value\n");
+        exit(1);
+      }
+      break;
+    case 'C':
+      cache_budget = strtoul(optarg, (char **)NULL, 10);
+      if(!cache_budget) {
+        printf("Bad cache size(-C) value\n");
+        exit(1);
+      }
+      break;
+    case 't':
+      if(sscanf(optarg, "%lf:%lf:%lf", &timeouts.idle, &timeouts.header,
+                &timeouts.body) != 3 ||
+         timeouts.idle < 0 || timeouts.header < 0 || timeouts.body < 0) {
+        printf("Bad timeouts(-t) value\n");
+        exit(1);
+      }
+      break;
+    case 'U':
+      restart_path = optarg;
+      break;
+    case 'z':
+      deflate_threshold = strtoul(optarg, (char **)NULL, 10);
+      if(!deflate_threshold) {
+        printf("Bad deflate threshold(-z) value\n");
+        exit(1);
+      }
+      break;
+    case 'Z':
+      dictionary = optarg;
+      break;
+    case 'S':
+      sample_path = optarg;
+      break;
+    case 'L':
+      bulk_threshold = strtoul(optarg, (char **)NULL, 10);
+      if(!bulk_threshold) {
+        printf("Bad bulk threshold(-L) value\n");
+        exit(1);
+      }
+      break;
     }
   }
 
@@ -85,9 +274,91 @@ int main(int argc, char** argv) {
   cfg.show();
   */
 
-  Server server(data_dir, host, port);
-  server.connect("127.0.0.1", 7621);
-  server.start();
+  ResponseCache* cache = cache_budget ? new ResponseCache(cache_budget) : 0;
+
+  HotRestart* restart = 0;
+  int instance = 0;
+
+  // Old and new processes are connected at once while the old one
+  // drains, so each needs queues and stream ids of its own.
+  if(!restart_path.empty()) {
+    restart = new HotRestart(restart_path);
+    instance = getpid();
+  }
+
+  if(loops == 1 && !broker_thread) {
+    Server server(data_dir, host, port);
+    server.set_bulk_threshold(bulk_threshold);
+    server.set_cache(cache);
+    server.set_instance(instance);
+
+    configure(server, classes, routes, max_concurrency, breaker_threshold,
+              timeouts);
+
+    if(!server.deflate().configure(deflate_threshold, dictionary)) exit(1);
+    if(!sample_path.empty() && !server.deflate().sample_to(sample_path)) {
+      exit(1);
+    }
+
+    server.connect(broker_addr);
+
+    if(restart) {
+      std::vector<Server*> servers(1, &server);
+      hot_restart(*restart, servers);
+    }
+
+    server.start();
+
+    return 0;
+  }
+
+  if(broker_addr.compare(0, 4, "shm:") == 0) {
+    printf("Shared memory links can't be used with -T or -n\n");
+    exit(1);
+  }
+
+  BrokerThread broker;
+
+  if(!broker.deflate().configure(deflate_threshold, dictionary)) exit(1);
+
+  if(!broker.connect(broker_addr, instance_queue(REPLY_QUEUE, instance))) {
+    printf("Unable to connect to broker\n");
+    exit(1);
+  }
+
+  std::vector<Server*> servers;
+
+  for(int i = 0; i < loops; i++) {
+    Server* s = new Server(data_dir, host, port);
+    s->attach(broker);
+    s->set_cache(cache);
+    s->set_instance(instance);
+
+    configure(*s, classes, routes, max_concurrency, breaker_threshold,
+              timeouts);
+
+    if(!s->deflate().configure(deflate_threshold, dictionary)) exit(1);
+
+    if(i == 0 && !sample_path.empty() &&
+       !s->deflate().sample_to(sample_path)) {
+      exit(1);
+    }
+
+    servers.push_back(s);
+  }
+
+  if(restart) hot_restart(*restart, servers);
+
+  broker.start();
+
+  // The first loop runs on the main thread and owns signal handling;
+  // when it exits, so does the process.
+  for(int i = 1; i < loops; i++) {
+    pthread_t thr;
+    pthread_create(&thr, NULL, run_loop, servers[i]);
+  }
+
+  servers[0]->start();
 
   return 0;
 }
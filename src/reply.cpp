@@ -0,0 +1,346 @@
+#include "reply.hpp"
+#include "deflate.hpp"
+#include "flags.hpp"
+#include "util.hpp"
+#include "compact.hpp"
+#include "harq.hpp"
+
+#include "http.pb.h"
+
+#include <string.h>
+
+#include <google/protobuf/io/coded_stream.h>
+
+using google::protobuf::io::CodedInputStream;
+
+enum WireType {
+  eVarint = 0,
+  eFixed64 = 1,
+  eLengthDelimited = 2,
+  eFixed32 = 5
+};
+
+// Point span at the next length-delimited field without copying it.
+static bool read_span(CodedInputStream& in,
+                      std::pair<const uint8_t*, int>& span) {
+  uint32_t len;
+  if(!in.ReadVarint32(&len)) return false;
+
+  const void* data;
+  int avail;
+
+  if(len == 0) {
+    span = std::make_pair((const uint8_t*)"", 0);
+    return true;
+  }
+
+  if(!in.GetDirectBufferPointer(&data, &avail)) return false;
+  if((uint32_t)avail < len) return false;
+
+  span = std::make_pair((const uint8_t*)data, (int)len);
+  return in.Skip(len);
+}
+
+static bool skip_field(CodedInputStream& in, uint32_t tag) {
+  uint64_t v64;
+  uint32_t v32;
+
+  switch(tag & 7) {
+  case eVarint:
+    return in.ReadVarint64(&v64);
+  case eFixed64:
+    return in.ReadLittleEndian64(&v64);
+  case eLengthDelimited:
+    if(!in.ReadVarint32(&v32)) return false;
+    return in.Skip(v32);
+  case eFixed32:
+    return in.ReadLittleEndian32(&v32);
+  default:
+    return false;
+  }
+}
+
+Reply::Reply()
+  : seg_()
+  , destination_()
+  , payload_()
+  , flags_(0)
+  , stream_id_(0)
+  , status_(0)
+  , headers_()
+  , body_()
+  , more_(false)
+  , binary_(false)
+{}
+
+// wire::Message: destination = 1, payload = 2, flags = 4
+bool Reply::parse(const Segment& seg, const uint8_t* frame, int size) {
+  seg_ = seg;
+
+  CodedInputStream in(frame, size);
+
+  bool have_payload = false;
+
+  for(;;) {
+    uint32_t tag = in.ReadTag();
+    if(tag == 0) break;
+
+    switch(tag) {
+    case (1 << 3) | eLengthDelimited:
+      if(!read_span(in, destination_)) return false;
+      break;
+    case (2 << 3) | eLengthDelimited:
+      if(!read_span(in, payload_)) return false;
+      have_payload = true;
+      break;
+    case (4 << 3) | eVarint:
+      if(!in.ReadVarint32(&flags_)) return false;
+      break;
+    default:
+      if(!skip_field(in, tag)) return false;
+    }
+  }
+
+  return have_payload && in.ConsumedEntireMessage();
+}
+
+// Replace a compressed payload with its inflated form, which lives in a
+// segment of its own. A no-op for uncompressed payloads.
+bool Reply::inflate(Deflate& deflate) {
+  if(!(flags_ & eDeflate)) return true;
+
+  Segment seg;
+  int size;
+
+  if(!deflate.inflate(payload_.first, payload_.second, seg, size)) {
+    return false;
+  }
+
+  seg_ = seg;
+  payload_ = std::make_pair((const uint8_t*)seg_.bytes(), size);
+  flags_ &= ~eDeflate;
+
+  return true;
+}
+
+// Break an eBatch payload (http::ResponseBatch: responses = 1) up into
+// one Reply per entry, each still pointing into this one's segment.
+bool Reply::split(std::vector<Reply>& out) {
+  CodedInputStream in(payload_.first, payload_.second);
+
+  Reply entry(*this);
+  entry.flags_ &= ~eBatch;
+
+  for(;;) {
+    uint32_t tag = in.ReadTag();
+    if(tag == 0) break;
+
+    if(tag != ((1 << 3) | eLengthDelimited)) {
+      if(!skip_field(in, tag)) return false;
+      continue;
+    }
+
+    if(!read_span(in, entry.payload_)) return false;
+    out.push_back(entry);
+  }
+
+  return in.ConsumedEntireMessage();
+}
+
+bool Reply::topic_p() {
+  static const int cSize = sizeof(GATEWAY_QUEUES) - 1;
+
+  return destination_.second < cSize ||
+         memcmp(destination_.first, GATEWAY_QUEUES, cSize) != 0;
+}
+
+// http::Response: stream_id = 1, status = 2, headers = 3, body = 4,
+// streamed = 5
+bool Reply::parse_response() {
+  if(flags_ & (eChunk | eSocket)) return parse_chunk();
+  if(flags_ & eCompact) return parse_compact();
+
+  CodedInputStream in(payload_.first, payload_.second);
+
+  Span span;
+  uint32_t value;
+
+  for(;;) {
+    uint32_t tag = in.ReadTag();
+    if(tag == 0) break;
+
+    switch(tag) {
+    case (1 << 3) | eVarint:
+      if(!in.ReadVarint64(&stream_id_)) return false;
+      break;
+    case (2 << 3) | eVarint:
+      if(!in.ReadVarint32(&status_)) return false;
+      break;
+    case (3 << 3) | eLengthDelimited:
+      if(!read_span(in, span)) return false;
+      headers_.push_back(span);
+      break;
+    case (4 << 3) | eLengthDelimited:
+      if(!read_span(in, body_)) return false;
+      break;
+    case (5 << 3) | eVarint:
+      if(!in.ReadVarint32(&value)) return false;
+      more_ = value != 0;
+      break;
+    default:
+      if(!skip_field(in, tag)) return false;
+    }
+  }
+
+  return in.ConsumedEntireMessage();
+}
+
+// http::ResponseChunk: stream_id = 1, body = 4, end = 5, and likewise
+// http::SocketMessage, which adds binary = 3
+bool Reply::parse_chunk() {
+  CodedInputStream in(payload_.first, payload_.second);
+
+  uint32_t value;
+  more_ = true;
+
+  for(;;) {
+    uint32_t tag = in.ReadTag();
+    if(tag == 0) break;
+
+    switch(tag) {
+    case (1 << 3) | eVarint:
+      if(!in.ReadVarint64(&stream_id_)) return false;
+      break;
+    case (3 << 3) | eVarint:
+      if(!in.ReadVarint32(&value)) return false;
+      binary_ = value != 0;
+      break;
+    case (4 << 3) | eLengthDelimited:
+      if(!read_span(in, body_)) return false;
+      break;
+    case (5 << 3) | eVarint:
+      if(!in.ReadVarint32(&value)) return false;
+      more_ = value == 0;
+      break;
+    default:
+      if(!skip_field(in, tag)) return false;
+    }
+  }
+
+  return in.ConsumedEntireMessage();
+}
+
+// Read the compact span at p, checking it lies within the payload.
+bool Reply::compact_span(const uint8_t* p, Span& span) {
+  uint32_t off = compact_get32(p);
+  uint32_t size = compact_get32(p + 4);
+
+  if(off > (uint32_t)payload_.second ||
+     size > (uint32_t)payload_.second - off) {
+    return false;
+  }
+
+  span = std::make_pair(payload_.first + off, (int)size);
+  return true;
+}
+
+// See compact.hpp for the layout. Every span is checked here, so header()
+// can trust the table afterwards.
+bool Reply::parse_compact() {
+  const uint8_t* p = payload_.first;
+
+  if(payload_.second < cCompactResponseSize ||
+     p[0] != 'H' || p[1] != 'C' || p[2] != cCompactVersion ||
+     p[3] != eCompactResponse) {
+    return false;
+  }
+
+  stream_id_ = compact_get32(p + 4) |
+               (uint64_t)compact_get32(p + 20) << 32;
+
+  status_ = compact_get16(p + 8);
+
+  int count = compact_get16(p + 10);
+
+  if(!compact_span(p + 12, body_)) return false;
+
+  if(cCompactResponseSize + count * cCompactHeaderSize > payload_.second) {
+    return false;
+  }
+
+  Span span;
+
+  for(int i = 0; i < count; i++) {
+    const uint8_t* entry = p + cCompactResponseSize + i * cCompactHeaderSize;
+
+    if(!compact_span(entry + 4, span) || !compact_span(entry + 12, span)) {
+      return false;
+    }
+
+    headers_.push_back(std::make_pair(entry, cCompactHeaderSize));
+  }
+
+  return true;
+}
+
+// http::Header: key = 1, custom_key = 2, value = 3
+bool Reply::header(int i, Header& out) {
+  if(flags_ & eCompact) {
+    const uint8_t* entry = headers_[i].first;
+    Span name, value;
+
+    compact_span(entry + 4, name);
+    compact_span(entry + 12, value);
+
+    uint16_t key = compact_get16(entry);
+
+    out.key = key == cCompactCustomKey ? -1 : key;
+    out.name = (const char*)name.first;
+    out.name_size = name.second;
+    out.value = (const char*)value.first;
+    out.value_size = value.second;
+
+    return true;
+  }
+
+  CodedInputStream in(headers_[i].first, headers_[i].second);
+
+  out.key = -1;
+  out.name = "";
+  out.name_size = 0;
+  out.value = "";
+  out.value_size = 0;
+
+  Span span;
+  uint32_t key;
+
+  for(;;) {
+    uint32_t tag = in.ReadTag();
+    if(tag == 0) break;
+
+    switch(tag) {
+    case (1 << 3) | eVarint:
+      if(!in.ReadVarint32(&key)) return false;
+      out.key = key;
+      out.name = header_key_name(key);
+      out.name_size = strlen(out.name);
+      break;
+    case (2 << 3) | eLengthDelimited:
+      if(!read_span(in, span)) return false;
+      if(out.key == -1) {
+        out.name = (const char*)span.first;
+        out.name_size = span.second;
+      }
+      break;
+    case (3 << 3) | eLengthDelimited:
+      if(!read_span(in, span)) return false;
+      out.value = (const char*)span.first;
+      out.value_size = span.second;
+      break;
+    default:
+      if(!skip_field(in, tag)) return false;
+    }
+  }
+
+  return in.ConsumedEntireMessage();
+}
@@ -0,0 +1,121 @@
+#ifndef REPLY_HPP
+#define REPLY_HPP
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "segment.hpp"
+
+class Deflate;
+
+// A broker reply decoded in place from the frame it arrived in.
+//
+// parse() only walks the wire::Message envelope and parse_response() only
+// walks the top level of the http::Response inside it; nothing is copied
+// and no protobuf objects are built. Headers are decoded one at a time on
+// request and the body is left where it is, so it can be written to the
+// client straight out of the read segment this Reply holds a reference to.
+// A payload flagged eCompact is read through its offset table instead,
+// one flagged eChunk is an http::ResponseChunk continuing a streamed
+// reply, and one flagged eSocket an http::SocketMessage, which shares its
+// layout.
+class Reply {
+public:
+  struct Header {
+    int key;               // http::Header_Key, or -1 for a custom key
+    const char* name;
+    int name_size;
+    const char* value;
+    int value_size;
+  };
+
+private:
+  typedef std::pair<const uint8_t*, int> Span;
+
+  Segment seg_;
+
+  Span destination_;
+  Span payload_;
+  uint32_t flags_;
+
+  uint64_t stream_id_;
+  uint32_t status_;
+  std::vector<Span> headers_;
+  Span body_;
+  bool more_;
+  bool binary_;
+
+  bool parse_chunk();
+  bool parse_compact();
+  bool compact_span(const uint8_t* p, Span& span);
+
+public:
+  Reply();
+
+  bool parse(const Segment& seg, const uint8_t* frame, int size);
+  bool inflate(Deflate& deflate);
+  bool split(std::vector<Reply>& out);
+  bool parse_response();
+
+  const Segment& segment() {
+    return seg_;
+  }
+
+  std::string destination() {
+    return std::string((const char*)destination_.first, destination_.second);
+  }
+
+  // Whether the message was published to an event topic rather than sent
+  // to one of our own queues, in which case the payload is the event and
+  // not something parse_response() understands.
+  bool topic_p();
+
+  const uint8_t* payload() {
+    return payload_.first;
+  }
+
+  int payload_size() {
+    return payload_.second;
+  }
+
+  uint32_t flags() {
+    return flags_;
+  }
+
+  uint64_t stream_id() {
+    return stream_id_;
+  }
+
+  uint32_t status() {
+    return status_;
+  }
+
+  int headers_size() {
+    return headers_.size();
+  }
+
+  bool header(int i, Header& out);
+
+  const uint8_t* body() {
+    return body_.first;
+  }
+
+  int body_size() {
+    return body_.second;
+  }
+
+  // Set on the head of a streamed reply and on each of its chunks but the
+  // last: more of the body follows in eChunk replies.
+  bool more_p() {
+    return more_;
+  }
+
+  // An eSocket message to go out as a binary frame rather than text.
+  bool binary_p() {
+    return binary_;
+  }
+};
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef RING_HPP
+#define RING_HPP
+
+#include <stddef.h>
+
+// A bounded, lock-free ring for exactly one producer thread and one
+// consumer thread. The producer only writes tail_ and the consumer only
+// writes head_; each side publishes its index with a release store so the
+// other side sees the slot contents before it sees the index move.
+//
+// size must be a power of two.
+template <typename T>
+class Ring {
+  T* const slots_;
+  const size_t mask_;
+
+  // Keep the two indexes on separate cache lines so the producer and
+  // consumer don't bounce one line between cores on every operation.
+  size_t head_;
+  char pad_[64 - sizeof(size_t)];
+  size_t tail_;
+
+  Ring(const Ring&);
+  Ring& operator=(const Ring&);
+
+public:
+  Ring(size_t size)
+    : slots_(new T[size])
+    , mask_(size - 1)
+    , head_(0)
+    , pad_()
+    , tail_(0)
+  {}
+
+  ~Ring() {
+    delete[] slots_;
+  }
+
+  // Producer side. Returns false if the ring is full.
+  bool push(const T& val) {
+    const size_t tail = tail_;
+    const size_t head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+
+    if(tail - head > mask_) return false;
+
+    slots_[tail & mask_] = val;
+    __atomic_store_n(&tail_, tail + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  // Consumer side. Returns false if the ring is empty.
+  bool pop(T& val) {
+    const size_t head = head_;
+    const size_t tail = __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+
+    if(head == tail) return false;
+
+    val = slots_[head & mask_];
+    __atomic_store_n(&head_, head + 1, __ATOMIC_RELEASE);
+    return true;
+  }
+
+  // Only meaningful to the producer.
+  bool full_p() {
+    return tail_ - __atomic_load_n(&head_, __ATOMIC_ACQUIRE) > mask_;
+  }
+
+  bool empty_p() {
+    return __atomic_load_n(&head_, __ATOMIC_ACQUIRE) ==
+           __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+  }
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "route.hpp"
+#include "harq.hpp"
+
+#include <stdlib.h>
+
+#include <iostream>
+
+Routes::Routes()
+  : routes_()
+  , default_("", "/harq-http", eProtobuf)
+{}
+
+// spec is prefix=destination, optionally followed by any of ,compact
+// ,protobuf ,cancel ,timeout=<ms> ,class=<traffic class> ,max_inflight=<n>
+// ,max_bytes=<n> ,hedge[=<destination>] ,hedge_at=<percentile>
+// ,coalesce[=<header>+<header>...] ,websocket and ,events
+bool Routes::add(std::string spec) {
+  size_t eq = spec.find('=');
+
+  if(eq == std::string::npos || eq == 0 || eq + 1 == spec.size()) {
+    std::cerr << "Bad route " << spec << ", expected prefix=destination\n";
+    return false;
+  }
+
+  std::string prefix = spec.substr(0, eq);
+  std::string rest = spec.substr(eq + 1);
+
+  size_t comma = rest.find(',');
+
+  Route route(prefix, rest.substr(0, comma), eProtobuf);
+
+  while(comma != std::string::npos) {
+    size_t next = rest.find(',', comma + 1);
+    std::string opt = rest.substr(comma + 1, next - comma - 1);
+
+    if(opt == "compact") {
+      route.format = eCompact;
+    } else if(opt == "protobuf") {
+      route.format = eProtobuf;
+    } else if(opt == "cancel") {
+      route.cancel = true;
+    } else if(opt.compare(0, 8, "timeout=") == 0) {
+      route.timeout = strtoul(opt.c_str() + 8, (char**)NULL, 10) / 1000.0;
+      if(route.timeout <= 0) {
+        std::cerr << "Bad route timeout " << opt << "\n";
+        return false;
+      }
+    } else if(opt.compare(0, 6, "class=") == 0) {
+      route.traffic_class = opt.substr(6);
+    } else if(opt.compare(0, 13, "max_inflight=") == 0) {
+      route.max_inflight = atoi(opt.c_str() + 13);
+      if(route.max_inflight <= 0) {
+        std::cerr << "Bad route max_inflight " << opt << "\n";
+        return false;
+      }
+    } else if(opt.compare(0, 10, "max_bytes=") == 0) {
+      route.max_bytes = strtoul(opt.c_str() + 10, (char**)NULL, 10);
+      if(route.max_bytes == 0) {
+        std::cerr << "Bad route max_bytes " << opt << "\n";
+        return false;
+      }
+    } else if(opt == "hedge") {
+      route.hedge = true;
+    } else if(opt.compare(0, 6, "hedge=") == 0 && opt.size() > 6) {
+      route.hedge = true;
+      route.hedge_destination = opt.substr(6);
+    } else if(opt.compare(0, 9, "hedge_at=") == 0) {
+      route.hedge_percentile = atoi(opt.c_str() + 9);
+      if(route.hedge_percentile < 1 || route.hedge_percentile > 99) {
+        std::cerr << "Bad route hedge_at " << opt << "\n";
+        return false;
+      }
+    } else if(opt == "coalesce") {
+      route.coalesce = true;
+    } else if(opt.compare(0, 9, "coalesce=") == 0) {
+      route.coalesce = true;
+
+      size_t at = 9;
+
+      while(at <= opt.size()) {
+        size_t plus = opt.find('+', at);
+        if(plus == std::string::npos) plus = opt.size();
+
+        if(plus > at) {
+          route.coalesce_headers.push_back(opt.substr(at, plus - at));
+        }
+
+        at = plus + 1;
+      }
+    } else if(opt == "websocket") {
+      route.websocket = true;
+    } else if(opt == "events") {
+      route.events = true;
+    } else {
+      std::cerr << "Unknown route option " << opt << "\n";
+      return false;
+    }
+
+    comma = next;
+  }
+
+  if(route.events &&
+     route.destination.compare(0, sizeof(GATEWAY_QUEUES) - 1,
+                               GATEWAY_QUEUES) == 0) {
+    std::cerr << "Bad route " << spec << ", event topics can't be under "
+              << GATEWAY_QUEUES << "\n";
+    return false;
+  }
+
+  std::vector<Route>::iterator i = routes_.begin();
+
+  while(i != routes_.end() && i->prefix.size() >= prefix.size()) ++i;
+
+  routes_.insert(i, route);
+
+  return true;
+}
+
+const Routes::Route& Routes::match(const std::string& url) const {
+  for(std::vector<Route>::const_iterator i = routes_.begin();
+      i != routes_.end();
+      ++i) {
+    if(url.compare(0, i->prefix.size(), i->prefix) == 0) return *i;
+  }
+
+  return default_;
+}
@@ -0,0 +1,101 @@
+#ifndef ROUTE_HPP
+#define ROUTE_HPP
+
+#include <string>
+#include <vector>
+
+// Picks the broker destination (and payload format) for a request by the
+// longest prefix of its URL. Anything unmatched goes to the default
+// destination as an http::Request, which is what every worker understands.
+class Routes {
+public:
+  enum Format {
+    eProtobuf,
+    eCompact    // see compact.hpp
+  };
+
+  struct Route {
+    std::string prefix;
+    std::string destination;
+    Format format;
+
+    // The destination's workers understand http::Cancel.
+    bool cancel;
+
+    // Default time a request may take, in seconds (0 for no limit).
+    double timeout;
+
+    // The FairQueue class requests are queued in when the link is busy.
+    std::string traffic_class;
+
+    // Bulkhead caps on the route's outstanding requests and the request
+    // body bytes they hold (0 for no cap), so workers that hang only take
+    // their own endpoint down with them.
+    int max_inflight;
+    size_t max_bytes;
+
+    // GETs and HEADs still unanswered at the hedge_percentile of recent
+    // latency are sent again to hedge_destination (which may be the same
+    // destination, to reach another worker); the first reply wins.
+    bool hedge;
+    std::string hedge_destination;
+    int hedge_percentile;
+
+    // GETs for the same Host and URL (and the same values of
+    // coalesce_headers) while one is already inflight wait for its reply
+    // instead of going to the broker themselves. Those carrying
+    // Authorization or a Cookie never do unless it's listed.
+    bool coalesce;
+    std::vector<std::string> coalesce_headers;
+
+    // WebSocket upgrades are taken, and their messages bridged to
+    // destination as http::SocketMessage (see WebSocket).
+    bool websocket;
+
+    // GETs are answered with a stream of server-sent events, one for each
+    // message published to the topic named by destination followed by the
+    // rest of the URL's path (see Server::subscribe). Topics can't be
+    // under GATEWAY_QUEUES.
+    bool events;
+
+    Route(std::string p, std::string d, Format f)
+      : prefix(p)
+      , destination(d)
+      , format(f)
+      , cancel(false)
+      , timeout(0)
+      , traffic_class()
+      , max_inflight(0)
+      , max_bytes(0)
+      , hedge(false)
+      , hedge_destination(d)
+      , hedge_percentile(95)
+      , coalesce(false)
+      , coalesce_headers()
+      , websocket(false)
+      , events(false)
+    {}
+
+    bool bulkhead_p() const {
+      return max_inflight > 0 || max_bytes > 0;
+    }
+  };
+
+private:
+  // Kept longest prefix first, so the first match is the best one.
+  std::vector<Route> routes_;
+  Route default_;
+
+public:
+  Routes();
+
+  bool add(std::string spec);
+
+  const Route& match(const std::string& url) const;
+
+  const std::vector<Route>& all() const {
+    return routes_;
+  }
+};
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef SEGMENT_HPP
+#define SEGMENT_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+// A refcounted block of bytes. Read buffers are carved out of segments so
+// that replies can hand pieces of what was read straight to an output
+// WriteSet without copying; the block lives until the last reference to
+// it (reader or pending write) is dropped.
+//
+// The count is maintained atomically because a BrokerThread reads into
+// segments that are then written out by another loop.
+class Segment {
+  struct Data {
+    int refs;
+    size_t size;
+    uint8_t* bytes;
+
+    Data(size_t s)
+      : refs(1)
+      , size(s)
+      , bytes(new uint8_t[s])
+    {}
+
+    ~Data() {
+      delete[] bytes;
+    }
+
+  private:
+    Data(const Data&);
+    Data& operator=(const Data&);
+  };
+
+  Data* data_;
+
+public:
+  Segment()
+    : data_(0)
+  {}
+
+  explicit
+  Segment(size_t size)
+    : data_(new Data(size))
+  {}
+
+  Segment(const Segment& other)
+    : data_(other.data_)
+  {
+    incref();
+  }
+
+  Segment& operator=(const Segment& other) {
+    if(data_ != other.data_) {
+      Data* old = data_;
+      data_ = other.data_;
+      incref();
+
+      if(old && __atomic_sub_fetch(&old->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        delete old;
+      }
+    }
+
+    return *this;
+  }
+
+  ~Segment() {
+    decref();
+  }
+
+  void incref() {
+    if(data_) __atomic_add_fetch(&data_->refs, 1, __ATOMIC_RELAXED);
+  }
+
+  void decref() {
+    if(data_ && __atomic_sub_fetch(&data_->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+      delete data_;
+    }
+
+    data_ = 0;
+  }
+
+  bool empty_p() const {
+    return data_ == 0;
+  }
+
+  // True if anyone besides this reference still points at the bytes.
+  bool shared_p() const {
+    return data_ && __atomic_load_n(&data_->refs, __ATOMIC_ACQUIRE) > 1;
+  }
+
+  uint8_t* bytes() const {
+    return data_ ? data_->bytes : 0;
+  }
+
+  size_t size() const {
+    return data_ ? data_->size : 0;
+  }
+};
+
+#endif
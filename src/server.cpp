@@ -15,13 +15,22 @@
 
 #include <iostream>
 #include <sstream>
+#include <algorithm>
 
 #include "debugs.hpp"
 #include "util.hpp"
 #include "server.hpp"
 #include "connection.hpp"
+#include "broker_thread.hpp"
+#include "shm_link.hpp"
+#include "reply.hpp"
+#include "compact.hpp"
+#include "cache.hpp"
+#include "websocket.hpp"
+#include "hot_restart.hpp"
 
 #include "wire.pb.h"
+#include "http.pb.h"
 
 #include "flags.hpp"
 #include "types.hpp"
@@ -32,6 +41,160 @@
 
 #define EVBACKEND EVFLAG_AUTO
 
+// Batches are sent once they reach this size, even mid-iteration.
+static const size_t cMaxBatch = 64 * 1024;
+
+// How often a non-empty fair queue is retried when nothing else wakes
+// the loop.
+static const ev_tstamp cRequeueInterval = 0.001;
+
+// How many expired streams are remembered for counting late replies.
+static const size_t cMaxExpired = 64 * 1024;
+
+// A streamed reply is paused once a client has this much of it unwritten
+// and resumed when every client is back under cResumeBacklog. A client
+// that falls cMaxStreamBacklog behind anyway is dropped.
+static const size_t cPauseBacklog = 256 * 1024;
+static const size_t cResumeBacklog = 64 * 1024;
+static const size_t cMaxStreamBacklog = 4 * 1024 * 1024;
+
+// Event stream readers with cPauseBacklog unwritten skip events, and are
+// dropped once they've skipped this many in a row.
+static const uint32_t cMaxSkippedEvents = 1024;
+
+// Client connection timeouts are kept to this resolution.
+static const ev_tstamp cTimeoutTick = 0.25;
+
+// How long a connection being closed is given to take what's been
+// written to it.
+static const ev_tstamp cLingerTimeout = 5;
+
+// After handing off its listening socket, a loop looks this often for
+// connections it can close, and gives up on the rest (WebSockets, event
+// streams, replies that never come) after cDrainTimeout.
+static const ev_tstamp cDrainInterval = 0.1;
+static const ev_tstamp cDrainTimeout = 30;
+
+// Linux pids are below 2^22 (PID_MAX_LIMIT), leaving each process 2^34
+// stream ids per loop before they run into the next pid's.
+static const int cPidBits = 22;
+
+static std::string sTimeout(
+    "HTTP/1.1 504 Gateway Timeout\r\n"
+    "Content-Length: 0\r\n\r\n");
+
+static std::string sRequestTimeout(
+    "HTTP/1.1 408 Request Timeout\r\n"
+    "Connection: close\r\n"
+    "Content-Length: 0\r\n\r\n");
+
+static const std::string* request_header(http::Request& req,
+                                         const char* name) {
+  for(int i = 0; i < req.headers_size(); i++) {
+    const http::Header& h = req.headers(i);
+    const char* key = h.has_key() ? header_key_name(h.key())
+                                  : h.custom_key().c_str();
+
+    if(strcasecmp(key, name) == 0) return &h.value();
+  }
+
+  return 0;
+}
+
+// Whether name is one of the route's coalesce_headers.
+static bool coalesces_on_p(const Routes::Route& route, const char* name) {
+  for(size_t i = 0; i < route.coalesce_headers.size(); i++) {
+    if(strcasecmp(route.coalesce_headers[i].c_str(), name) == 0) return true;
+  }
+
+  return false;
+}
+
+// The route, Host, URL and chosen header values, or empty if the request
+// isn't one to coalesce. One user's reply mustn't go to another, so
+// credentials have to be part of the key for the request to coalesce.
+static std::string flight_key(const Routes::Route& route,
+                              http::Request& req) {
+  if(!route.coalesce || req.has_custom_method() ||
+     req.method() != http::Request_Method_GET) {
+    return std::string();
+  }
+
+  if((request_header(req, "authorization") &&
+      !coalesces_on_p(route, "authorization")) ||
+     (request_header(req, "cookie") && !coalesces_on_p(route, "cookie"))) {
+    return std::string();
+  }
+
+  std::string key = route.prefix;
+  key.push_back('\0');
+
+  if(const std::string* host = request_header(req, "host")) {
+    key.append(*host);
+  }
+
+  key.push_back('\0');
+  key.append(req.url());
+
+  for(size_t i = 0; i < route.coalesce_headers.size(); i++) {
+    key.push_back('\0');
+
+    const std::string* v =
+      request_header(req, route.coalesce_headers[i].c_str());
+    if(v) key.append(*v);
+  }
+
+  return key;
+}
+
+// Whether a reply header is called name, in any case.
+static bool header_is(const Reply::Header& h, const char* name) {
+  return (int)strlen(name) == h.name_size &&
+         strncasecmp(h.name, name, h.name_size) == 0;
+}
+
+// Only requests that are safe to send twice get hedged.
+static bool hedgeable_p(http::Request& req) {
+  if(req.has_custom_method()) return false;
+
+  return req.method() == http::Request_Method_GET ||
+         req.method() == http::Request_Method_HEAD;
+}
+
+// The smaller of the route's timeout and an X-Request-Timeout header (in
+// milliseconds) from the client, or 0 if neither is given.
+static ev_tstamp request_timeout(const Routes::Route& route,
+                                 http::Request& req) {
+  ev_tstamp timeout = route.timeout;
+
+  if(const std::string* v = request_header(req, "x-request-timeout")) {
+    unsigned long ms = strtoul(v->c_str(), (char**)NULL, 10);
+
+    if(ms > 0 && (timeout == 0 || ms / 1000.0 < timeout)) {
+      timeout = ms / 1000.0;
+    }
+  }
+
+  return timeout;
+}
+
+// The route's traffic class, unless the client asked for another known
+// one with X-Traffic-Class.
+static int traffic_class(FairQueue& fair, const Routes::Route& route,
+                         http::Request& req) {
+  int cls = -1;
+
+  if(const std::string* v = request_header(req, "x-traffic-class")) {
+    cls = fair.find(*v);
+  }
+
+  if(cls < 0 && !route.traffic_class.empty()) {
+    cls = fair.find(route.traffic_class);
+  }
+
+  return cls < 0 ? 0 : cls;
+}
+
 #ifdef __linux
 #undef EVBACKEND
 #define EVBACKEND EVBACKEND_EPOLL
@@ -52,19 +215,82 @@ Server::Server(std::string db_path, std::string hostaddr, int port)
     , sigint_watcher_(loop_)
     , sigterm_watcher_(loop_)
     , cleanup_watcher_(loop_)
+    , replies_watcher_(loop_)
+    , flush_watcher_(loop_)
+    , deadline_watcher_(loop_)
+    , requeue_watcher_(loop_)
+    , hedge_watcher_(loop_)
+    , timeout_watcher_(loop_)
+    , handoff_watcher_(loop_)
+    , drain_watcher_(loop_)
+    , inflight_()
+    , deadlines_()
+    , expired_()
+    , stats_()
+    , limiter_()
+    , bulkheads_()
+    , breakers_()
+    , breaker_threshold_(0)
+    , hedgers_()
+    , hedge_copies_()
+    , hedge_times_()
+    , hedges_()
+    , cache_(0)
+    , cache_fills_()
+    , flights_()
+    , flight_keys_()
+    , streamed_()
+    , sockets_()
+    , topics_()
+    , listeners_()
+    , timeouts_()
+    , timers_()
+    , reply_queue_(REPLY_QUEUE)
+    , socket_queue_(SOCKET_QUEUE)
+    , restart_(0)
+    , drain_deadline_(0)
+    , adopted_at_(0)
     , next_id_(0)
+    , next_connection_id_(0)
+    , queue_(0)
+    , bulk_queue_(0)
+    , bulk_threshold_(0)
+    , broker_(0)
+    , producer_(0)
+    , shm_(0)
+    , deflate_()
+    , routes_()
+    , batches_()
+    , bulk_batches_()
+    , fair_()
 {
   sigint_watcher_.set<Server, &Server::on_signal>(this);
-  sigint_watcher_.start(SIGINT);
-
   sigterm_watcher_.set<Server, &Server::on_signal>(this);
-  sigterm_watcher_.start(SIGTERM);
+
+  replies_watcher_.set<Server, &Server::on_replies>(this);
+
+  flush_watcher_.set<Server, &Server::on_flush>(this);
+  flush_watcher_.start();
+
+  deadline_watcher_.set<Server, &Server::on_deadline>(this);
+  requeue_watcher_.set<Server, &Server::on_requeue>(this);
+  hedge_watcher_.set<Server, &Server::on_hedge>(this);
+  timeout_watcher_.set<Server, &Server::on_timeout>(this);
+  handoff_watcher_.set<Server, &Server::on_handoff>(this);
+  drain_watcher_.set<Server, &Server::on_drain>(this);
 
   cleanup_watcher_.set<Server, &Server::cleanup>(this);
   cleanup_watcher_.start();
 }
 
 Server::~Server() {
+  for(HedgeCopies::iterator i = hedge_copies_.begin();
+      i != hedge_copies_.end();
+      ++i) {
+    delete i->second;
+  }
+
+  delete shm_;
   close(fd_);
 }
 
@@ -83,7 +309,23 @@ void Server::cleanup(ev::check& w, int revents) {
   closing_connections_.clear();
 }
 
-void Server::start() {    
+void Server::start() {
+  if(fd_ < 0) open_listener();
+
+  connection_watcher_.set<Server, &Server::on_connection>(this);
+  connection_watcher_.start(fd_, EV_READ);
+
+  // A signal can only be watched from one loop, so only the first
+  // producer (or the only loop) handles them.
+  if(producer_ == 0) {
+    sigint_watcher_.start(SIGINT);
+    sigterm_watcher_.start(SIGTERM);
+  }
+
+  loop_.run(0);
+}
+
+void Server::open_listener() {
   if((fd_ = socket(AF_INET, SOCK_STREAM, 0)) == -1) {
     perror("socket()");
     exit(1);
@@ -93,6 +335,14 @@ void Server::start() {
   setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, (void *)&flags, sizeof(flags));
   setsockopt(fd_, SOL_SOCKET, SO_KEEPALIVE, (void *)&flags, sizeof(flags));
 
+#ifdef SO_REUSEPORT
+  // Every loop sharing a BrokerThread binds the same port and the kernel
+  // spreads accepts across them.
+  if(broker_) {
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEPORT, (void *)&flags, sizeof(flags));
+  }
+#endif
+
   struct linger ling = {0, 0};
   setsockopt(fd_, SOL_SOCKET, SO_LINGER, (void *)&ling, sizeof(ling));
 
@@ -133,11 +383,65 @@ void Server::start() {
   }
 
   set_nonblock(fd_);
+}
 
-  connection_watcher_.set<Server, &Server::on_connection>(this);
-  connection_watcher_.start(fd_, EV_READ);
+void Server::adopt(int fd, ev_tstamp at) {
+  fd_ = fd;
+  adopted_at_ = at;
 
-  loop_.run(0);
+  set_nonblock(fd_);
+}
+
+void Server::set_restart(HotRestart* restart) {
+  restart_ = restart;
+  handoff_watcher_.start();
+}
+
+void Server::hand_off() {
+  handoff_watcher_.send();
+}
+
+// Our listening socket now belongs to a newer process, which is already
+// accepting on it, so there's nothing more to accept here. What's left is
+// answering what we have inflight.
+void Server::on_handoff(ev::async& w, int revents) {
+  connection_watcher_.stop();
+  close(fd_);
+  fd_ = -1;
+
+  drain_deadline_ = loop_.now() + cDrainTimeout;
+  drain_watcher_.start(0, cDrainInterval);
+}
+
+// Connections between requests are closed as soon as they get there;
+// once they all have and nothing's inflight, this loop is done. One just
+// accepted may have its first request on the way, so it's left until
+// that's answered or it times out.
+void Server::on_drain(ev::timer& w, int revents) {
+  std::vector<Connection*> idle;
+  bool busy = !inflight_.empty();
+
+  for(ConnectionMap::iterator i = connections_.begin();
+      i != connections_.end();
+      ++i) {
+    Connection* con = i->second;
+    if(con == queue_ || con == bulk_queue_) continue;
+
+    if(idle_p(*con) && !con->fresh_p()) {
+      idle.push_back(con);
+    } else {
+      busy = true;
+    }
+  }
+
+  for(size_t i = 0; i < idle.size(); i++) {
+    idle[i]->go_away();
+  }
+
+  if(busy && loop_.now() < drain_deadline_) return;
+
+  drain_watcher_.stop();
+  restart_->drained();
 }
 
 void Server::on_signal(ev::sig& w, int revents) {
@@ -160,9 +464,18 @@ void Server::on_connection(ev::io& w, int revents) {
     return;
   }
 
-  int id = next_id();
+  if(adopted_at_) {
+    stats_.takeover_accept = ev_time() - adopted_at_;
+    adopted_at_ = 0;
+
+    std::cerr << "First connection on the taken over socket accepted after "
+              << stats_.takeover_accept * 1000 << "ms\n";
+  }
+
+  int id = next_connection_id();
 
-  Connection* connection = new Connection(ref(this), id, fd);
+  Connection* connection =
+    new Connection(ref(this), id, fd, Connection::cMaxClientRead);
 
   if(connection == NULL) {
     close(fd);
@@ -174,121 +487,1719 @@ void Server::on_connection(ev::io& w, int revents) {
   connection->start();
 }
 
-void Server::deliver(http::Request& req) {
+void Server::deliver(Connection& con, http::Request& req) {
   /*
   google::protobuf::io::OstreamOutputStream out(&std::cerr);
   google::protobuf::TextFormat::Print(req_, &out);
   std::cout << "done\n";
   */
 
-  wire::Message msg;
-  msg.set_destination("/harq-http");
-  msg.set_payload(req.SerializeAsString());
+  if(req.url() == STATS_PATH) {
+    serve_stats(con);
+    return;
+  }
+
+  stats_.requests++;
+
+  const Routes::Route& route = routes_.match(req.url());
+
+  if(route.events) {
+    subscribe(con, route, req);
+    return;
+  }
+
+  std::string base;
+  if(cache_) base = ResponseCache::base_key(req);
+
+  if(!base.empty()) {
+    Segment cached;
+
+    switch(cache_->lookup(base, req, loop_.now(), cached)) {
+    case ResponseCache::eMiss:
+      stats_.cache_misses++;
+      break;
+    case ResponseCache::eFresh:
+    case ResponseCache::eStale:
+      stats_.cache_hits++;
+      con.write(cached, cached.bytes(), cached.size());
+      return;
+    case ResponseCache::eRevalidate:
+      // The client gets what's cached, and the request carries on to the
+      // broker on nobody's behalf to refresh it.
+      stats_.cache_hits++;
+      stats_.cache_revalidations++;
+      con.write(cached, cached.bytes(), cached.size());
+      forward(0, req, base);
+      return;
+    }
+  }
+
+  forward(&con, req, base);
+}
+
+// Send the request on to the broker for con, or for nobody (con is 0)
+// when it's only refreshing the cache. base is its cache key, if the
+// reply may be cached.
+void Server::forward(Connection* con, http::Request& req,
+                     const std::string& base) {
+  const Routes::Route& route = routes_.match(req.url());
+  size_t bytes = req.body().size();
+
+  std::string key = flight_key(route, req);
+
+  if(!key.empty()) {
+    std::map<std::string, uint64_t>::iterator k = flight_keys_.find(key);
+
+    // Wait on the same reply as the request already inflight.
+    if(k != flight_keys_.end()) {
+      if(con) {
+        flights_[k->second].followers.push_back(con->id());
+        con->streams().push_back(k->second);
+        stats_.coalesced++;
+      }
+
+      return;
+    }
+  }
+
+  Breaker* breaker = this->breaker(route.destination);
+  bool probe = false;
+
+  if(breaker && !breaker->allow(loop_.now(), probe)) {
+    static std::string sCircuitOpen(
+        "HTTP/1.1 503 Service Unavailable\r\n"
+        "Retry-After: 5\r\n"
+        "Content-Length: 0\r\n\r\n");
+
+    stats_.fast_failed++;
+    if(con) con->write(sCircuitOpen);
+    return;
+  }
+
+  if(!admit(route, bytes)) {
+    static std::string sBulkhead(
+        "HTTP/1.1 503 Service Unavailable\r\n"
+        "Retry-After: 1\r\n"
+        "Content-Length: 0\r\n\r\n");
+
+    if(breaker) breaker->abandon(probe);
+
+    stats_.shed++;
+    if(con) con->write(sBulkhead);
+    return;
+  }
+
+  if(!limiter_.acquire()) {
+    static std::string sOverloaded(
+        "HTTP/1.1 503 Service Unavailable\r\n"
+        "Retry-After: 1\r\n"
+        "Content-Length: 0\r\n\r\n");
+
+    unadmit(route, bytes);
+    if(breaker) breaker->abandon(probe);
+
+    stats_.rejected++;
+    if(con) con->write(sOverloaded);
+    return;
+  }
+
+  req.set_reply_to(reply_queue_);
+  if(bulk_queue_) req.set_bulk_reply_to(reply_queue_ + BULK_REPLY_SUFFIX);
+
+  int cls = traffic_class(fair_, route, req);
+
+  uint64_t stream = next_id();
+
+  // ev's clock is wall clock time, so the deadline means the same thing
+  // to a worker on another host (give or take clock skew).
+  ev_tstamp now = loop_.now();
+  ev_tstamp timeout = request_timeout(route, req);
+  ev_tstamp deadline = timeout > 0 ? now + timeout : 0;
+
+  req.set_stream_id(stream);
+  if(deadline) req.set_deadline((uint64_t)(deadline * 1000));
+
+  Inflight& inflight =
+    inflight_.insert(std::make_pair(stream,
+                                    Inflight(con ? con->id() : 0, &route,
+                                             cls, bytes, probe, now,
+                                             deadline)))
+      .first->second;
+
+  if(con) con->streams().push_back(stream);
 
-  queue_->write(msg);
+  if(!key.empty()) {
+    flights_[stream].key = key;
+    flight_keys_[key] = stream;
+  }
+
+  if(!base.empty()) {
+    CacheFill& fill = cache_fills_[stream];
+    fill.base = base;
+    fill.headers = ResponseCache::flatten_headers(req);
+  }
+
+  if(deadline) {
+    bool first = deadlines_.empty() || deadline < deadlines_.begin()->first;
+    deadlines_.insert(std::make_pair(deadline, stream));
+    if(first) arm_deadline();
+  }
+
+  if(route.hedge && hedgeable_p(req)) {
+    Hedger& hedger = this->hedger(route);
+    hedger.earn();
+
+    // The copy is only worth keeping around if the budget could pay for
+    // it now.
+    if(hedger.threshold() > 0 && hedger.affordable_p()) {
+      ev_tstamp at = now + hedger.threshold();
+
+      inflight.hedge_at = at;
+      hedge_copies_[stream] = new http::Request(req);
+
+      bool first = hedge_times_.empty() || at < hedge_times_.begin()->first;
+      hedge_times_.insert(std::make_pair(at, stream));
+      if(first) arm_hedge();
+    }
+  }
+
+  enqueue(route.destination, cls, route, req);
+}
+
+// Encode the request in the route's format and add it to the batch for
+// its destination and class.
+void Server::enqueue(const std::string& destination, int cls,
+                     const Routes::Route& route, http::Request& req) {
+  std::string payload;
+  uint32_t flags = 0;
+
+  if(route.format == Routes::eCompact) {
+    compact_encode_request(req, payload);
+    flags |= eCompact;
+  } else {
+    req.SerializeToString(&payload);
+  }
+
+  deflate_.sample((const uint8_t*)payload.data(), payload.size());
+
+  // Each request's own size decides its lane, and each lane is batched
+  // apart. A batch carries a single format, and anything big enough to
+  // fill a batch by itself is better off alone.
+  bool bulk = bulk_queue_ && payload.size() >= bulk_threshold_;
+  bool alone = payload.size() >= cMaxBatch;
+
+  BatchKey key(destination, cls);
+  Batch& batch = (bulk ? bulk_batches_ : batches_)[key];
+
+  if(!batch.empty_p() && (alone || batch.flags() != flags)) {
+    flush_batch(key, batch, bulk);
+  }
+
+  batch.add(payload, flags, req.stream_id());
+
+  if(alone || batch.size() >= cMaxBatch) {
+    flush_batch(key, batch, bulk);
+  }
+}
+
+Breaker* Server::breaker(const std::string& destination) {
+  if(!breaker_threshold_) return 0;
+
+  Breakers::iterator i = breakers_.find(destination);
+
+  if(i == breakers_.end()) {
+    i = breakers_.insert(std::make_pair(destination, Breaker())).first;
+    i->second.set_threshold(breaker_threshold_);
+  }
+
+  return &i->second;
+}
+
+// Count the request against its route's bulkhead, unless that would put
+// the route over one of its caps. A route with nothing outstanding always
+// gets one request through, however big.
+bool Server::admit(const Routes::Route& route, size_t bytes) {
+  if(!route.bulkhead_p()) return true;
+
+  Bulkhead& b = bulkheads_[&route];
+
+  if((route.max_inflight && b.inflight >= route.max_inflight) ||
+     (route.max_bytes && b.inflight > 0 && b.bytes + bytes > route.max_bytes)) {
+    b.rejected++;
+    return false;
+  }
+
+  b.inflight++;
+  b.bytes += bytes;
+
+  return true;
+}
+
+void Server::unadmit(const Routes::Route& route, size_t bytes) {
+  if(!route.bulkhead_p()) return;
+
+  Bulkhead& b = bulkheads_[&route];
+  b.inflight--;
+  b.bytes -= bytes;
 }
 
-void Server::send_reply(http::Response& rep) {
-  Connection* con = connections_[rep.stream_id()];
+void Server::serve_stats(Connection& con) {
+  stats_.limit = limiter_.enabled_p() ? limiter_.limit() : 0;
+  stats_.inflight = limiter_.inflight();
+  stats_.rtt = limiter_.rtt();
+  stats_.rtt_noload = limiter_.rtt_noload();
+  stats_.classes = fair_.json();
+  if(cache_) stats_.cache = cache_->json();
+
+  std::stringstream routes;
+  routes << "[";
+
+  for(Bulkheads::iterator i = bulkheads_.begin(); i != bulkheads_.end(); ++i) {
+    if(i != bulkheads_.begin()) routes << ",";
+
+    routes << "{\"prefix\":\"" << i->first->prefix << "\""
+           << ",\"inflight\":" << i->second.inflight
+           << ",\"bytes\":" << i->second.bytes
+           << ",\"rejected\":" << i->second.rejected
+           << "}";
+  }
+
+  routes << "]";
+  stats_.bulkheads = routes.str();
+
+  std::stringstream breakers;
+  breakers << "[";
+
+  for(Breakers::iterator i = breakers_.begin(); i != breakers_.end(); ++i) {
+    if(i != breakers_.begin()) breakers << ",";
+    breakers << i->second.json(i->first, loop_.now());
+  }
+
+  breakers << "]";
+  stats_.breakers = breakers.str();
+
+  std::string body = stats_.json(producer_);
 
   std::stringstream out;
-  out << "HTTP/1.1 " << rep.status() << " Did it\r\n";
+  out << "HTTP/1.1 200 OK\r\n"
+      << "Content-Type: application/json\r\n"
+      << "Content-Length: " << body.size() << "\r\n\r\n"
+      << body;
 
-  for(int i = 0; i < rep.headers_size(); i++) {
-    const http::Header& h = rep.headers(i);
-    out << h.custom_key() << ": " << h.value() << "\r\n";
+  con.write(out.str());
+}
+
+void Server::on_flush(ev::prepare& w, int revents) {
+  // What's already waiting goes ahead of anything batched since.
+  drain_queue();
+
+  for(Batches::iterator i = batches_.begin(); i != batches_.end(); ++i) {
+    if(!i->second.empty_p()) flush_batch(i->first, i->second, false);
+  }
+
+  for(Batches::iterator i = bulk_batches_.begin(); i != bulk_batches_.end();
+      ++i) {
+    if(!i->second.empty_p()) flush_batch(i->first, i->second, true);
   }
+}
 
-  out << "Content-Length: " << rep.body().size() << "\r\n";
+void Server::flush_batch(const BatchKey& key, Batch& batch, bool bulk) {
+  std::string payload;
+  uint32_t flags;
+  std::vector<uint64_t> streams;
 
-  out << "\r\n";
+  batch.take(payload, flags, streams);
 
-  std::cout << "<DEBUG>\n" << out.str() << "\n</DEBUG>\n";
+  if(flags & eBatch) {
+    debugs << "Batched " << streams.size() << " requests for "
+           << key.first << "\n";
+  }
 
-  con->write(out.str());
-  con->write(rep.body());
+  send_payload(key.first, payload, flags, streams, key.second, bulk);
 }
 
+// Whether the broker link has stopped keeping up: a socket with writes
+// queued in userspace, a shared memory ring with a backlog, or a full
+// ring to the broker thread.
+bool Server::backed_up_p() {
+  if(shm_) return shm_->backed_up_p();
+  if(broker_) return broker_->full_p(producer_);
 
-void Server::remove_connection(Connection* con) {
-  connections_.erase(con->id());
-  closing_connections_.push_back(con);
+  return queue_ && queue_->backed_up_p();
+}
+
+// Payloads go straight out while the link keeps up. Once it doesn't,
+// they wait in the fair queue for their class's turn.
+void Server::send_payload(const std::string& destination,
+                          std::string& payload, uint32_t flags,
+                          std::vector<uint64_t>& streams, int cls,
+                          bool bulk) {
+  if(fair_.empty_p() && !backed_up_p()) {
+    transmit(destination, payload, flags, streams, bulk);
+    return;
+  }
+
+  FairQueue::Item* item = new FairQueue::Item;
+  item->destination = destination;
+  item->payload.swap(payload);
+  item->flags = flags;
+  item->streams.swap(streams);
+  item->bulk = bulk;
+  item->queued = loop_.now();
+
+  fair_.push(cls, item);
+
+  // A ring to the broker thread frees up without anything waking this
+  // loop, so poll while there's a queue.
+  if(!requeue_watcher_.is_active()) {
+    requeue_watcher_.start(cRequeueInterval, cRequeueInterval);
+  }
+}
+
+void Server::drain_queue() {
+  while(!fair_.empty_p() && !backed_up_p()) {
+    FairQueue::Item* item = fair_.pop(loop_.now());
+
+    transmit(item->destination, item->payload, item->flags, item->streams,
+             item->bulk);
+    delete item;
+  }
+
+  if(fair_.empty_p()) requeue_watcher_.stop();
+}
+
+void Server::on_requeue(ev::timer& w, int revents) {
+  drain_queue();
 }
 
+void Server::transmit(const std::string& destination,
+                      std::string& payload, uint32_t flags,
+                      std::vector<uint64_t>& streams, bool bulk) {
+  std::string packed;
+
+  wire::Message msg;
+  msg.set_destination(destination);
+
+  if(deflate_.compress(payload, packed)) {
+    msg.set_payload(packed);
+    flags |= eDeflate;
+  } else {
+    msg.set_payload(payload);
+  }
+
+  if(flags) msg.set_flags(flags);
+
+  static std::string sUnavailable(
+      "HTTP/1.1 503 Service Unavailable\r\n"
+      "Content-Length: 0\r\n\r\n");
 
-void Server::connect(std::string host, int c_port) {
-  int s, rv;
-  char port[6];  /* strlen("65535"); */
-  struct addrinfo hints, *servinfo, *p;
+  static std::string sBadGateway(
+      "HTTP/1.1 502 Bad Gateway\r\n"
+      "Content-Length: 0\r\n\r\n");
 
-  snprintf(port, 6, "%d", c_port);
-  memset(&hints,0,sizeof(hints));
-  hints.ai_family = AF_INET;
-  hints.ai_socktype = SOCK_STREAM;
+  if(shm_) {
+    if(shm_->write(msg)) return;
 
-  if ((rv = getaddrinfo(host.c_str(), port, &hints, &servinfo)) != 0) {
-    printf("Error: %s\n", gai_strerror(rv));
+    if(shm_->open_p()) {
+      std::cerr << "Shared memory link backed up, rejecting "
+                << streams.size() << " requests\n";
+      reject(streams, sUnavailable);
+    } else {
+      std::cerr << "Shared memory link closed, rejecting "
+                << streams.size() << " requests\n";
+      reject(streams, sBadGateway);
+    }
     return;
   }
 
-  for (p = servinfo; p != NULL; p = p->ai_next) {
-    if ((s = socket(p->ai_family,p->ai_socktype,p->ai_protocol)) == -1)
-      continue;
+  if(!broker_) {
+    if(bulk_queue_ && bulk) {
+      bulk_queue_->write(msg);
+    } else {
+      queue_->write(msg);
+    }
+    return;
+  }
 
-    if (::connect(s,p->ai_addr,p->ai_addrlen) == -1) {
-      close(s);
-      continue;
+  if(!broker_->push(producer_, msg)) {
+    std::cerr << "Broker ring full, rejecting "
+              << streams.size() << " requests\n";
+    reject(streams, sUnavailable);
+  }
+}
+
+// Answers requests that never made it to the broker.
+void Server::reject(std::vector<uint64_t>& streams,
+                    const std::string& response) {
+  for(size_t j = 0; j < streams.size(); j++) {
+    std::vector<Connection*> waiting;
+    finish(streams[j], eAbandoned, waiting);
+
+    for(size_t k = 0; k < waiting.size(); k++) {
+      waiting[k]->write(response);
+    }
+  }
+}
+
+void Server::on_replies(ev::async& w, int revents) {
+  Reply* rep;
+
+  while(broker_->pop_reply(producer_, rep)) {
+    if(!publish(*rep)) send_reply(*rep);
+    delete rep;
+  }
+}
+
+void Server::handle_reply(Reply& rep) {
+  if(publish(rep)) return;
+
+  if(rep.flags() & eBatch) {
+    std::vector<Reply> entries;
+
+    if(!rep.split(entries)) {
+      std::cerr << "Get malformed response batch\n";
+      return;
     }
 
-    goto end;
+    for(size_t i = 0; i < entries.size(); i++) {
+      handle_reply(entries[i]);
+    }
+
+    return;
   }
 
-  if (p == NULL) {
-    printf("Can't create socket: %s\n",strerror(errno));
+  deflate_.sample(rep.payload(), rep.payload_size());
+
+  if(!rep.parse_response()) {
+    std::cerr << "Get malformed response\n";
     return;
   }
 
-end:
-  freeaddrinfo(servinfo);
+  send_reply(rep);
+}
 
-  int id = next_id();
+// Every inflight request ends here. Unless it was abandoned, its round
+// trip feeds the limiter and its outcome the destination's breaker.
+void Server::forget(InflightMap::iterator i, Outcome outcome) {
+  if(i->second.deadline) {
+    deadlines_.erase(std::make_pair(i->second.deadline, i->first));
+  }
 
-  Connection* con = new Connection(ref(this), id, s);
+  Inflight& req = i->second;
+  ev_tstamp now = loop_.now();
 
-  if(con == NULL) {
-    close(s);
-    return;
+  limiter_.release(outcome == eAbandoned ? -1 : now - req.start);
+
+  unadmit(*req.route, req.bytes);
+
+  // A hedged copy holds places of its own; only one copy's round trip
+  // is timed.
+  if(req.hedge) {
+    limiter_.release(-1);
+    unadmit(*req.route, req.bytes);
   }
 
-  queue_ = con;
+  if(req.hedge_at) {
+    hedge_times_.erase(std::make_pair(req.hedge_at, i->first));
 
-  connections_[id] = con;
+    HedgeCopies::iterator c = hedge_copies_.find(i->first);
+    delete c->second;
+    hedge_copies_.erase(c);
+  }
 
-  con->start_queue();
+  if(req.hedge) hedges_.erase(req.hedge);
 
-  wire::Action act;
-  act.set_type(eMakeTransientQueue);
-  act.set_payload("/harq-http");
+  cache_fills_.erase(i->first);
 
-  wire::Message msg;
-  msg.set_destination("+");
-  msg.set_payload(act.SerializeAsString());
+  Flights::iterator f = flights_.find(i->first);
+
+  if(f != flights_.end()) {
+    flight_keys_.erase(f->second.key);
+    flights_.erase(f);
+  }
+
+  if(req.route->hedge && outcome != eAbandoned) {
+    hedger(*req.route).sample(now - req.start);
+  }
 
-  con->write(msg);
+  // The outcome is the answering destination's; the other copy, if there
+  // was one, was cut short.
+  const std::string& primary = req.route->destination;
+  const std::string& secondary = req.route->hedge_destination;
 
-  act.set_type(eMakeTransientQueue);
-  act.set_payload("/harq-http/reply");
+  if(Breaker* breaker = this->breaker(primary)) {
+    if(outcome == eAbandoned || req.hedge_won) {
+      breaker->abandon(req.probe);
+    } else {
+      breaker->record(now, outcome == eFailed, req.probe);
+    }
+  }
 
-  msg.set_destination("+");
-  msg.set_payload(act.SerializeAsString());
+  if(req.hedge) {
+    if(Breaker* breaker = this->breaker(secondary)) {
+      if(outcome == eAbandoned || !req.hedge_won) {
+        breaker->abandon(req.hedge_probe);
+      } else {
+        breaker->record(now, outcome == eFailed, req.hedge_probe);
+      }
+    }
+  }
 
-  con->write(msg);
+  inflight_.erase(i);
+}
 
-  act.set_type(eSubscribe);
-  act.set_payload("/harq-http/reply");
+// Forget an inflight request, adding each connection still there to be
+// answered to waiting: its own, then any that coalesced onto it.
+void Server::finish(uint64_t stream, Outcome outcome,
+                    std::vector<Connection*>& waiting) {
+  InflightMap::iterator i = inflight_.find(stream);
+  if(i == inflight_.end()) return;
+
+  detach(i->second.connection, stream, waiting);
+
+  Flights::iterator f = flights_.find(stream);
+
+  if(f != flights_.end()) {
+    std::vector<int>& followers = f->second.followers;
+
+    for(size_t j = 0; j < followers.size(); j++) {
+      detach(followers[j], stream, waiting);
+    }
+  }
+
+  forget(i, outcome);
+}
+
+void Server::detach(int connection, uint64_t stream,
+                    std::vector<Connection*>& waiting) {
+  ConnectionMap::iterator c = connections_.find(connection);
+  if(c == connections_.end()) return;
+
+  Connection* con = c->second;
+  std::vector<uint64_t>& streams = con->streams();
+
+  std::vector<uint64_t>::iterator s =
+    std::find(streams.begin(), streams.end(), stream);
+  if(s != streams.end()) streams.erase(s);
+
+  waiting.push_back(con);
+}
+
+// A connection waiting on a coalesced request went away. Returns true if
+// others are still waiting, in which case the request carries on (with
+// the first follower taking over when it was the original).
+bool Server::leave_flight(InflightMap::iterator i, int connection) {
+  Flights::iterator f = flights_.find(i->first);
+  if(f == flights_.end() || f->second.followers.empty()) return false;
+
+  std::vector<int>& followers = f->second.followers;
+
+  if(i->second.connection == connection) {
+    i->second.connection = followers.front();
+    followers.erase(followers.begin());
+  } else {
+    std::vector<int>::iterator j =
+      std::find(followers.begin(), followers.end(), connection);
+    if(j != followers.end()) followers.erase(j);
+  }
+
+  return true;
+}
+
+void Server::send_reply(Reply& rep) {
+  if(rep.flags() & eChunk) {
+    send_chunk(rep);
+    return;
+  }
+
+  if(rep.flags() & eSocket) {
+    send_socket(rep);
+    return;
+  }
+
+  uint64_t stream = rep.stream_id();
+
+  // A reply to a hedged copy answers the original request.
+  std::map<uint64_t, uint64_t>::iterator orig = hedges_.find(stream);
+  if(orig != hedges_.end()) stream = orig->second;
+
+  if(expired_.erase(stream)) {
+    debugs << "Dropping late reply for stream " << stream << "\n";
+    stats_.late_replies++;
+    return;
+  }
+
+  InflightMap::iterator i = inflight_.find(stream);
+
+  if(i != inflight_.end() && i->second.hedge) {
+    const Routes::Route* route = i->second.route;
+    bool hedge_won = rep.stream_id() == i->second.hedge;
+
+    i->second.hedge_won = hedge_won;
+    if(hedge_won) stats_.hedge_wins++;
+
+    // Whichever copy lost is no longer wanted.
+    if(route->cancel) {
+      Cancels cancels;
+
+      if(hedge_won) {
+        BatchKey key(route->destination, i->second.cls);
+        cancels[key].add_stream_ids(stream);
+      } else {
+        BatchKey key(route->hedge_destination, i->second.cls);
+        cancels[key].add_stream_ids(i->second.hedge);
+      }
+
+      send_cancels(cancels);
+    }
+  }
+
+  // Where the rest of a streamed reply will come from.
+  const Routes::Route* route = 0;
+  std::string source;
+  int cls = 0;
+
+  if(rep.more_p() && i != inflight_.end()) {
+    route = i->second.route;
+    cls = i->second.cls;
+
+    bool hedge_won = i->second.hedge && rep.stream_id() == i->second.hedge;
+    source = hedge_won ? route->hedge_destination : route->destination;
+  }
+
+  // Taken before finish() forgets the stream.
+  CacheFill fill;
+  CacheFills::iterator f = cache_fills_.find(stream);
+
+  if(f != cache_fills_.end()) {
+    fill.base.swap(f->second.base);
+    fill.headers.swap(f->second.headers);
+    cache_fills_.erase(f);
+  }
+
+  std::vector<Connection*> waiting;
+  finish(stream, rep.status() >= 500 ? eFailed : eSucceeded, waiting);
+
+  bool cacheable = !fill.base.empty() && rep.status() == 200 &&
+                   !rep.more_p();
+
+  if(waiting.empty() && !cacheable) {
+    debugs << "Dropping reply for closed or cancelled stream "
+           << rep.stream_id() << "\n";
+
+    // Nobody is left to read the rest of it.
+    if(route && route->cancel) {
+      Cancels cancels;
+      cancels[BatchKey(source, cls)].add_stream_ids(rep.stream_id());
+      send_cancels(cancels);
+    }
+
+    return;
+  }
+
+  stats_.replies += waiting.size();
+
+  std::stringstream out;
+  out << "HTTP/1.1 " << rep.status() << " Did it\r\n";
+
+  Reply::Header h;
+  std::string cache_control, vary;
+
+  for(int i = 0; i < rep.headers_size(); i++) {
+    if(!rep.header(i, h)) continue;
+
+    out.write(h.name, h.name_size);
+    out << ": ";
+    out.write(h.value, h.value_size);
+    out << "\r\n";
+
+    if(!cacheable) continue;
+
+    if(header_is(h, "cache-control")) {
+      cache_control.assign(h.value, h.value_size);
+    } else if(header_is(h, "vary")) {
+      vary.assign(h.value, h.value_size);
+    } else if(header_is(h, "set-cookie")) {
+      cacheable = false;
+    }
+  }
+
+  if(rep.more_p()) {
+    start_stream(rep, *route, source, cls, waiting, out.str());
+    return;
+  }
+
+  out << "Content-Length: " << rep.body_size() << "\r\n";
+
+  out << "\r\n";
+
+  debugs << "<DEBUG>\n" << out.str() << "\n</DEBUG>\n";
+
+  if(cacheable && !cache_control.empty()) {
+    std::string head = out.str();
+    Segment response(head.size() + rep.body_size());
+
+    memcpy(response.bytes(), head.data(), head.size());
+    memcpy(response.bytes() + head.size(), rep.body(), rep.body_size());
+
+    if(cache_->store(fill.base, fill.headers, cache_control, vary,
+                     response, loop_.now())) {
+      stats_.cache_stores++;
+
+      for(size_t i = 0; i < waiting.size(); i++) {
+        waiting[i]->write(response, response.bytes(), response.size());
+      }
+
+      return;
+    }
+  }
+
+  // The body goes out straight from the segment it was read into, to
+  // every connection waiting on it.
+  std::string head = out.str();
+
+  for(size_t i = 0; i < waiting.size(); i++) {
+    waiting[i]->write(head, rep.segment(), rep.body(), rep.body_size());
+  }
+}
+
+
+// The head of a streamed reply, with whatever body came with it as the
+// first chunk. Each reader keeps the stream in its streams() until the
+// end, so a client that goes away cancels it, and has no more requests
+// read until then, so that no later reply can land in the middle of it.
+// A reader still waiting on earlier requests is sent it whole at the end
+// instead, and an HTTP/1.0 one unframed, closing after.
+void Server::start_stream(Reply& rep, const Routes::Route& route,
+                          const std::string& destination, int cls,
+                          std::vector<Connection*>& waiting,
+                          const std::string& head) {
+  uint64_t stream = rep.stream_id();
+
+  StreamedMap::iterator s = streamed_.insert(
+      std::make_pair(stream, Streamed(destination, cls, route.cancel))).first;
+
+  s->second.head = head;
+
+  for(size_t i = 0; i < waiting.size(); i++) {
+    Connection* con = waiting[i];
+
+    s->second.connections.push_back(con->id());
+
+    if(!con->streams().empty()) {
+      s->second.collecting.push_back(con->id());
+    } else {
+      if(con->http10_p()) s->second.unframed.push_back(con->id());
+      con->pause_reading();
+    }
+
+    con->streams().push_back(stream);
+  }
+
+  stats_.streamed++;
+
+  write_chunk(s, rep, true);
+}
+
+void Server::send_chunk(Reply& rep) {
+  StreamedMap::iterator s = streamed_.find(rep.stream_id());
+
+  if(s == streamed_.end()) {
+    debugs << "Dropping chunk for closed or cancelled stream "
+           << rep.stream_id() << "\n";
+    return;
+  }
+
+  write_chunk(s, rep, false);
+}
+
+// Writes the reply's body as the next chunk to everyone reading the
+// stream, after the head when it's the first, ending the body after the
+// last. The body goes out straight from the segment it was read into,
+// like a whole reply's.
+void Server::write_chunk(StreamedMap::iterator s, Reply& rep, bool first) {
+  uint64_t stream = s->first;
+  bool end = !rep.more_p();
+  int size = rep.body_size();
+
+  std::string head, unframed_head;
+
+  if(first) {
+    head = s->second.head + "Transfer-Encoding: chunked\r\n\r\n";
+    unframed_head = s->second.head + "Connection: close\r\n\r\n";
+  }
+
+  if(s->second.chunk_open) head += "\r\n";
+  s->second.chunk_open = size > 0;
+
+  if(size > 0) {
+    char line[16];
+    snprintf(line, sizeof(line), "%x\r\n", size);
+    head += line;
+  }
+
+  std::string tail;
+
+  if(end) {
+    tail = size > 0 ? "\r\n0\r\n\r\n" : "0\r\n\r\n";
+  }
+
+  if(size == 0) {
+    head += tail;
+    tail.clear();
+  }
+
+  std::vector<Connection*> readers, unframed, collecting;
+  Streamed& st = s->second;
+
+  for(size_t i = 0; i < st.connections.size(); i++) {
+    int id = st.connections[i];
+
+    ConnectionMap::iterator c = connections_.find(id);
+    if(c == connections_.end()) continue;
+
+    if(std::count(st.collecting.begin(), st.collecting.end(), id)) {
+      collecting.push_back(c->second);
+    } else if(std::count(st.unframed.begin(), st.unframed.end(), id)) {
+      unframed.push_back(c->second);
+    } else {
+      readers.push_back(c->second);
+    }
+  }
+
+  if(!collecting.empty()) {
+    st.body.append((const char*)rep.body(), size);
+  }
+
+  std::string whole;
+
+  if(end && !collecting.empty()) {
+    std::stringstream out;
+    out << st.head << "Content-Length: " << st.body.size() << "\r\n\r\n";
+
+    whole = out.str() + st.body;
+  }
+
+  // Done with the stream before writing, since a failed write closes its
+  // connection and cancels whatever it was reading.
+  if(end) {
+    for(size_t i = 0; i < st.connections.size(); i++) {
+      ConnectionMap::iterator c = connections_.find(st.connections[i]);
+      if(c == connections_.end()) continue;
+
+      std::vector<uint64_t>& streams = c->second->streams();
+
+      std::vector<uint64_t>::iterator j =
+        std::find(streams.begin(), streams.end(), stream);
+      if(j != streams.end()) streams.erase(j);
+    }
+
+    streamed_.erase(s);
+  }
+
+  for(size_t i = 0; i < readers.size(); i++) {
+    if(size > 0) {
+      readers[i]->write(head, rep.segment(), rep.body(), size);
+    } else if(!head.empty()) {
+      readers[i]->write(head);
+    }
+
+    if(!tail.empty()) readers[i]->write(tail);
+    if(end) readers[i]->resume_reading();
+  }
+
+  for(size_t i = 0; i < unframed.size(); i++) {
+    if(first) unframed[i]->write(unframed_head);
+    if(size > 0) unframed[i]->write(rep.segment(), rep.body(), size);
+    if(end) unframed[i]->close_when_drained();
+  }
+
+  for(size_t i = 0; i < collecting.size() && end; i++) {
+    collecting[i]->write(whole);
+  }
+
+  if(!end) {
+    readers.insert(readers.end(), unframed.begin(), unframed.end());
+    check_backlog(stream, readers);
+  }
+}
+
+// Pauses the stream once a reader has fallen cPauseBacklog behind, and
+// drops readers that keep falling behind regardless.
+void Server::check_backlog(uint64_t stream,
+                           std::vector<Connection*>& readers) {
+  StreamedMap::iterator s = streamed_.find(stream);
+  if(s == streamed_.end()) return;
+
+  std::vector<Connection*> overrun;
+
+  for(size_t i = 0; i < readers.size(); i++) {
+    size_t backlog = readers[i]->backlog();
+
+    if(backlog > cPauseBacklog && !s->second.paused) {
+      s->second.paused = true;
+      stats_.stream_pauses++;
+      flow(s->second.destination, s->second.cls, s->first, true);
+    }
+
+    if(backlog > cMaxStreamBacklog) overrun.push_back(readers[i]);
+  }
+
+  // Nor is it collected past that for anyone to be sent whole.
+  if(s->second.body.size() > cMaxStreamBacklog) {
+    std::vector<int>& ids = s->second.collecting;
+
+    for(size_t i = 0; i < ids.size(); i++) {
+      ConnectionMap::iterator c = connections_.find(ids[i]);
+      if(c != connections_.end()) overrun.push_back(c->second);
+    }
+
+    s->second.body.clear();
+  }
+
+  for(size_t i = 0; i < overrun.size(); i++) {
+    std::cerr << "Dropping connection " << overrun[i]->id()
+              << " after falling " << overrun[i]->backlog()
+              << " bytes behind stream " << stream << "\n";
+
+    stats_.stream_overruns++;
+    overrun[i]->signal_cleanup();
+  }
+}
+
+// connection is gone; a stream with no one left reading it is cancelled.
+void Server::leave_stream(Cancels& cancels, uint64_t stream,
+                          int connection) {
+  StreamedMap::iterator s = streamed_.find(stream);
+  if(s == streamed_.end()) return;
+
+  std::vector<int>& ids = s->second.connections;
+  ids.erase(std::remove(ids.begin(), ids.end(), connection), ids.end());
+
+  std::vector<int>& unframed = s->second.unframed;
+  unframed.erase(std::remove(unframed.begin(), unframed.end(), connection),
+                 unframed.end());
+
+  std::vector<int>& collecting = s->second.collecting;
+  collecting.erase(
+      std::remove(collecting.begin(), collecting.end(), connection),
+      collecting.end());
+
+  if(!ids.empty()) return;
+
+  if(s->second.cancel) {
+    cancels[BatchKey(s->second.destination, s->second.cls)]
+      .add_stream_ids(stream);
+  }
+
+  streamed_.erase(s);
+  stats_.cancelled++;
+}
+
+void Server::flow(const std::string& destination, int cls, uint64_t stream,
+                  bool pause) {
+  http::Flow msg;
+
+  if(pause) {
+    msg.add_paused(stream);
+  } else {
+    msg.add_resumed(stream);
+  }
+
+  debugs << (pause ? "Pausing" : "Resuming") << " stream " << stream
+         << " on " << destination << "\n";
+
+  std::string payload = msg.SerializeAsString();
+  std::vector<uint64_t> none;
+
+  send_payload(destination, payload, eFlow, none, cls, false);
+}
+
+// Called as con's queued writes go out: resumes the paused streams it's
+// reading once none of their readers are far behind.
+void Server::drained(Connection& con) {
+  if(con.backlog() > cResumeBacklog) return;
+
+  WebSocket* ws = con.websocket();
+
+  if(ws && ws->paused_p()) {
+    ws->set_paused(false);
+    flow(ws->destination(), ws->cls(), ws->stream(), false);
+  }
+
+  // An event stream reader that skipped events gets the latest one.
+  std::map<int, std::string>::iterator l = listeners_.find(con.id());
+
+  if(l != listeners_.end()) {
+    Subscription& sub = topics_[l->second];
+    Subscription::Reader& reader = sub.readers()[con.id()];
+
+    if(reader.skipped) {
+      const Segment& last = sub.last();
+
+      reader.skipped = 0;
+      write_event(con, last);
+    }
+  }
+
+  std::vector<uint64_t>& streams = con.streams();
+
+  for(size_t j = 0; j < streams.size(); j++) {
+    StreamedMap::iterator s = streamed_.find(streams[j]);
+    if(s == streamed_.end() || !s->second.paused) continue;
+
+    std::vector<int>& ids = s->second.connections;
+    bool behind = false;
+
+    for(size_t i = 0; i < ids.size() && !behind; i++) {
+      ConnectionMap::iterator c = connections_.find(ids[i]);
+
+      behind = c != connections_.end() &&
+               c->second->backlog() > cResumeBacklog;
+    }
+
+    if(behind) continue;
+
+    s->second.paused = false;
+    flow(s->second.destination, s->second.cls, s->first, false);
+  }
+}
+
+// req asked con to upgrade to a WebSocket on a route that takes them. The
+// socket's queue is declared and subscribed to before the destination
+// hears of it, so there's somewhere for its first answer to go.
+WebSocket* Server::open_socket(Connection& con, http::Request& req) {
+  const Routes::Route& route = routes_.match(req.url());
+
+  WebSocket* ws = new WebSocket(*this, con, next_id(), route.destination,
+                                traffic_class(fair_, route, req));
+
+  if(!ws->handshake(req)) {
+    delete ws;
+    return 0;
+  }
+
+  sockets_[ws->stream()] = ws;
+
+  send_action(eMakeEphemeralQueue, ws->queue());
+  send_action(eSubscribe, ws->queue());
+
+  ws->open(req);
+
+  stats_.sockets++;
+
+  return ws;
+}
+
+// A message from a socket's queue. As with a streamed reply, the
+// destination is paused while the client has cPauseBacklog unwritten, and
+// a client cMaxStreamBacklog behind is dropped.
+void Server::send_socket(Reply& rep) {
+  Sockets::iterator s = sockets_.find(rep.stream_id());
+
+  if(s == sockets_.end()) {
+    debugs << "Dropping message for closed socket "
+           << rep.stream_id() << "\n";
+    return;
+  }
+
+  WebSocket* ws = s->second;
+  Connection& con = ws->connection();
+
+  ws->send(rep);
+
+  if(!rep.more_p()) return;
+
+  size_t backlog = con.backlog();
+
+  if(backlog > cMaxStreamBacklog) {
+    std::cerr << "Dropping connection " << con.id()
+              << " after falling " << backlog
+              << " bytes behind socket " << ws->stream() << "\n";
+
+    stats_.socket_overruns++;
+    con.signal_cleanup();
+  } else if(backlog > cPauseBacklog && !ws->paused_p()) {
+    ws->set_paused(true);
+    stats_.socket_pauses++;
+    flow(ws->destination(), ws->cls(), ws->stream(), true);
+  }
+}
+
+// The socket is gone; anything still arriving on its queue is dropped.
+// There's no action to unsubscribe, so the queue itself lasts as long as
+// the broker link.
+void Server::close_socket(uint64_t stream) {
+  sockets_.erase(stream);
+}
+
+// Actions take effect on the link they arrive on, which for a subscription
+// has to be the one replies come back on, so they never use the bulk link.
+void Server::send_action(int type, const std::string& payload) {
+  std::vector<wire::Message> msgs;
+  add_action(msgs, type, payload);
+
+  if(shm_) {
+    if(!shm_->write(msgs[0])) {
+      std::cerr << "Shared memory link unavailable, dropping action "
+                << type << "\n";
+    }
+  } else if(!broker_) {
+    queue_->write(msgs[0]);
+  } else if(!broker_->push(producer_, msgs[0])) {
+    std::cerr << "Broker ring full, dropping action " << type << "\n";
+  }
+}
+
+// A topic message as a server-sent event, with the chunk framing around
+// it, so the same bytes can be written to every reader.
+static Segment encode_event(uint64_t id, const uint8_t* data, size_t size) {
+  char line[32];
+  snprintf(line, sizeof(line), "id: %llu\n", (unsigned long long)id);
+
+  std::string event(line);
+
+  const uint8_t* p = data;
+  const uint8_t* end = data + size;
+
+  // Each line of the message is a data line of the event, lines ending
+  // in CR, LF or CRLF as they do for the client parsing them.
+  for(;;) {
+    const uint8_t* stop = p;
+    while(stop < end && *stop != '\r' && *stop != '\n') stop++;
+
+    event += "data: ";
+    event.append((const char*)p, stop - p);
+    event += "\n";
+
+    if(stop == end) break;
+
+    p = stop + 1;
+    if(*stop == '\r' && p < end && *p == '\n') p++;
+  }
+
+  event += "\n";
+
+  snprintf(line, sizeof(line), "%lx\r\n", (unsigned long)event.size());
+
+  std::string chunk(line);
+  chunk += event;
+  chunk += "\r\n";
+
+  Segment seg(chunk.size());
+  memcpy(seg.bytes(), chunk.data(), chunk.size());
+
+  return seg;
+}
+
+// Writes an event from encode_event to con, without the chunk framing
+// when con is an HTTP/1.0 client reading until we close.
+void Server::write_event(Connection& con, const Segment& event) {
+  if(!con.http10_p()) {
+    con.write(event, event.bytes(), event.size());
+    return;
+  }
+
+  const uint8_t* p =
+    (const uint8_t*)memchr(event.bytes(), '\n', event.size()) + 1;
+
+  con.write(event, p, event.bytes() + event.size() - 2 - p);
+}
+
+// con's request on an events route: GETs are answered with an event
+// stream. The loop subscribes to a topic the first time a client asks
+// for it and stays subscribed, as the broker has no way to unsubscribe.
+void Server::subscribe(Connection& con, const Routes::Route& route,
+                       http::Request& req) {
+  if(!req.has_method() || req.method() != http::Request_Method_GET) {
+    static std::string sNotAllowed(
+        "HTTP/1.1 405 Method Not Allowed\r\n"
+        "Allow: GET\r\n"
+        "Content-Length: 0\r\n\r\n");
+
+    con.write(sNotAllowed);
+    return;
+  }
+
+  static std::string sEventStream(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/event-stream\r\n"
+      "Cache-Control: no-cache\r\n"
+      "Transfer-Encoding: chunked\r\n\r\n");
+
+  // An HTTP/1.0 client can't take chunks, so its events end when we close.
+  static std::string sUnframedEventStream(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/event-stream\r\n"
+      "Cache-Control: no-cache\r\n"
+      "Connection: close\r\n\r\n");
+
+  std::string rest = req.url().substr(route.prefix.size());
+  std::string topic = route.destination + rest.substr(0, rest.find('?'));
+
+  Topics::iterator t = topics_.find(topic);
+
+  if(t == topics_.end()) {
+    t = topics_.insert(std::make_pair(topic, Subscription())).first;
+
+    // A link shared by loops is only subscribed once.
+    if(!broker_ || broker_->claim_topic(topic)) {
+      send_action(eMakeBroadcastQueue, topic);
+      send_action(eSubscribe, topic);
+    }
+  }
+
+  con.write(con.http10_p() ? sUnframedEventStream : sEventStream);
+
+  t->second.add(con.id());
+  listeners_[con.id()] = topic;
+
+  stats_.event_streams++;
+}
+
+// A message published to a topic becomes one event, encoded once and
+// written to every reader that's keeping up. A reader with cPauseBacklog
+// unwritten skips it and is sent the latest event once it drains, so a
+// slow client sees fewer updates rather than ever older ones. False if
+// rep wasn't published to a topic.
+bool Server::publish(Reply& rep) {
+  if(!rep.topic_p()) return false;
+
+  Topics::iterator t = topics_.find(rep.destination());
+  if(t == topics_.end()) return true;
+
+  Subscription& sub = t->second;
+  Subscription::Readers& readers = sub.readers();
+
+  if(readers.empty()) return true;
+
+  Segment event = encode_event(sub.next_id(), rep.payload(),
+                               rep.payload_size());
+  sub.set_last(event);
+
+  stats_.events++;
+
+  std::vector<Connection*> overrun;
+
+  for(Subscription::Readers::iterator r = readers.begin();
+      r != readers.end();
+      ++r) {
+    ConnectionMap::iterator c = connections_.find(r->first);
+    if(c == connections_.end()) continue;
+
+    Connection* con = c->second;
+
+    if(con->backlog() > cPauseBacklog) {
+      stats_.events_coalesced++;
+      if(++r->second.skipped > cMaxSkippedEvents) overrun.push_back(con);
+      continue;
+    }
+
+    r->second.skipped = 0;
+    write_event(*con, event);
+  }
+
+  for(size_t i = 0; i < overrun.size(); i++) {
+    std::cerr << "Dropping connection " << overrun[i]->id()
+              << " after skipping " << cMaxSkippedEvents
+              << " events on " << t->first << "\n";
+
+    stats_.event_overruns++;
+    overrun[i]->signal_cleanup();
+  }
+
+  return true;
+}
+
+void Server::unsubscribe(Connection& con) {
+  std::map<int, std::string>::iterator l = listeners_.find(con.id());
+  if(l == listeners_.end()) return;
+
+  topics_[l->second].remove(con.id());
+  listeners_.erase(l);
+}
+
+// For connections that don't come from accept(), such as the streams of
+// an HTTP/2 connection.
+void Server::add_connection(Connection* con) {
+  connections_[con->id()] = con;
+}
+
+void Server::remove_connection(Connection* con) {
+  connections_.erase(con->id());
+  timers_.cancel(con->timer());
+
+  // Have cleanup run once the current callbacks are done, rather than
+  // after the loop next wakes up, which may not be for a while when it's
+  // us closing the connection.
+  if(closing_connections_.empty()) cleanup_watcher_.feed_event(EV_CHECK);
+
+  closing_connections_.push_back(con);
+
+  unsubscribe(*con);
+  cancel(*con);
+}
+
+// (Re)starts con's timer for what it's now waiting on the client for.
+void Server::arm_timeout(Connection& con, Timeout timeout) {
+  double after = timeout == eIdleTimeout ? timeouts_.idle
+               : timeout == eHeaderTimeout ? timeouts_.header
+               : timeout == eBodyTimeout ? timeouts_.body
+               : cLingerTimeout;
+
+  con.set_timeout(timeout);
+
+  if(after <= 0) {
+    timers_.cancel(con.timer());
+    return;
+  }
+
+  // The tick under way is already partly gone, so one more is allowed
+  // rather than fire early.
+  timers_.schedule(con.timer(), (uint64_t)(loop_.now() / cTimeoutTick),
+                   (uint64_t)(after / cTimeoutTick) + 1);
+
+  if(!timeout_watcher_.is_active()) {
+    timeout_watcher_.start(cTimeoutTick, cTimeoutTick);
+  }
+}
+
+void Server::disarm_timeout(Connection& con) {
+  timers_.cancel(con.timer());
+}
+
+void Server::on_timeout(ev::timer& w, int revents) {
+  std::vector<int> expired;
+  timers_.advance((uint64_t)(loop_.now() / cTimeoutTick), expired);
+
+  for(size_t i = 0; i < expired.size(); i++) {
+    ConnectionMap::iterator c = connections_.find(expired[i]);
+    if(c != connections_.end()) timed_out(*c->second);
+  }
+
+  if(timers_.empty_p()) timeout_watcher_.stop();
+}
+
+// A connection that's only quiet because it's waiting on us gets another
+// idle timeout. A client too slow with a request is told so unless that
+// would land in the middle of an earlier request's reply; an HTTP/2
+// client, slow with its preface or idle, is sent a GOAWAY.
+void Server::timed_out(Connection& con) {
+  switch(con.timeout()) {
+  case eIdleTimeout:
+    if(!idle_p(con)) {
+      arm_timeout(con, eIdleTimeout);
+      return;
+    }
+
+    stats_.idle_timeouts++;
+    break;
+  case eHeaderTimeout:
+    stats_.header_timeouts++;
+    if(con.streams().empty() && !con.h2_p()) con.write(sRequestTimeout);
+    break;
+  case eBodyTimeout:
+    stats_.body_timeouts++;
+    if(con.streams().empty() && !con.h2_p()) con.write(sRequestTimeout);
+    break;
+  case eLingerTimeout:
+    break;
+  }
+
+  con.go_away();
+}
+
+// Between requests and not waiting on us, for a reply, for one to finish
+// writing, or for the next event on an event stream.
+bool Server::idle_p(Connection& con) {
+  return con.idle_p() && !listeners_.count(con.id());
+}
+
+// The client is gone, so tell each destination that opted in which of
+// its streams are no longer wanted. Any reply that still shows up is
+// dropped in send_reply.
+void Server::cancel(Connection& con) {
+  std::vector<uint64_t>& streams = con.streams();
+  if(streams.empty()) return;
+
+  Cancels cancels;
+
+  for(size_t j = 0; j < streams.size(); j++) {
+    InflightMap::iterator i = inflight_.find(streams[j]);
+
+    if(i == inflight_.end()) {
+      leave_stream(cancels, streams[j], con.id());
+      continue;
+    }
+
+    if(leave_flight(i, con.id())) continue;
+
+    collect_cancels(cancels, i);
+    forget(i, eAbandoned);
+    stats_.cancelled++;
+  }
+
+  streams.clear();
+
+  send_cancels(cancels);
+}
+
+// Add an inflight request, and its hedged copy if one was sent, to the
+// cancels for destinations that opted in.
+void Server::collect_cancels(Cancels& cancels, InflightMap::iterator i) {
+  const Routes::Route* route = i->second.route;
+  if(!route->cancel) return;
+
+  cancels[BatchKey(route->destination, i->second.cls)]
+    .add_stream_ids(i->first);
+
+  if(i->second.hedge) {
+    cancels[BatchKey(route->hedge_destination, i->second.cls)]
+      .add_stream_ids(i->second.hedge);
+  }
+}
+
+// Cancels travel in the same class as their requests, so one can't jump
+// ahead of its request in the fair queue.
+void Server::send_cancels(Cancels& cancels) {
+  for(Cancels::iterator i = cancels.begin(); i != cancels.end(); ++i) {
+    const BatchKey& key = i->first;
+
+    // A request still waiting in a batch must reach the worker before
+    // its cancel does.
+    Batches::iterator b = batches_.find(key);
+    if(b != batches_.end() && !b->second.empty_p()) {
+      flush_batch(key, b->second, false);
+    }
+
+    b = bulk_batches_.find(key);
+    if(b != bulk_batches_.end() && !b->second.empty_p()) {
+      flush_batch(key, b->second, true);
+    }
+
+    debugs << "Cancelling " << i->second.stream_ids_size()
+           << " streams on " << key.first << "\n";
+
+    std::string payload = i->second.SerializeAsString();
+    std::vector<uint64_t> none;
+
+    send_payload(key.first, payload, eCancel, none, key.second, false);
+  }
+}
+
+void Server::on_deadline(ev::timer& w, int revents) {
+  ev_tstamp now = loop_.now();
+
+  while(!deadlines_.empty() && deadlines_.begin()->first <= now) {
+    expire(deadlines_.begin()->second);
+  }
+
+  arm_deadline();
+}
+
+// The deadline passed with no reply: answer with a 504 and, if the
+// route's workers understand it, cancel the request.
+void Server::expire(uint64_t stream) {
+  InflightMap::iterator i = inflight_.find(stream);
+  if(i == inflight_.end()) return;
+
+  Cancels cancels;
+  collect_cancels(cancels, i);
+
+  // How long it waited is only a lower bound on the round trip, but it's
+  // exactly the kind of sample the limiter needs to back off.
+  std::vector<Connection*> waiting;
+  finish(stream, eFailed, waiting);
+
+  stats_.expired++;
+
+  expired_.insert(stream);
+  if(expired_.size() > cMaxExpired) expired_.erase(expired_.begin());
+
+  for(size_t j = 0; j < waiting.size(); j++) {
+    waiting[j]->write(sTimeout);
+  }
+
+  send_cancels(cancels);
+}
+
+void Server::arm_deadline() {
+  deadline_watcher_.stop();
+
+  if(deadlines_.empty()) return;
+
+  ev_tstamp after = deadlines_.begin()->first - loop_.now();
+  deadline_watcher_.start(after > 0 ? after : 0, 0);
+}
+
+Hedger& Server::hedger(const Routes::Route& route) {
+  Hedgers::iterator i = hedgers_.find(&route);
+
+  if(i == hedgers_.end()) {
+    i = hedgers_.insert(std::make_pair(&route, Hedger())).first;
+    i->second.set_percentile(route.hedge_percentile);
+  }
+
+  return i->second;
+}
+
+void Server::on_hedge(ev::timer& w, int revents) {
+  ev_tstamp now = loop_.now();
+
+  while(!hedge_times_.empty() && hedge_times_.begin()->first <= now) {
+    uint64_t stream = hedge_times_.begin()->second;
+
+    hedge_times_.erase(hedge_times_.begin());
+    hedge(stream);
+  }
+
+  arm_hedge();
+}
+
+// The request has waited longer than most of its route's replies take,
+// so send a copy under a stream of its own, if the budget allows and the
+// hedge destination would take it like any other request.
+void Server::hedge(uint64_t stream) {
+  InflightMap::iterator i = inflight_.find(stream);
+  if(i == inflight_.end()) return;
+
+  Inflight& req = i->second;
+  req.hedge_at = 0;
+
+  HedgeCopies::iterator c = hedge_copies_.find(stream);
+  http::Request* copy = c->second;
+  hedge_copies_.erase(c);
+
+  const Routes::Route& route = *req.route;
+
+  if(admit_hedge(route, req)) {
+    uint64_t id = next_id();
+
+    debugs << "Hedging stream " << stream << " as " << id << " on "
+           << route.hedge_destination << "\n";
+
+    copy->set_stream_id(id);
+    req.hedge = id;
+    hedges_[id] = stream;
+    stats_.hedged++;
+
+    enqueue(route.hedge_destination, req.cls, route, *copy);
+  }
+
+  delete copy;
+}
+
+// Takes a place for req's copy from the hedge destination's breaker, the
+// route's bulkhead and the limiter, and pays for it, or takes nothing.
+bool Server::admit_hedge(const Routes::Route& route, Inflight& req) {
+  Hedger& hedger = this->hedger(route);
+  if(!hedger.affordable_p()) return false;
+
+  Breaker* breaker = this->breaker(route.hedge_destination);
+  bool probe = false;
+
+  if(breaker && !breaker->allow(loop_.now(), probe)) return false;
+
+  if(!admit(route, req.bytes)) {
+    if(breaker) breaker->abandon(probe);
+    return false;
+  }
+
+  if(!limiter_.acquire()) {
+    unadmit(route, req.bytes);
+    if(breaker) breaker->abandon(probe);
+    return false;
+  }
+
+  hedger.spend();
+  req.hedge_probe = probe;
+
+  return true;
+}
+
+void Server::arm_hedge() {
+  hedge_watcher_.stop();
+
+  if(hedge_times_.empty()) return;
+
+  ev_tstamp after = hedge_times_.begin()->first - loop_.now();
+  hedge_watcher_.start(after > 0 ? after : 0, 0);
+}
+
+void Server::connect(std::string addr) {
+  if(addr.compare(0, 4, "shm:") != 0) {
+    queue_ = open_queue(addr, reply_queue_);
+
+    if(queue_ && bulk_threshold_ > 0) {
+      bulk_queue_ = open_queue(addr, reply_queue_ + BULK_REPLY_SUFFIX);
+    }
+
+    return;
+  }
+
+  std::vector<wire::Message> setup;
+  link_setup_messages(setup, reply_queue_, deflate_);
+
+#ifdef __linux
+  shm_ = new ShmLink(ref(this));
+
+  if(!shm_->connect(addr.substr(4))) {
+    delete shm_;
+    shm_ = 0;
+    return;
+  }
+
+  for(std::vector<wire::Message>::iterator i = setup.begin();
+      i != setup.end();
+      ++i) {
+    shm_->write(*i);
+  }
+#else
+  std::cerr << "Shared memory broker links are only supported on Linux\n";
+#endif
+}
+
+Connection* Server::open_queue(std::string addr, std::string reply_queue) {
+  int s = connect_address(addr);
+  if(s < 0) return 0;
+
+  int id = next_connection_id();
+
+  Connection* con = new Connection(ref(this), id, s, 0);
+
+  if(con == NULL) {
+    close(s);
+    return 0;
+  }
+
+  connections_[id] = con;
+
+  con->start_queue();
+
+  std::vector<wire::Message> setup;
+  link_setup_messages(setup, reply_queue, deflate_);
+
+  for(std::vector<wire::Message>::iterator i = setup.begin();
+      i != setup.end();
+      ++i) {
+    con->write(*i);
+  }
+
+  return con;
+}
+
+void Server::set_instance(int pid) {
+  reply_queue_ = instance_queue(REPLY_QUEUE, pid);
+  socket_queue_ = instance_queue(SOCKET_QUEUE, pid);
+
+  // Destinations know streams by id alone, so the pid (which fits in
+  // cPidBits) goes at the top of the counter.
+  next_id_ = (uint64_t)pid << (STREAM_COUNTER_BITS - cPidBits);
+}
 
-  msg.set_destination("+");
-  msg.set_payload(act.SerializeAsString());
+void Server::attach(BrokerThread& broker) {
+  broker_ = &broker;
+  producer_ = broker.add_producer(replies_watcher_);
 
-  con->write(msg);
+  replies_watcher_.start();
 }
@@ -5,25 +5,175 @@
 #include <list>
 #include <string>
 #include <map>
+#include <set>
 
 #include <iostream>
 
 #include "ev++.h"
+#include "harq.hpp"
 #include "debugs.hpp"
 #include "safe_ref.hpp"
 
 #include "option.hpp"
+#include "deflate.hpp"
+#include "route.hpp"
+#include "batch.hpp"
+#include "stats.hpp"
+#include "limiter.hpp"
+#include "fair_queue.hpp"
+#include "breaker.hpp"
+#include "hedge.hpp"
+#include "subscription.hpp"
+#include "timer_wheel.hpp"
+#include "timeouts.hpp"
 
 class Connection;
-
-typedef std::list<Connection*> Connections;
-typedef std::map<int, Connection*> ConnectionMap;
+class BrokerThread;
+class ShmLink;
+class Reply;
+class ResponseCache;
+class WebSocket;
+class HotRestart;
 
 namespace http {
   class Request;
   class Response;
+  class Cancel;
 }
 
+typedef std::list<Connection*> Connections;
+typedef std::map<int, Connection*> ConnectionMap;
+// Batches are kept per destination and traffic class.
+typedef std::pair<std::string, int> BatchKey;
+typedef std::map<BatchKey, Batch> Batches;
+
+// A request handed to the broker that hasn't been answered yet.
+struct Inflight {
+  int connection;
+  const Routes::Route* route;
+  int cls;
+  size_t bytes;   // request body, counted against the route's bulkhead
+  bool probe;     // sent by a half-open breaker
+
+  ev_tstamp start;
+  ev_tstamp deadline;   // 0 when there's no deadline
+
+  ev_tstamp hedge_at;   // when to send a hedged copy, 0 for never
+  uint64_t hedge;       // the hedged copy's stream, once sent
+  bool hedge_probe;     // the copy is the hedge destination's probe
+  bool hedge_won;       // the copy answered first
+
+  Inflight(int c, const Routes::Route* r, int k, size_t b, bool p,
+           ev_tstamp s, ev_tstamp d)
+    : connection(c)
+    , route(r)
+    , cls(k)
+    , bytes(b)
+    , probe(p)
+    , start(s)
+    , deadline(d)
+    , hedge_at(0)
+    , hedge(0)
+    , hedge_probe(false)
+    , hedge_won(false)
+  {}
+};
+
+typedef std::map<uint64_t, Inflight> InflightMap;
+
+// What a route with a bulkhead currently has outstanding.
+struct Bulkhead {
+  int inflight;
+  size_t bytes;
+  uint64_t rejected;
+
+  Bulkhead()
+    : inflight(0)
+    , bytes(0)
+    , rejected(0)
+  {}
+};
+
+typedef std::map<const Routes::Route*, Bulkhead> Bulkheads;
+
+typedef std::map<std::string, Breaker> Breakers;
+
+typedef std::map<const Routes::Route*, Hedger> Hedgers;
+typedef std::map<uint64_t, http::Request*> HedgeCopies;
+
+// What's needed to cache the reply to a request sent on a cache miss.
+struct CacheFill {
+  std::string base;
+  std::string headers;
+
+  CacheFill()
+    : base()
+    , headers()
+  {}
+};
+
+typedef std::map<uint64_t, CacheFill> CacheFills;
+
+// Requests coalesced onto one already inflight: the connections waiting
+// on it besides Inflight::connection.
+struct Flight {
+  std::string key;
+  std::vector<int> followers;
+
+  Flight()
+    : key()
+    , followers()
+  {}
+};
+
+typedef std::map<uint64_t, Flight> Flights;
+
+// A reply whose head has gone out while its body is still arriving in
+// eChunk replies, keyed by the stream it's answered on.
+struct Streamed {
+  std::string destination;   // where the chunks come from
+  int cls;
+  bool cancel;       // the route's cancel option
+  std::vector<int> connections;   // everyone reading it
+  std::vector<int> unframed;      // of those, HTTP/1.0 clients
+  std::vector<int> collecting;    // those sent it whole at the end
+  std::string head;               // less the framing
+  std::string body;               // collected so far
+  bool chunk_open;   // the last chunk went out without its closing CRLF
+  bool paused;       // destination was sent a Flow pausing the stream
+
+  Streamed(const std::string& d, int k, bool c)
+    : destination(d)
+    , cls(k)
+    , cancel(c)
+    , connections()
+    , unframed()
+    , collecting()
+    , head()
+    , body()
+    , chunk_open(false)
+    , paused(false)
+  {}
+};
+
+typedef std::map<uint64_t, Streamed> StreamedMap;
+
+// Bridged WebSockets, by the stream their messages travel on.
+typedef std::map<uint64_t, WebSocket*> Sockets;
+
+// Server-sent event topics this loop has subscribed to, by name.
+typedef std::map<std::string, Subscription> Topics;
+
+// How an inflight request ended, as far as its destination's health is
+// concerned.
+enum Outcome {
+  eAbandoned,   // cancelled, or never sent
+  eSucceeded,
+  eFailed       // a 5xx reply, or no reply before the deadline
+};
+typedef std::set<std::pair<ev_tstamp, uint64_t> > Deadlines;
+typedef std::map<BatchKey, http::Cancel> Cancels;
+
 enum DataStatus {
   eMissing,
   eValid,
@@ -41,25 +191,160 @@ class Server {
   ev::sig sigint_watcher_;
   ev::sig sigterm_watcher_;
   ev::check cleanup_watcher_;
+  ev::async replies_watcher_;
+  ev::prepare flush_watcher_;
+  ev::timer deadline_watcher_;
+  ev::timer requeue_watcher_;
+  ev::timer hedge_watcher_;
+  ev::timer timeout_watcher_;
+  ev::async handoff_watcher_;
+  ev::timer drain_watcher_;
 
   ConnectionMap connections_;
 
+  // Keyed by stream_id; each request gets a stream of its own.
+  InflightMap inflight_;
+
+  // Inflight requests with a deadline, soonest first. deadline_watcher_
+  // is kept armed for the first of them.
+  Deadlines deadlines_;
+
+  // Streams answered with a 504, so a reply turning up later can be
+  // counted as late rather than just dropped.
+  std::set<uint64_t> expired_;
+
+  Stats stats_;
+
+  Limiter limiter_;
+
+  // Only routes with a max_inflight or max_bytes have an entry.
+  Bulkheads bulkheads_;
+
+  // One per destination once it's been sent to, when breaker_threshold_
+  // (a percentage of failed requests) is set.
+  Breakers breakers_;
+  int breaker_threshold_;
+
+  // For routes that hedge: a copy of each hedgeable request, kept until
+  // it's hedged or answered, the times they come due (hedge_watcher_ is
+  // armed for the first), and the original stream of each hedge sent.
+  Hedgers hedgers_;
+  HedgeCopies hedge_copies_;
+  Deadlines hedge_times_;
+  std::map<uint64_t, uint64_t> hedges_;
+
+  // Shared by every loop; 0 when caching is off.
+  ResponseCache* cache_;
+  CacheFills cache_fills_;
+
+  // Inflight requests others may join, by stream and by coalescing key.
+  Flights flights_;
+  std::map<std::string, uint64_t> flight_keys_;
+
+  // Streamed replies still being written to clients.
+  StreamedMap streamed_;
+
+  Sockets sockets_;
+
+  // Event topics, and the topic each event stream's connection reads.
+  Topics topics_;
+  std::map<int, std::string> listeners_;
+
+  // Every client connection's timeout, on one wheel turned by
+  // timeout_watcher_ while anything is on it.
+  Timeouts timeouts_;
+  TimerWheel timers_;
+
+  // Where replies are sent, and under which bridged WebSockets' queues
+  // are; see set_instance.
+  std::string reply_queue_;
+  std::string socket_queue_;
+
+  // With -U: what to tell once we've drained after handing the listening
+  // socket to a newer process, when we have to be done by, and when the
+  // socket we're accepting on was taken over from an older one.
+  HotRestart* restart_;
+  ev_tstamp drain_deadline_;
+  ev_tstamp adopted_at_;
+
   Connections closing_connections_;
 
   uint64_t next_id_;
+  int next_connection_id_;
 
   Connection* queue_;
 
+  // With lanes enabled, requests of at least bulk_threshold_ bytes go out
+  // on bulk_queue_, a second broker link whose replies also arrive
+  // separately, so large transfers never sit in front of small ones.
+  Connection* bulk_queue_;
+  size_t bulk_threshold_;
+
+  // Set when the broker link is owned by a BrokerThread shared with other
+  // loops instead of queue_.
+  BrokerThread* broker_;
+  int producer_;
+
+  // Set instead of queue_ when the broker is reached over shared memory.
+  ShmLink* shm_;
+
+  Deflate deflate_;
+
+  Routes routes_;
+
+  // Requests gathered per destination this loop iteration, sent just
+  // before the loop next blocks, with those for the bulk lane apart.
+  Batches batches_;
+  Batches bulk_batches_;
+
+  // Where payloads wait, by traffic class, while the link is backed up.
+  FairQueue fair_;
+
 public:
 
   ev::dynamic_loop& loop() {
     return loop_;
   }
 
+  Deflate& deflate() {
+    return deflate_;
+  }
+
+  Limiter& limiter() {
+    return limiter_;
+  }
+
+  FairQueue& fair_queue() {
+    return fair_;
+  }
+
+  Routes& routes() {
+    return routes_;
+  }
+
+  Stats& stats() {
+    return stats_;
+  }
+
+  void add_connection(Connection* con);
   void remove_connection(Connection* con);
 
+  // Ids double as reply stream_ids, so the owning loop's producer index
+  // rides in the top bits for the BrokerThread to route replies by.
   uint64_t next_id() {
-    return ++next_id_;
+    const uint64_t mask = ((uint64_t)1 << STREAM_COUNTER_BITS) - 1;
+    return ((uint64_t)producer_ << STREAM_COUNTER_BITS) | (++next_id_ & mask);
+  }
+
+  // Connection ids are ints and only need to be unique among the loop's
+  // open connections, so they're counted apart from stream ids and skip
+  // any still in use once they wrap. 0 is never one.
+  int next_connection_id() {
+    do {
+      next_connection_id_ = (next_connection_id_ + 1) & 0x7fffffff;
+    } while(!next_connection_id_ || connections_.count(next_connection_id_));
+
+    return next_connection_id_;
   }
 
   std::string dname(std::string queue) {
@@ -71,15 +356,127 @@ public:
   Server(std::string db_path, std::string hostaddr, int port);
   ~Server();
   void start();
+  void open_listener();
   void on_connection(ev::io& w, int revents);
 
   void on_signal(ev::sig& w, int revents);
   void cleanup(ev::check& w, int revents);
+  void on_replies(ev::async& w, int revents);
+  void on_flush(ev::prepare& w, int revents);
+  void on_deadline(ev::timer& w, int revents);
+  void on_requeue(ev::timer& w, int revents);
+  void on_hedge(ev::timer& w, int revents);
+  void on_timeout(ev::timer& w, int revents);
+  void on_handoff(ev::async& w, int revents);
+  void on_drain(ev::timer& w, int revents);
+
+  Connection* open_queue(std::string addr, std::string reply_queue);
+
+  void set_bulk_threshold(size_t bytes) {
+    bulk_threshold_ = bytes;
+  }
+
+  void set_cache(ResponseCache* cache) {
+    cache_ = cache;
+  }
+
+  void set_breaker_threshold(int percent) {
+    breaker_threshold_ = percent;
+  }
+
+  void set_timeouts(const Timeouts& timeouts) {
+    timeouts_ = timeouts;
+  }
+
+  // A process that hot restarts (pid non-zero) is connected at the same
+  // time as its predecessor or successor while one of them drains, so it
+  // gets reply and socket queues of its own and numbers its streams
+  // apart from theirs. Set before connect.
+  void set_instance(int pid);
+
+  const std::string& socket_queue() {
+    return socket_queue_;
+  }
+
+  int listener() {
+    return fd_;
+  }
+
+  // Accept on fd, a listening socket taken over at the given time,
+  // rather than opening one.
+  void adopt(int fd, ev_tstamp at);
+
+  void set_restart(HotRestart* restart);
+
+  // Stop accepting and drain; safe to call from any thread.
+  void hand_off();
+
+  void connect(std::string addr);
+  void attach(BrokerThread& broker);
+  void deliver(Connection& con, http::Request& req_);
+  void forward(Connection* con, http::Request& req, const std::string& base);
+  void enqueue(const std::string& destination, int cls,
+               const Routes::Route& route, http::Request& req);
+  Breaker* breaker(const std::string& destination);
+  bool admit(const Routes::Route& route, size_t bytes);
+  void unadmit(const Routes::Route& route, size_t bytes);
+  void serve_stats(Connection& con);
+  void cancel(Connection& con);
+  void collect_cancels(Cancels& cancels, InflightMap::iterator i);
+  void send_cancels(Cancels& cancels);
+  Hedger& hedger(const Routes::Route& route);
+  void hedge(uint64_t stream);
+  bool admit_hedge(const Routes::Route& route, Inflight& req);
+  void arm_hedge();
+  void expire(uint64_t stream);
+  void arm_deadline();
+  void flush_batch(const BatchKey& key, Batch& batch, bool bulk);
+  bool backed_up_p();
+  void send_payload(const std::string& destination, std::string& payload,
+                    uint32_t flags, std::vector<uint64_t>& streams, int cls,
+                    bool bulk);
+  void drain_queue();
+  void transmit(const std::string& destination, std::string& payload,
+                uint32_t flags, std::vector<uint64_t>& streams, bool bulk);
+  void reject(std::vector<uint64_t>& streams, const std::string& response);
+
+  void forget(InflightMap::iterator i, Outcome outcome);
+  void finish(uint64_t stream, Outcome outcome,
+              std::vector<Connection*>& waiting);
+  void detach(int connection, uint64_t stream,
+              std::vector<Connection*>& waiting);
+  bool leave_flight(InflightMap::iterator i, int connection);
+
+  void handle_reply(Reply& rep);
+  void send_reply(Reply& rep);
+
+  void start_stream(Reply& rep, const Routes::Route& route,
+                    const std::string& destination, int cls,
+                    std::vector<Connection*>& waiting,
+                    const std::string& head);
+  void send_chunk(Reply& rep);
+  void write_chunk(StreamedMap::iterator s, Reply& rep, bool first);
+  void check_backlog(uint64_t stream, std::vector<Connection*>& readers);
+  void leave_stream(Cancels& cancels, uint64_t stream, int connection);
+  void flow(const std::string& destination, int cls, uint64_t stream,
+            bool pause);
+  void drained(Connection& con);
+
+  WebSocket* open_socket(Connection& con, http::Request& req);
+  void send_socket(Reply& rep);
+  void close_socket(uint64_t stream);
+  void send_action(int type, const std::string& payload);
 
-  void connect(std::string host, int c_port);
-  void deliver(http::Request& req_);
+  void subscribe(Connection& con, const Routes::Route& route,
+                 http::Request& req);
+  bool publish(Reply& rep);
+  void write_event(Connection& con, const Segment& event);
+  void unsubscribe(Connection& con);
 
-  void send_reply(http::Response& rep);
+  void arm_timeout(Connection& con, Timeout timeout);
+  void disarm_timeout(Connection& con);
+  void timed_out(Connection& con);
+  bool idle_p(Connection& con);
 };
 
 
@@ -0,0 +1,267 @@
+#ifdef __linux
+
+#include "harq.hpp"
+#include "shm_link.hpp"
+#include "server.hpp"
+#include "reply.hpp"
+#include "util.hpp"
+#include "debugs.hpp"
+
+#include "wire.pb.h"
+
+#include <iostream>
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/eventfd.h>
+
+// Each direction gets this much ring; a frame must fit in it whole.
+static const uint64_t cRingSize = 8 * 1024 * 1024;
+
+// Frames waiting for room in the ring are kept to this many bytes, after
+// which writes are refused until it drains.
+static const size_t cMaxBacklog = cRingSize;
+
+// Replies are copied out of the ring into segments of this size.
+static const size_t cChunkSize = 256 * 1024;
+
+static const int cMinSpin = 16;
+static const int cMaxSpin = 4096;
+
+static inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __asm__ __volatile__("pause");
+#endif
+}
+
+ShmLink::ShmLink(Server& s)
+  : server_(s)
+  , ctl_fd_(-1)
+  , mem_fd_(-1)
+  , to_broker_fd_(-1)
+  , to_gateway_fd_(-1)
+  , map_(MAP_FAILED)
+  , map_size_(0)
+  , tx_()
+  , rx_()
+  , wake_w_(s.loop())
+  , ctl_w_(s.loop())
+  , backlog_()
+  , backlog_bytes_(0)
+  , chunk_()
+  , chunk_used_(0)
+  , spin_(cMinSpin)
+{
+  wake_w_.set<ShmLink, &ShmLink::on_wake>(this);
+  ctl_w_.set<ShmLink, &ShmLink::on_control>(this);
+}
+
+ShmLink::~ShmLink() {
+  close_link();
+}
+
+void ShmLink::close_link() {
+  wake_w_.stop();
+  ctl_w_.stop();
+
+  if(map_ != MAP_FAILED) munmap(map_, map_size_);
+  map_ = MAP_FAILED;
+
+  // Nothing will take them now.
+  backlog_.clear();
+  backlog_bytes_ = 0;
+
+  int* fds[] = { &ctl_fd_, &mem_fd_, &to_broker_fd_, &to_gateway_fd_ };
+
+  for(size_t i = 0; i < sizeof(fds) / sizeof(fds[0]); i++) {
+    if(*fds[i] >= 0) close(*fds[i]);
+    *fds[i] = -1;
+  }
+}
+
+bool ShmLink::connect(std::string path) {
+  ctl_fd_ = connect_unix(path);
+  if(ctl_fd_ < 0) return false;
+
+  map_size_ = shm_map_size(cRingSize);
+
+  mem_fd_ = memfd_create("harq-http", MFD_CLOEXEC);
+  if(mem_fd_ < 0 || ftruncate(mem_fd_, map_size_) < 0) {
+    std::cerr << "Unable to create shared memory: " << strerror(errno) << "\n";
+    close_link();
+    return false;
+  }
+
+  map_ = mmap(NULL, map_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+              mem_fd_, 0);
+
+  if(map_ == MAP_FAILED) {
+    std::cerr << "Unable to map shared memory: " << strerror(errno) << "\n";
+    close_link();
+    return false;
+  }
+
+  to_broker_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  to_gateway_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+  if(to_broker_fd_ < 0 || to_gateway_fd_ < 0) {
+    std::cerr << "Unable to create eventfd: " << strerror(errno) << "\n";
+    close_link();
+    return false;
+  }
+
+  ShmHeader* hdr = (ShmHeader*)map_;
+  hdr->magic = cShmMagic;
+  hdr->version = cShmVersion;
+  hdr->ring_size = cRingSize;
+
+  uint8_t* data = (uint8_t*)map_ + (map_size_ - 2 * cRingSize);
+
+  // Space freed in one direction is signalled on the other direction's
+  // eventfd, which is the one the blocked side is already waiting on.
+  tx_.attach(&hdr->to_broker, data, cRingSize,
+             to_broker_fd_, to_gateway_fd_);
+  rx_.attach(&hdr->to_gateway, data + cRingSize, cRingSize,
+             to_gateway_fd_, to_broker_fd_);
+
+  int fds[] = { mem_fd_, to_broker_fd_, to_gateway_fd_ };
+
+  if(!shm_send_fds(ctl_fd_, fds, 3)) {
+    std::cerr << "Unable to hand shared memory to broker\n";
+    close_link();
+    return false;
+  }
+
+  rx_.prepare_sleep();
+
+  wake_w_.start(to_gateway_fd_, EV_READ);
+  ctl_w_.start(ctl_fd_, EV_READ);
+
+  return true;
+}
+
+bool ShmLink::open_p() {
+  return map_ != MAP_FAILED;
+}
+
+bool ShmLink::write(wire::Message& msg) {
+  if(map_ == MAP_FAILED) return false;
+
+  std::string frame;
+
+  if(!msg.SerializeToString(&frame)) {
+    std::cerr << "Error serializing message\n";
+    return false;
+  }
+
+  if(frame.size() + 4 > cRingSize) {
+    std::cerr << "Message of " << frame.size()
+              << " bytes is too large for the shared memory ring\n";
+    return false;
+  }
+
+  if(backlog_.empty() && tx_.write(frame)) return true;
+
+  if(backlog_bytes_ + frame.size() > cMaxBacklog) {
+    debugs << "Shared memory backlog full, refusing frame\n";
+    return false;
+  }
+
+  debugs << "Shared memory ring full, queueing frame\n";
+  backlog_bytes_ += frame.size();
+  backlog_.push_back(frame);
+
+  return true;
+}
+
+void ShmLink::flush_backlog() {
+  while(!backlog_.empty()) {
+    if(!tx_.write(backlog_.front())) return;
+    backlog_bytes_ -= backlog_.front().size();
+    backlog_.pop_front();
+  }
+}
+
+// Copy out every available reply and hand it to the server. Returns
+// true if anything was read.
+bool ShmLink::drain() {
+  bool any = false;
+  int len;
+
+  while((len = rx_.next_size()) >= 0) {
+    if(chunk_.empty_p() || chunk_used_ + len > chunk_.size()) {
+      if(!chunk_.empty_p() && !chunk_.shared_p() &&
+         (size_t)len <= chunk_.size()) {
+        chunk_used_ = 0;
+      } else {
+        chunk_ = Segment((size_t)len > cChunkSize ? len : cChunkSize);
+        chunk_used_ = 0;
+      }
+    }
+
+    uint8_t* frame = chunk_.bytes() + chunk_used_;
+
+    rx_.read(frame, len);
+    chunk_used_ += len;
+    any = true;
+
+    Reply rep;
+
+    if(!rep.parse(chunk_, frame, len) || !rep.inflate(server_.deflate())) {
+      std::cerr << "Unable to parse message from shared memory\n";
+      continue;
+    }
+
+    server_.handle_reply(rep);
+  }
+
+  rx_.release();
+
+  return any;
+}
+
+void ShmLink::on_wake(ev::io& w, int revents) {
+  shm_clear(to_gateway_fd_);
+
+  flush_backlog();
+
+  for(;;) {
+    drain();
+
+    // Under load the next reply is usually only microseconds away, so
+    // poll briefly before paying for another eventfd round trip.
+    bool found = false;
+
+    for(int i = 0; i < spin_; i++) {
+      if(!rx_.empty_p()) {
+        found = true;
+        break;
+      }
+
+      cpu_relax();
+    }
+
+    if(found) {
+      if(spin_ < cMaxSpin) spin_ *= 2;
+      continue;
+    }
+
+    if(spin_ > cMinSpin) spin_ /= 2;
+
+    if(rx_.prepare_sleep()) return;
+  }
+}
+
+void ShmLink::on_control(ev::io& w, int revents) {
+  char buf[64];
+
+  ssize_t r = ::read(ctl_fd_, buf, sizeof(buf));
+  if(r > 0 || (r == -1 && (errno == EAGAIN || errno == EINTR))) return;
+
+  std::cerr << "Broker closed the shared memory link\n";
+  close_link();
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef SHM_LINK_HPP
+#define SHM_LINK_HPP
+
+#include <list>
+#include <string>
+
+#include <ev++.h>
+
+#include "segment.hpp"
+#include "shm_ring.hpp"
+
+class Server;
+
+namespace wire {
+  class Message;
+}
+
+// The gateway end of a shared-memory broker link (see shm_ring.hpp). It
+// stands in for the queue Connection: requests are written into one ring,
+// replies are copied out of the other into segments and handed to the
+// Server just like replies read from a socket.
+class ShmLink {
+  Server& server_;
+
+  int ctl_fd_;
+  int mem_fd_;
+  int to_broker_fd_;
+  int to_gateway_fd_;
+
+  void* map_;
+  size_t map_size_;
+
+  ShmRing tx_;
+  ShmRing rx_;
+
+  ev::io wake_w_;
+  ev::io ctl_w_;
+
+  // Frames that didn't fit in the ring yet, in order, and their total
+  // size, which is kept under cMaxBacklog.
+  std::list<std::string> backlog_;
+  size_t backlog_bytes_;
+
+  // Replies are carved out of this segment until it fills up.
+  Segment chunk_;
+  size_t chunk_used_;
+
+  // How many times to poll the ring before going back to sleep; grows
+  // while polling keeps finding frames and shrinks when it doesn't.
+  int spin_;
+
+  ShmLink(const ShmLink&);
+  ShmLink& operator=(const ShmLink&);
+
+public:
+  ShmLink(Server& s);
+  ~ShmLink();
+
+  bool connect(std::string path);
+
+  // False when the link has closed, or the message is too large for the
+  // ring or for what's left of the backlog, and wasn't sent.
+  bool write(wire::Message& msg);
+
+  bool open_p();
+
+  // Frames are waiting for room in the ring.
+  bool backed_up_p() {
+    return !backlog_.empty();
+  }
+
+private:
+  void on_wake(ev::io& w, int revents);
+  void on_control(ev::io& w, int revents);
+
+  void flush_backlog();
+  bool drain();
+  void close_link();
+};
+
+#endif
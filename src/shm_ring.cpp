@@ -0,0 +1,193 @@
+#ifdef __linux
+
+#include "shm_ring.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+void ShmRing::attach(ShmRingControl* ctl, uint8_t* data, uint64_t size,
+                     int data_fd, int space_fd) {
+  ctl_ = ctl;
+  data_ = data;
+  size_ = size;
+  data_fd_ = data_fd;
+  space_fd_ = space_fd;
+}
+
+void ShmRing::copy_in(uint64_t pos, const uint8_t* src, size_t len) {
+  const size_t off = pos & (size_ - 1);
+  const size_t first = len < size_ - off ? len : size_ - off;
+
+  memcpy(data_ + off, src, first);
+  memcpy(data_, src + first, len - first);
+}
+
+void ShmRing::copy_out(uint64_t pos, uint8_t* dst, size_t len) {
+  const size_t off = pos & (size_ - 1);
+  const size_t first = len < size_ - off ? len : size_ - off;
+
+  memcpy(dst, data_ + off, first);
+  memcpy(dst + first, data_, len - first);
+}
+
+bool ShmRing::write(const uint8_t* frame, uint32_t len) {
+  const uint64_t need = 4 + (uint64_t)len;
+  const uint64_t tail = ctl_->tail;
+  uint64_t head = __atomic_load_n(&ctl_->head, __ATOMIC_ACQUIRE);
+
+  if(size_ - (tail - head) < need) {
+    __atomic_store_n(&ctl_->blocked, 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    // The consumer may have freed space before it could see the flag.
+    head = __atomic_load_n(&ctl_->head, __ATOMIC_ACQUIRE);
+    if(size_ - (tail - head) < need) return false;
+
+    __atomic_store_n(&ctl_->blocked, 0, __ATOMIC_RELAXED);
+  }
+
+  copy_in(tail, (const uint8_t*)&len, 4);
+  copy_in(tail + 4, frame, len);
+
+  __atomic_store_n(&ctl_->tail, tail + need, __ATOMIC_RELEASE);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if(__atomic_load_n(&ctl_->waiting, __ATOMIC_RELAXED) &&
+     __atomic_exchange_n(&ctl_->waiting, 0, __ATOMIC_ACQ_REL)) {
+    shm_wake(data_fd_);
+  }
+
+  return true;
+}
+
+int ShmRing::next_size() {
+  const uint64_t head = ctl_->head;
+  const uint64_t tail = __atomic_load_n(&ctl_->tail, __ATOMIC_ACQUIRE);
+
+  if(head == tail) return -1;
+
+  uint32_t len;
+  copy_out(head, (uint8_t*)&len, 4);
+
+  return len;
+}
+
+void ShmRing::read(uint8_t* out, uint32_t len) {
+  const uint64_t head = ctl_->head;
+
+  copy_out(head + 4, out, len);
+
+  __atomic_store_n(&ctl_->head, head + 4 + len, __ATOMIC_RELEASE);
+}
+
+// Called after a batch of reads to wake a producer that ran out of room.
+void ShmRing::release() {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if(__atomic_load_n(&ctl_->blocked, __ATOMIC_RELAXED) &&
+     __atomic_exchange_n(&ctl_->blocked, 0, __ATOMIC_ACQ_REL)) {
+    shm_wake(space_fd_);
+  }
+}
+
+bool ShmRing::empty_p() {
+  return __atomic_load_n(&ctl_->tail, __ATOMIC_ACQUIRE) == ctl_->head;
+}
+
+bool ShmRing::prepare_sleep() {
+  __atomic_store_n(&ctl_->waiting, 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+  if(!empty_p()) {
+    __atomic_store_n(&ctl_->waiting, 0, __ATOMIC_RELAXED);
+    return false;
+  }
+
+  return true;
+}
+
+size_t shm_map_size(uint64_t ring_size) {
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t header = (sizeof(ShmHeader) + page - 1) & ~(page - 1);
+
+  return header + 2 * ring_size;
+}
+
+bool shm_send_fds(int sock, int* fds, int count) {
+  uint32_t magic = cShmMagic;
+
+  struct iovec iov;
+  iov.iov_base = &magic;
+  iov.iov_len = sizeof(magic);
+
+  char ctrl[CMSG_SPACE(sizeof(int) * 4)];
+  memset(ctrl, 0, sizeof(ctrl));
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = ctrl;
+  msg.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * count);
+  memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * count);
+
+  for(;;) {
+    ssize_t r = sendmsg(sock, &msg, 0);
+    if(r == -1 && errno == EINTR) continue;
+    return r == sizeof(magic);
+  }
+}
+
+bool shm_recv_fds(int sock, int* fds, int count) {
+  uint32_t magic = 0;
+
+  struct iovec iov;
+  iov.iov_base = &magic;
+  iov.iov_len = sizeof(magic);
+
+  char ctrl[CMSG_SPACE(sizeof(int) * 4)];
+
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = ctrl;
+  msg.msg_controllen = CMSG_SPACE(sizeof(int) * count);
+
+  ssize_t r;
+  do {
+    r = recvmsg(sock, &msg, 0);
+  } while(r == -1 && errno == EINTR);
+
+  if(r != sizeof(magic) || magic != cShmMagic) return false;
+
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  if(!cmsg || cmsg->cmsg_level != SOL_SOCKET ||
+     cmsg->cmsg_type != SCM_RIGHTS ||
+     cmsg->cmsg_len != CMSG_LEN(sizeof(int) * count)) {
+    return false;
+  }
+
+  memcpy(fds, CMSG_DATA(cmsg), sizeof(int) * count);
+  return true;
+}
+
+void shm_wake(int fd) {
+  uint64_t one = 1;
+  while(::write(fd, &one, sizeof(one)) == -1 && errno == EINTR);
+}
+
+void shm_clear(int fd) {
+  uint64_t cnt;
+  while(::read(fd, &cnt, sizeof(cnt)) == -1 && errno == EINTR);
+}
+
+#endif
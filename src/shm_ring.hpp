@@ -0,0 +1,106 @@
+#ifndef SHM_RING_HPP
+#define SHM_RING_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <string>
+
+// Shared-memory transport between harq-http and a broker on the same
+// host. The gateway creates one memfd holding a pair of byte rings (one
+// per direction) plus an eventfd per direction, and passes all three fds
+// to the broker over a unix control socket. Both rings carry the same
+// length-prefixed wire::Message frames as a socket link.
+//
+// Mapping layout:
+//
+//   [ ShmHeader (one page) ][ gateway->broker data ][ broker->gateway data ]
+
+static const uint32_t cShmMagic = 0x68617271; // "harq"
+static const uint32_t cShmVersion = 1;
+
+// The control block for one direction. head is only written by the
+// consumer and tail only by the producer; each lives on its own line.
+struct ShmRingControl {
+  uint64_t head;
+  char pad1[56];
+  uint64_t tail;
+  char pad2[56];
+
+  // Set by the consumer before it blocks on its eventfd, so the producer
+  // knows a wakeup is needed. Cleared by whoever delivers the wakeup.
+  uint32_t waiting;
+
+  // Set by the producer when a frame didn't fit, so the consumer knows
+  // to signal it once it has freed space.
+  uint32_t blocked;
+  char pad3[56];
+};
+
+struct ShmHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t ring_size;
+
+  ShmRingControl to_broker;
+  ShmRingControl to_gateway;
+};
+
+class ShmRing {
+  ShmRingControl* ctl_;
+  uint8_t* data_;
+  uint64_t size_;
+
+  // Signalled when frames are published, and when space is freed for a
+  // blocked producer, respectively.
+  int data_fd_;
+  int space_fd_;
+
+  void copy_in(uint64_t pos, const uint8_t* src, size_t len);
+  void copy_out(uint64_t pos, uint8_t* dst, size_t len);
+
+  ShmRing(const ShmRing&);
+  ShmRing& operator=(const ShmRing&);
+
+public:
+  ShmRing()
+    : ctl_(0)
+    , data_(0)
+    , size_(0)
+    , data_fd_(-1)
+    , space_fd_(-1)
+  {}
+
+  void attach(ShmRingControl* ctl, uint8_t* data, uint64_t size,
+              int data_fd, int space_fd);
+
+  // Producer side.
+  bool write(const uint8_t* frame, uint32_t len);
+
+  bool write(const std::string& frame) {
+    return write((const uint8_t*)frame.data(), frame.size());
+  }
+
+  // Consumer side. next_size() returns -1 when the ring is empty, else
+  // the length of the next frame, which read() then copies out.
+  int next_size();
+  void read(uint8_t* out, uint32_t len);
+  void release();
+
+  bool empty_p();
+
+  // Announce that the consumer is about to block. Returns false if a
+  // frame raced in and the caller should keep reading instead.
+  bool prepare_sleep();
+};
+
+// Helpers for setting up and attaching to the shared mapping.
+size_t shm_map_size(uint64_t ring_size);
+
+bool shm_send_fds(int sock, int* fds, int count);
+bool shm_recv_fds(int sock, int* fds, int count);
+
+void shm_wake(int fd);
+void shm_clear(int fd);
+
+#endif
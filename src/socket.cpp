@@ -6,14 +6,13 @@
 
 #include <iostream>
 
+#include <errno.h>
 #include <unistd.h>
 #include <sys/socket.h>
 #include <fcntl.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 
-WriteStatus Socket::write(const std::string& val) {
-  writes_.add(val);
-
+WriteStatus Socket::flush_queued() {
   WriteStatus stat = writes_.flush(fd);
 
   switch(stat) {
@@ -31,6 +30,49 @@ WriteStatus Socket::write(const std::string& val) {
   return stat;
 }
 
+WriteStatus Socket::write(const std::string& val) {
+  writes_.add(val);
+
+  return flush_queued();
+}
+
+// Queue bytes that live in a shared segment; nothing is copied. With
+// nothing queued ahead of them they're written right away, and only what
+// the kernel doesn't take is queued.
+WriteStatus Socket::write(const Segment& seg, const uint8_t* data,
+                          size_t size) {
+#ifndef SIMULATE_BAD_NETWORK
+  if(writes_.empty_p()) {
+    ssize_t r = ::write(fd, data, size);
+
+    if(r == (ssize_t)size) return eOk;
+
+    if(r > 0) {
+      data += r;
+      size -= r;
+    } else if(r < 0 &&
+              errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+      return eFailure;
+    }
+  }
+#endif
+
+  writes_.add(seg, data, size);
+
+  return flush_queued();
+}
+
+// A head followed by shared bytes, flushed together so they can go out
+// in a single writev.
+WriteStatus Socket::write(const std::string& head,
+                          const Segment& seg, const uint8_t* data,
+                          size_t size) {
+  writes_.add(head);
+  writes_.add(seg, data, size);
+
+  return flush_queued();
+}
+
 WriteStatus Socket::write_with_size(const std::string& val) {
   union sz {
     char buf[4];
@@ -44,21 +86,7 @@ WriteStatus Socket::write_with_size(const std::string& val) {
   writes_.add(std::string(sz.buf,4));
   writes_.add(val);
 
-  WriteStatus stat = writes_.flush(fd);
-
-  switch(stat) {
-  case eOk:
-    debugs << "Writes flushed successfully\n";
-    break;
-  case eWouldBlock:
-    debugs << "Writes would have blocked, NOT fully flushed\n";
-    break;
-  case eFailure:
-    debugs << "Writes failed, socket busted\n";
-    break;
-  }
-
-  return stat;
+  return flush_queued();
 }
 
 WriteStatus Socket::write(const wire::Message& msg) {
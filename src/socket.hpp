@@ -16,18 +16,33 @@ public:
   int fd;
 
   Socket(int fd)
-    : fd(fd)
+    : writes_()
+    , fd(fd)
   {}
 
   void set_nonblock();
 
   WriteStatus write(const wire::Message& msg);
   WriteStatus write(const std::string& val);
+  WriteStatus write(const Segment& seg, const uint8_t* data, size_t size);
+  WriteStatus write(const std::string& head,
+                    const Segment& seg, const uint8_t* data, size_t size);
   WriteStatus write_with_size(const std::string& val);
 
+  bool pending_p() {
+    return !writes_.empty_p();
+  }
+
+  size_t pending_bytes() {
+    return writes_.bytes();
+  }
+
   WriteStatus flush() {
     return writes_.flush(fd);
   }
+
+private:
+  WriteStatus flush_queued();
 };
 
 #endif
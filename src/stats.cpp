@@ -0,0 +1,99 @@
+#include "stats.hpp"
+
+#include <sstream>
+
+Stats::Stats()
+  : requests(0)
+  , replies(0)
+  , expired(0)
+  , late_replies(0)
+  , cancelled(0)
+  , rejected(0)
+  , limit(0)
+  , inflight(0)
+  , rtt(0)
+  , rtt_noload(0)
+  , shed(0)
+  , bulkheads("[]")
+  , fast_failed(0)
+  , breakers("[]")
+  , hedged(0)
+  , hedge_wins(0)
+  , coalesced(0)
+  , cache_hits(0)
+  , cache_misses(0)
+  , cache_revalidations(0)
+  , cache_stores(0)
+  , cache("null")
+  , streamed(0)
+  , stream_pauses(0)
+  , stream_overruns(0)
+  , h2_sessions(0)
+  , h2_streams(0)
+  , h2_refused(0)
+  , sockets(0)
+  , socket_messages_in(0)
+  , socket_messages_out(0)
+  , socket_pauses(0)
+  , socket_overruns(0)
+  , event_streams(0)
+  , events(0)
+  , events_coalesced(0)
+  , event_overruns(0)
+  , idle_timeouts(0)
+  , header_timeouts(0)
+  , body_timeouts(0)
+  , takeover_accept(0)
+  , classes("[]")
+{}
+
+std::string Stats::json(int loop) {
+  std::stringstream out;
+
+  out << "{\"loop\":" << loop
+      << ",\"requests\":" << requests
+      << ",\"replies\":" << replies
+      << ",\"expired\":" << expired
+      << ",\"late_replies\":" << late_replies
+      << ",\"cancelled\":" << cancelled
+      << ",\"rejected\":" << rejected
+      << ",\"limit\":" << limit
+      << ",\"inflight\":" << inflight
+      << ",\"rtt_ms\":" << rtt * 1000
+      << ",\"rtt_noload_ms\":" << rtt_noload * 1000
+      << ",\"shed\":" << shed
+      << ",\"bulkheads\":" << bulkheads
+      << ",\"fast_failed\":" << fast_failed
+      << ",\"breakers\":" << breakers
+      << ",\"hedged\":" << hedged
+      << ",\"hedge_wins\":" << hedge_wins
+      << ",\"coalesced\":" << coalesced
+      << ",\"cache_hits\":" << cache_hits
+      << ",\"cache_misses\":" << cache_misses
+      << ",\"cache_revalidations\":" << cache_revalidations
+      << ",\"cache_stores\":" << cache_stores
+      << ",\"cache\":" << cache
+      << ",\"streamed\":" << streamed
+      << ",\"stream_pauses\":" << stream_pauses
+      << ",\"stream_overruns\":" << stream_overruns
+      << ",\"h2_sessions\":" << h2_sessions
+      << ",\"h2_streams\":" << h2_streams
+      << ",\"h2_refused\":" << h2_refused
+      << ",\"sockets\":" << sockets
+      << ",\"socket_messages_in\":" << socket_messages_in
+      << ",\"socket_messages_out\":" << socket_messages_out
+      << ",\"socket_pauses\":" << socket_pauses
+      << ",\"socket_overruns\":" << socket_overruns
+      << ",\"event_streams\":" << event_streams
+      << ",\"events\":" << events
+      << ",\"events_coalesced\":" << events_coalesced
+      << ",\"event_overruns\":" << event_overruns
+      << ",\"idle_timeouts\":" << idle_timeouts
+      << ",\"header_timeouts\":" << header_timeouts
+      << ",\"body_timeouts\":" << body_timeouts
+      << ",\"takeover_accept_ms\":" << takeover_accept * 1000
+      << ",\"classes\":" << classes
+      << "}\n";
+
+  return out.str();
+}
@@ -0,0 +1,102 @@
+#ifndef STATS_HPP
+#define STATS_HPP
+
+#include <stdint.h>
+
+#include <string>
+
+// Counters kept by each loop, served as JSON at STATS_PATH by the loop
+// that accepted the request.
+#define STATS_PATH "/_harq/stats"
+
+struct Stats {
+  uint64_t requests;
+  uint64_t replies;
+
+  // Requests answered with a 504 because their deadline passed, and
+  // replies that showed up for them afterwards.
+  uint64_t expired;
+  uint64_t late_replies;
+
+  uint64_t cancelled;
+
+  // Requests turned away by the concurrency limiter, and the limiter's
+  // state as of the last stats request (RTTs in seconds).
+  uint64_t rejected;
+  int limit;
+  int inflight;
+  double rtt;
+  double rtt_noload;
+
+  // Requests turned away by their route's bulkhead, and each such
+  // route's current usage, already rendered.
+  uint64_t shed;
+  std::string bulkheads;
+
+  // Requests answered straight away because their destination's breaker
+  // was open, and each breaker's state, already rendered.
+  uint64_t fast_failed;
+  std::string breakers;
+
+  // Hedged copies sent, and how many of them answered first.
+  uint64_t hedged;
+  uint64_t hedge_wins;
+
+  // Requests that waited on an identical one already inflight.
+  uint64_t coalesced;
+
+  // Response cache lookups, refreshes sent for stale entries, and
+  // replies stored; plus the (shared) cache's size, already rendered.
+  uint64_t cache_hits;
+  uint64_t cache_misses;
+  uint64_t cache_revalidations;
+  uint64_t cache_stores;
+  std::string cache;
+
+  // Replies streamed in chunks, the pauses sent for them, and clients
+  // dropped for falling too far behind one.
+  uint64_t streamed;
+  uint64_t stream_pauses;
+  uint64_t stream_overruns;
+
+  // HTTP/2 connections, the streams opened on them, and streams refused
+  // for going over the concurrent stream limit.
+  uint64_t h2_sessions;
+  uint64_t h2_streams;
+  uint64_t h2_refused;
+
+  // WebSockets opened, the messages bridged each way, the pauses sent to
+  // their destinations, and clients dropped for falling too far behind.
+  uint64_t sockets;
+  uint64_t socket_messages_in;
+  uint64_t socket_messages_out;
+  uint64_t socket_pauses;
+  uint64_t socket_overruns;
+
+  // Event streams opened, topic messages sent out as events, events
+  // skipped by readers that had fallen behind, and readers dropped for
+  // skipping too many.
+  uint64_t event_streams;
+  uint64_t events;
+  uint64_t events_coalesced;
+  uint64_t event_overruns;
+
+  // Client connections closed for going idle between requests, or for
+  // being too slow sending a request's headers or body.
+  uint64_t idle_timeouts;
+  uint64_t header_timeouts;
+  uint64_t body_timeouts;
+
+  // For a process that took over an older one's listening sockets (-U),
+  // the seconds from getting them to this loop's first accept on them.
+  double takeover_accept;
+
+  // Per traffic class queue metrics, already rendered (see FairQueue).
+  std::string classes;
+
+  Stats();
+
+  std::string json(int loop);
+};
+
+#endif
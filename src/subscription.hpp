@@ -1,29 +1,65 @@
 #ifndef SUBSCRIPTION_HPP
 #define SUBSCRIPTION_HPP
 
-#include <list>
+#include <stdint.h>
 
-#include "wire.pb.h"
+#include <map>
 
+#include "segment.hpp"
+
+// One topic's server-sent events, as far as a loop is concerned: the
+// connections reading it, and the latest event already encoded, which is
+// shared by every reader's write and is what a reader that fell behind is
+// caught up with (see Server::publish).
 class Subscription {
-  typedef std::list<wire::Message> Messages;
+public:
+  struct Reader {
+    uint32_t skipped;   // events passed over since it last got one
+
+    Reader()
+      : skipped(0)
+    {}
+  };
 
-  Messages messages_;
+  // By connection id.
+  typedef std::map<int, Reader> Readers;
+
+private:
+  Readers readers_;
+
+  uint64_t sequence_;
+  Segment last_;
 
 public:
+  Subscription()
+    : readers_()
+    , sequence_(0)
+    , last_()
+  {}
+
+  Readers& readers() {
+    return readers_;
+  }
+
+  void add(int connection) {
+    readers_[connection] = Reader();
+  }
+
+  void remove(int connection) {
+    readers_.erase(connection);
+  }
 
-  bool empty_p() {
-    return messages_.size() == 0;
+  // The id of the next event.
+  uint64_t next_id() {
+    return ++sequence_;
   }
 
-  wire::Message pop() {
-    wire::Message msg = messages_.back();
-    messages_.pop_back();
-    return msg;
+  const Segment& last() {
+    return last_;
   }
 
-  void push(wire::Message& msg) {
-    messages_.push_back(msg);
+  void set_last(const Segment& event) {
+    last_ = event;
   }
 };
 
@@ -0,0 +1,24 @@
+#ifndef TIMEOUTS_HPP
+#define TIMEOUTS_HPP
+
+// What a client connection is waiting on the client for: its next
+// request, the rest of a request's headers, more of a request's body, or
+// to take the last of what's been written before it's closed.
+enum Timeout { eIdleTimeout, eHeaderTimeout, eBodyTimeout, eLingerTimeout };
+
+// How long, in seconds, a client connection may go without starting its
+// next request, take to send a request's headers once it's begun, and go
+// between pieces of a request's body; 0 for no limit.
+struct Timeouts {
+  double idle;
+  double header;
+  double body;
+
+  Timeouts()
+    : idle(60)
+    , header(20)
+    , body(30)
+  {}
+};
+
+#endif
@@ -0,0 +1,145 @@
+#include "timer_wheel.hpp"
+
+static const uint64_t cSlotMask = TimerWheel::cSlots - 1;
+
+// How far ahead the last level reaches, in ticks.
+static const uint64_t cRange =
+    (uint64_t)1 << (TimerWheel::cSlotBits * TimerWheel::cLevels);
+
+TimerWheel::Timer::Timer(int id)
+  : wheel_(0)
+  , prev_(0)
+  , next_(0)
+  , at_(0)
+  , id_(id)
+{}
+
+TimerWheel::Timer::~Timer() {
+  if(wheel_) wheel_->cancel(*this);
+}
+
+TimerWheel::TimerWheel()
+  : slots_()
+  , now_(0)
+  , size_(0)
+{
+  for(int level = 0; level < cLevels; level++) {
+    for(int slot = 0; slot < cSlots; slot++) {
+      Timer& head = slots_[level][slot];
+      head.prev_ = head.next_ = &head;
+    }
+  }
+}
+
+// Whatever is still scheduled outlives the wheel, so it's let go of
+// rather than left pointing in here.
+TimerWheel::~TimerWheel() {
+  for(int level = 0; level < cLevels; level++) {
+    for(int slot = 0; slot < cSlots; slot++) {
+      Timer& head = slots_[level][slot];
+      Timer* t = head.next_;
+
+      while(t != &head) {
+        Timer* next = t->next_;
+        t->wheel_ = 0;
+        t->prev_ = t->next_ = 0;
+        t = next;
+      }
+
+      head.prev_ = head.next_ = &head;
+    }
+  }
+}
+
+void TimerWheel::schedule(Timer& t, uint64_t now, uint64_t ticks) {
+  if(t.wheel_) {
+    t.prev_->next_ = t.next_;
+    t.next_->prev_ = t.prev_;
+  } else {
+    // Nothing is waiting on the ticks since the wheel went empty, so
+    // they needn't be turned through.
+    if(size_ == 0) now_ = now;
+    size_++;
+  }
+
+  if(ticks == 0) ticks = 1;
+
+  t.wheel_ = this;
+  t.at_ = (now > now_ ? now : now_) + ticks;
+
+  insert(t);
+}
+
+void TimerWheel::cancel(Timer& t) {
+  if(!t.wheel_) return;
+
+  t.prev_->next_ = t.next_;
+  t.next_->prev_ = t.prev_;
+
+  t.wheel_ = 0;
+  t.prev_ = t.next_ = 0;
+
+  size_--;
+}
+
+void TimerWheel::advance(uint64_t now, std::vector<int>& expired) {
+  while(now_ < now) {
+    if(size_ == 0) {
+      now_ = now;
+      return;
+    }
+
+    now_++;
+
+    // Each level's slot comes around once the level below has wrapped.
+    if((now_ & cSlotMask) == 0) {
+      for(int level = 1; level < cLevels; level++) {
+        cascade(level);
+        if((now_ >> (cSlotBits * level)) & cSlotMask) break;
+      }
+    }
+
+    Timer& head = slots_[0][now_ & cSlotMask];
+
+    while(head.next_ != &head) {
+      Timer* t = head.next_;
+      cancel(*t);
+      expired.push_back(t->id_);
+    }
+  }
+}
+
+// The level whose range t's time falls in, at the slot for that time.
+void TimerWheel::insert(Timer& t) {
+  uint64_t delta = t.at_ > now_ ? t.at_ - now_ : 0;
+  uint64_t at = now_ + (delta < cRange ? delta : cRange - 1);
+
+  int level = 0;
+
+  while(level < cLevels - 1 &&
+        delta >= (uint64_t)1 << (cSlotBits * (level + 1))) {
+    level++;
+  }
+
+  Timer& head = slots_[level][(at >> (cSlotBits * level)) & cSlotMask];
+
+  t.prev_ = head.prev_;
+  t.next_ = &head;
+  head.prev_->next_ = &t;
+  head.prev_ = &t;
+}
+
+// Moves the entries of level's current slot down to wherever they belong
+// now.
+void TimerWheel::cascade(int level) {
+  Timer& head = slots_[level][(now_ >> (cSlotBits * level)) & cSlotMask];
+
+  Timer* t = head.next_;
+  head.prev_ = head.next_ = &head;
+
+  while(t != &head) {
+    Timer* next = t->next_;
+    insert(*t);
+    t = next;
+  }
+}
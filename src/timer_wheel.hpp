@@ -0,0 +1,90 @@
+#ifndef TIMER_WHEEL_HPP
+#define TIMER_WHEEL_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <vector>
+
+// Timers for everything of one kind a loop has going, such as its client
+// connections' timeouts, kept in a hierarchical timing wheel: scheduling,
+// rescheduling and cancelling a timer are O(1) however many there are,
+// and one ev::timer ticking while any are scheduled drives them all.
+//
+// Time is counted in ticks of the owner's choosing. The first level has
+// a slot for each of the next cSlots ticks; each level after has slots
+// covering all of the one before, and as the wheel turns, the entries of
+// a level's current slot cascade down to where they now belong. A timer
+// further out than the last level reaches waits in it, going around
+// again, until it's in range.
+class TimerWheel {
+public:
+  static const int cLevels = 4;
+  static const int cSlotBits = 6;
+  static const int cSlots = 1 << cSlotBits;
+
+  // Embedded in whatever is being timed; the owner gets its id back when
+  // it fires.
+  class Timer {
+    friend class TimerWheel;
+
+    TimerWheel* wheel_;   // while scheduled
+    Timer* prev_;
+    Timer* next_;
+    uint64_t at_;
+    int id_;
+
+  public:
+    Timer(int id = -1);
+    ~Timer();
+
+    int id() const {
+      return id_;
+    }
+
+    bool scheduled_p() const {
+      return wheel_ != 0;
+    }
+
+  private:
+    Timer(const Timer&);
+    Timer& operator=(const Timer&);
+  };
+
+private:
+  // Each slot is a circular list with a sentinel at its head.
+  Timer slots_[cLevels][cSlots];
+
+  uint64_t now_;   // the last tick fired
+  size_t size_;
+
+public:
+  TimerWheel();
+  ~TimerWheel();
+
+  bool empty_p() const {
+    return size_ == 0;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  // Fires t ticks after now, moving it if it's already scheduled.
+  void schedule(Timer& t, uint64_t now, uint64_t ticks);
+
+  void cancel(Timer& t);
+
+  // Turns the wheel up to and including tick now, adding the ids of the
+  // timers that fire to expired, soonest first.
+  void advance(uint64_t now, std::vector<int>& expired);
+
+private:
+  TimerWheel(const TimerWheel&);
+  TimerWheel& operator=(const TimerWheel&);
+
+  void insert(Timer& t);
+  void cascade(int level);
+};
+
+#endif
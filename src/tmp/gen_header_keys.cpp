@@ -0,0 +1,315 @@
+// Writes src/header_keys.cpp: a perfect hash from header names to the
+// http::Header_Key values listed in src/http.proto.
+//
+//   make header_keys
+//
+// The hash mixes the name's length with its first and last two characters
+// (case folded by setting 0x20), each times a small multiplier. The second
+// to last character is what tells names like Sec-Fetch-Mode and
+// Sec-Fetch-Site apart. This searches for multipliers that give every
+// name its own slot, trying the smallest table first.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Key {
+  std::string symbol;
+  std::string name;    // canonical spelling
+  std::string lower;
+  int value;
+
+  Key()
+    : symbol()
+    , name()
+    , lower()
+    , value(0)
+  {}
+};
+
+static std::string trim(const std::string& s) {
+  size_t a = s.find_first_not_of(" \t");
+  if(a == std::string::npos) return "";
+
+  size_t b = s.find_last_not_of(" \t");
+  return s.substr(a, b - a + 1);
+}
+
+// HOST -> Host, USER_AGENT -> User-Agent
+static std::string title_case(const std::string& symbol) {
+  std::string out;
+  bool start = true;
+
+  for(size_t i = 0; i < symbol.size(); i++) {
+    char c = symbol[i];
+
+    if(c == '_') {
+      out.push_back('-');
+      start = true;
+    } else {
+      out.push_back(start ? toupper(c) : tolower(c));
+      start = false;
+    }
+  }
+
+  return out;
+}
+
+static bool read_keys(const char* path, std::vector<Key>& keys) {
+  std::ifstream in(path);
+  if(!in) return false;
+
+  std::string line;
+  bool inside = false;
+
+  while(std::getline(in, line)) {
+    std::string t = trim(line);
+
+    if(!inside) {
+      inside = t == "enum Key {";
+      continue;
+    }
+
+    if(t == "}") return true;
+    if(t.empty() || t.compare(0, 2, "//") == 0) continue;
+
+    size_t eq = t.find('=');
+    size_t semi = t.find(';');
+    if(eq == std::string::npos || semi == std::string::npos) continue;
+
+    Key k;
+    k.symbol = trim(t.substr(0, eq));
+    k.value = atoi(t.c_str() + eq + 1);
+
+    size_t comment = t.find("//", semi);
+    k.name = comment == std::string::npos ? title_case(k.symbol)
+                                          : trim(t.substr(comment + 2));
+
+    for(size_t i = 0; i < k.name.size(); i++) {
+      k.lower.push_back(tolower(k.name[i]));
+    }
+
+    keys.push_back(k);
+  }
+
+  return false;
+}
+
+static unsigned hash(const std::string& s, const unsigned m[4], unsigned size) {
+  unsigned n = s.size();
+
+  return (n * m[0] +
+          (unsigned)(s[0] | 0x20) * m[1] +
+          (unsigned)(s[n - 1] | 0x20) * m[2] +
+          (unsigned)(s[n - 2] | 0x20) * m[3]) & (size - 1);
+}
+
+static bool search(const std::vector<Key>& keys, unsigned size,
+                   unsigned m[4]) {
+  std::vector<int> used(size);
+
+  for(m[0] = 1; m[0] < 32; m[0]++) {
+    for(m[1] = 1; m[1] < 32; m[1]++) {
+      for(m[2] = 1; m[2] < 32; m[2]++) {
+        for(m[3] = 0; m[3] < 32; m[3]++) {
+          std::fill(used.begin(), used.end(), 0);
+
+          size_t i = 0;
+
+          for(; i < keys.size(); i++) {
+            unsigned h = hash(keys[i].lower, m, size);
+            if(used[h]++) break;
+          }
+
+          if(i == keys.size()) return true;
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
+static const char* cPreamble =
+"// Generated from src/http.proto by src/tmp/gen_header_keys.cpp; run\n"
+"// `make header_keys` after changing http::Header::Key rather than\n"
+"// editing this.\n"
+"\n"
+"#include \"util.hpp\"\n"
+"\n"
+"#include <stdint.h>\n"
+"#include <string.h>\n"
+"\n"
+"struct HeaderSlot {\n"
+"  const char* lower;\n"
+"  uint8_t size;\n"
+"  int8_t key;    // -1 for an empty slot\n"
+"};\n"
+"\n";
+
+// Compared a word at a time: each input word is lowercased with the usual
+// SWAR trick, which only touches bytes in 'A'..'Z', so "Content\rType"
+// can't pass for content-type.
+static const char* cCompare =
+"static inline uint64_t lower_word(uint64_t x) {\n"
+"  const uint64_t ones = 0x0101010101010101ULL;\n"
+"  const uint64_t high = 0x8080808080808080ULL;\n"
+"\n"
+"  uint64_t seven = x & ~high;\n"
+"  uint64_t ge_a = seven + (0x80 - 'A') * ones;\n"
+"  uint64_t gt_z = seven + (0x80 - 'Z' - 1) * ones;\n"
+"  uint64_t upper = (ge_a ^ gt_z) & ~x & high;\n"
+"\n"
+"  return x | (upper >> 2);\n"
+"}\n"
+"\n"
+"// name (any case) against lower, both size bytes long.\n"
+"static bool equal_lower(const char* name, const char* lower, size_t size) {\n"
+"  uint64_t a, b;\n"
+"\n"
+"  while(size >= 8) {\n"
+"    memcpy(&a, name, 8);\n"
+"    memcpy(&b, lower, 8);\n"
+"    if(lower_word(a) != b) return false;\n"
+"\n"
+"    name += 8;\n"
+"    lower += 8;\n"
+"    size -= 8;\n"
+"  }\n"
+"\n"
+"  if(size == 0) return true;\n"
+"\n"
+"  a = b = 0;\n"
+"  memcpy(&a, name, size);\n"
+"  memcpy(&b, lower, size);\n"
+"\n"
+"  return lower_word(a) == b;\n"
+"}\n"
+"\n";
+
+int main(int argc, char** argv) {
+  const char* proto = argc > 1 ? argv[1] : "src/http.proto";
+  const char* out_path = argc > 2 ? argv[2] : "src/header_keys.cpp";
+
+  std::vector<Key> keys;
+
+  if(!read_keys(proto, keys) || keys.empty()) {
+    std::cerr << "No http::Header::Key enum found in " << proto << "\n";
+    return 1;
+  }
+
+  unsigned m[4];
+  unsigned size = 64;
+
+  while(size < keys.size() || !search(keys, size, m)) {
+    size *= 2;
+
+    if(size > 4096) {
+      std::cerr << "No perfect hash found\n";
+      return 1;
+    }
+  }
+
+  int max_value = 0;
+  size_t min_size = 255;
+  size_t max_size = 0;
+
+  for(size_t i = 0; i < keys.size(); i++) {
+    if(keys[i].value > max_value) max_value = keys[i].value;
+    if(keys[i].lower.size() < min_size) min_size = keys[i].lower.size();
+    if(keys[i].lower.size() > max_size) max_size = keys[i].lower.size();
+  }
+
+  if(max_value > 127 || min_size < 2 || max_size > 255) {
+    std::cerr << "Keys no longer fit the slot layout\n";
+    return 1;
+  }
+
+  std::vector<const Key*> slots(size, (const Key*)0);
+
+  for(size_t i = 0; i < keys.size(); i++) {
+    slots[hash(keys[i].lower, m, size)] = &keys[i];
+  }
+
+  std::vector<const Key*> names(max_value + 1, (const Key*)0);
+
+  for(size_t i = 0; i < keys.size(); i++) {
+    names[keys[i].value] = &keys[i];
+  }
+
+  std::ostringstream out;
+
+  out << cPreamble;
+
+  out << "static const HeaderSlot cSlots[" << size << "] = {\n";
+
+  for(unsigned i = 0; i < size; i++) {
+    if(slots[i]) {
+      out << "  { \"" << slots[i]->lower << "\", "
+          << slots[i]->lower.size() << ", " << slots[i]->value << " },"
+          << "  // " << slots[i]->symbol << "\n";
+    } else {
+      out << "  { 0, 0, -1 },\n";
+    }
+  }
+
+  out << "};\n\n";
+
+  out << "static const char* const cNames[" << names.size() << "] = {\n";
+
+  for(size_t i = 0; i < names.size(); i++) {
+    out << "  " << (names[i] ? "\"" + names[i]->name + "\"" : "\"\"")
+        << ",\n";
+  }
+
+  out << "};\n\n";
+
+  out << "static inline unsigned slot(const char* name, size_t size) {\n"
+      << "  return (size * " << m[0] << " +\n"
+      << "          (unsigned char)(name[0] | 0x20) * " << m[1] << " +\n"
+      << "          (unsigned char)(name[size - 1] | 0x20) * " << m[2]
+      << " +\n"
+      << "          (unsigned char)(name[size - 2] | 0x20) * " << m[3]
+      << ") & " << size - 1 << ";\n"
+      << "}\n\n";
+
+  out << cCompare;
+
+  out << "int header_key(const char* name, size_t size) {\n"
+      << "  if(size < " << min_size << " || size > " << max_size
+      << ") return -1;\n"
+      << "\n"
+      << "  const HeaderSlot& s = cSlots[slot(name, size)];\n"
+      << "\n"
+      << "  if(s.size != size || !equal_lower(name, s.lower, size)) {\n"
+      << "    return -1;\n"
+      << "  }\n"
+      << "\n"
+      << "  return s.key;\n"
+      << "}\n\n";
+
+  out << "const char* header_key_name(int key) {\n"
+      << "  if(key < 0 || key >= " << names.size() << ") return \"\";\n"
+      << "\n"
+      << "  return cNames[key];\n"
+      << "}\n";
+
+  std::ofstream file(out_path);
+  file << out.str();
+
+  if(!file) {
+    std::cerr << "Unable to write " << out_path << "\n";
+    return 1;
+  }
+
+  printf("%u slots for %u keys, multipliers %u %u %u %u\n",
+         size, (unsigned)keys.size(), m[0], m[1], m[2], m[3]);
+
+  return 0;
+}
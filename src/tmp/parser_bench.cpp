@@ -0,0 +1,551 @@
+// Differential test and benchmark for src/fast_parser.cpp.
+//
+//   make parser-bench && ./parser-bench [seed]
+//
+// First it feeds generated requests, and mutations of them, through both
+// http_parser_execute() and fast_parser_execute(), whole and split at
+// random points, and compares what the callbacks saw. Then it times both
+// over a stream of typical requests.
+//
+// The fast parser is stricter in a few places on purpose (folded header
+// lines, header lines without a colon, method names http_parser only
+// half checks, bare LFs in chunk framing); inputs only it rejects are
+// counted separately and don't fail the run.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+
+#include "http_parser.h"
+#include "fast_parser.hpp"
+
+struct Event {
+  char kind;
+  std::string data;
+
+  Event(char k, const std::string& d)
+    : kind(k)
+    , data(d)
+  {}
+
+  bool operator==(const Event& o) const {
+    return kind == o.kind && data == o.data;
+  }
+};
+
+typedef std::vector<Event> Events;
+
+static void add(http_parser* p, char kind, const char* at, size_t size) {
+  Events& events = *(Events*)p->data;
+
+  // http_parser splits data across calls wherever its input ends.
+  if(!events.empty() && events.back().kind == kind && kind != 'B') {
+    events.back().data.append(at, size);
+  } else {
+    events.push_back(Event(kind, std::string(at, size)));
+  }
+}
+
+static int on_begin(http_parser* p) {
+  add(p, 'M', "", 0);
+  return 0;
+}
+
+static int on_url(http_parser* p, const char* at, size_t size) {
+  add(p, 'U', at, size);
+  return 0;
+}
+
+static int on_field(http_parser* p, const char* at, size_t size) {
+  add(p, 'F', at, size);
+  return 0;
+}
+
+static int on_value(http_parser* p, const char* at, size_t size) {
+  add(p, 'V', at, size);
+  return 0;
+}
+
+static int on_headers(http_parser* p) {
+  char buf[128];
+  snprintf(buf, sizeof(buf), "%s %d.%d flags=%d length=%llu upgrade=%d",
+           http_method_str((http_method)p->method), p->http_major,
+           p->http_minor,
+           p->flags & (F_CHUNKED | F_CONNECTION_KEEP_ALIVE |
+                       F_CONNECTION_CLOSE | F_UPGRADE),
+           (unsigned long long)p->content_length, p->upgrade);
+
+  add(p, 'H', buf, strlen(buf));
+  return 0;
+}
+
+static int on_body(http_parser* p, const char* at, size_t size) {
+  // Bodies come in pieces that depend on the splits; join them.
+  Events& events = *(Events*)p->data;
+
+  if(!events.empty() && events.back().kind == 'B') {
+    events.back().data.append(at, size);
+  } else {
+    events.push_back(Event('B', std::string(at, size)));
+  }
+
+  return 0;
+}
+
+static int on_done(http_parser* p) {
+  add(p, 'C', "", 0);
+  return 0;
+}
+
+static http_parser_settings settings() {
+  http_parser_settings s;
+  memset(&s, 0, sizeof(s));
+
+  s.on_message_begin = on_begin;
+  s.on_url = on_url;
+  s.on_header_field = on_field;
+  s.on_header_value = on_value;
+  s.on_headers_complete = on_headers;
+  s.on_body = on_body;
+  s.on_message_complete = on_done;
+
+  return s;
+}
+
+static const http_parser_settings cSettings = settings();
+
+struct Result {
+  Events events;
+  bool failed;
+  size_t stop;    // where in the input parsing failed or is waiting
+
+  Result()
+    : events()
+    , failed(false)
+    , stop(0)
+  {}
+};
+
+// Only what's known complete is compared: whatever follows the last
+// finished message depends on where each engine stops.
+static void trim(Events& events) {
+  size_t keep = 0;
+
+  for(size_t i = 0; i < events.size(); i++) {
+    if(events[i].kind == 'C') keep = i + 1;
+  }
+
+  events.erase(events.begin() + keep, events.end());
+}
+
+static Result reference(const std::string& input,
+                        const std::vector<size_t>& cuts) {
+  Result r;
+  http_parser parser;
+  http_parser_init(&parser, HTTP_REQUEST);
+  parser.data = &r.events;
+
+  size_t from = 0;
+
+  for(size_t i = 0; i <= cuts.size(); i++) {
+    size_t to = i < cuts.size() ? cuts[i] : input.size();
+
+    size_t n = http_parser_execute(&parser, &cSettings,
+                                   input.data() + from, to - from);
+
+    if(HTTP_PARSER_ERRNO(&parser) != HPE_OK) {
+      r.failed = true;
+      r.stop = from + n;
+      break;
+    }
+
+    // Upgrades stop the parser; the rest isn't HTTP.
+    if(n != to - from || parser.upgrade) break;
+
+    from = to;
+  }
+
+  trim(r.events);
+  return r;
+}
+
+static Result fast(const std::string& input, const std::vector<size_t>& cuts) {
+  Result r;
+  http_parser parser;
+  fast_parser_init(&parser);
+  parser.data = &r.events;
+
+  std::string pending;
+  size_t from = 0;
+
+  for(size_t i = 0; i <= cuts.size(); i++) {
+    size_t to = i < cuts.size() ? cuts[i] : input.size();
+
+    pending.append(input, from, to - from);
+
+    size_t n = fast_parser_execute(&parser, &cSettings,
+                                   pending.data(), pending.size());
+
+    r.stop = to - pending.size() + n;
+
+    if(HTTP_PARSER_ERRNO(&parser) != HPE_OK) {
+      r.failed = true;
+      break;
+    }
+
+    if(parser.upgrade) break;
+
+    pending.erase(0, n);
+    from = to;
+  }
+
+  trim(r.events);
+  return r;
+}
+
+static unsigned pick(unsigned n) {
+  return rand() % n;
+}
+
+static const char* cMethods[] = {
+  "GET", "GET", "GET", "POST", "POST", "PUT", "DELETE", "HEAD", "OPTIONS",
+  "PATCH", "M-SEARCH", "PROPPATCH", "MKACTIVITY", "UNSUBSCRIBE", "PURGE"
+};
+
+static const char* cNames[] = {
+  "Host", "Accept", "User-Agent", "Accept-Encoding", "Accept-Language",
+  "Cookie", "Referer", "X-Request-Id", "Cache-Control", "If-None-Match",
+  "sec-fetch-mode", "X_Weird.Name~1", "Authorization", "Origin", "Via"
+};
+
+static std::string random_chars(const char* set, size_t size) {
+  std::string out;
+  size_t n = strlen(set);
+
+  for(size_t i = 0; i < size; i++) out.push_back(set[pick(n)]);
+
+  return out;
+}
+
+static const char* cPathChars =
+  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+  "-._~!$&'()*+,;=:@/%?#";
+
+static const char* cValueChars =
+  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+  " \t-._~!$&'()*+,;=:@/%?#\"<>[]{}|\\^`\x80\xff";
+
+static const char* cTokenChars =
+  "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789"
+  "!#$%&'*+-.^_`|~";
+
+static std::string eol() {
+  return pick(8) ? "\r\n" : "\n";
+}
+
+static std::string hex(size_t n) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), pick(2) ? "%zx" : "%zX", n);
+  return buf;
+}
+
+// One request; sets closes when it ends the connection.
+static std::string request(bool& closes) {
+  std::string method = cMethods[pick(sizeof(cMethods) / sizeof(char*))];
+  std::string url;
+
+  switch(pick(10)) {
+  case 0:
+    url = "http://user@example.com:8080/" + random_chars(cPathChars, pick(30));
+    break;
+  case 1:
+    method = "CONNECT";
+    url = "example.com:443";
+    break;
+  case 2:
+    url = "*";
+    break;
+  default:
+    url = "/" + random_chars(cPathChars, pick(80));
+  }
+
+  bool one_one = pick(4) != 0;
+  std::string out = method + " " + url + (one_one ? " HTTP/1.1" : " HTTP/1.0")
+                    + eol();
+
+  size_t headers = pick(20);
+
+  for(size_t i = 0; i < headers; i++) {
+    std::string name = pick(3) ? cNames[pick(sizeof(cNames) / sizeof(char*))]
+                               : random_chars(cTokenChars, 1 + pick(20));
+    std::string space = pick(4) ? " " : random_chars(" \t", pick(3));
+
+    out += name + ":" + space + random_chars(cValueChars, pick(60)) + eol();
+  }
+
+  bool keep_alive = one_one;
+
+  switch(pick(3)) {
+  case 0:
+    out += "Connection: close" + eol();
+    keep_alive = false;
+    break;
+  case 1:
+    out += "connection: Keep-Alive" + eol();
+    keep_alive = true;
+    break;
+  }
+
+  if(pick(30) == 0 && method != "CONNECT") out += "Upgrade: websocket" + eol();
+
+  std::string body;
+
+  switch(pick(3)) {
+  case 0:
+    body = random_chars(cValueChars, pick(200));
+    out += "Content-Length: " + std::string(pick(2) ? "" : " ");
+    {
+      char buf[32];
+      snprintf(buf, sizeof(buf), "%zu", body.size());
+      out += buf;
+    }
+    out += eol() + eol() + body;
+    break;
+  case 1:
+    out += "Transfer-Encoding: chunked" + eol() + eol();
+    for(size_t i = pick(4); i > 0; i--) {
+      std::string chunk = random_chars(cValueChars, 1 + pick(100));
+      out += hex(chunk.size()) + (pick(4) ? "" : ";ext=1") + "\r\n" + chunk +
+             "\r\n";
+    }
+    out += "0\r\n";
+    if(pick(2)) out += "Trailer-Name: value\r\n";
+    out += "\r\n";
+    break;
+  default:
+    out += eol();
+  }
+
+  closes = !keep_alive;
+  return out;
+}
+
+static std::string requests() {
+  std::string out;
+  bool closes = false;
+
+  for(size_t n = 1 + pick(3); n > 0 && !closes; n--) out += request(closes);
+
+  return out;
+}
+
+static std::vector<size_t> cuts(size_t size) {
+  std::vector<size_t> out;
+
+  switch(pick(3)) {
+  case 0:
+    break;
+  case 1:
+    for(size_t i = 1; i < size; i++) out.push_back(i);
+    break;
+  default:
+    for(size_t at = pick(64); at < size; at += 1 + pick(64)) {
+      out.push_back(at);
+    }
+  }
+
+  return out;
+}
+
+static void mutate(std::string& s) {
+  static const char cInteresting[] = " \t\r\n:\0\x7f\x80/;?#@0Zz";
+
+  for(size_t n = 1 + pick(3); n > 0 && !s.empty(); n--) {
+    char c = pick(2) ? cInteresting[pick(sizeof(cInteresting) - 1)]
+                     : (char)pick(256);
+    s[pick(s.size())] = c;
+  }
+}
+
+static void show(const char* what, const std::string& input,
+                 const Result& a, const Result& b) {
+  printf("%s:\n", what);
+
+  for(size_t i = 0; i < input.size(); i++) {
+    unsigned char c = input[i];
+    if(c == '\n') printf("\\n\n");
+    else if(c < ' ' || c >= 0x7f) printf("\\x%02x", c);
+    else putchar(c);
+  }
+
+  printf("\nhttp_parser %s, %zu events; fast %s, %zu events\n",
+         a.failed ? "failed" : "ok", a.events.size(),
+         b.failed ? "failed" : "ok", b.events.size());
+
+  for(size_t i = 0; i < a.events.size() || i < b.events.size(); i++) {
+    std::string x = i < a.events.size() ? a.events[i].kind +
+                    (" " + a.events[i].data) : "-";
+    std::string y = i < b.events.size() ? b.events[i].kind +
+                    (" " + b.events[i].data) : "-";
+    if(x != y) {
+      printf("  #%zu\n    %s\n    %s\n", i, x.c_str(), y.c_str());
+      break;
+    }
+  }
+}
+
+static bool differential(unsigned rounds) {
+  unsigned same = 0, stricter = 0, mismatched = 0;
+
+  for(unsigned i = 0; i < rounds; i++) {
+    std::string input = requests();
+    bool mutated = i % 2 == 1;
+
+    if(mutated) mutate(input);
+
+    std::vector<size_t> at = cuts(input.size());
+
+    Result a = reference(input, at);
+    Result b = fast(input, at);
+
+    if(a.failed && b.failed) {
+      same++;
+    } else if(!a.failed && !b.failed && a.events == b.events) {
+      same++;
+    } else if(a.failed && !b.failed && b.stop <= a.stop &&
+              a.events == b.events) {
+      // The fast parser hasn't seen the end of the line http_parser
+      // choked on yet.
+      same++;
+    } else if(b.failed && !a.failed && mutated) {
+      stricter++;
+    } else {
+      if(++mismatched <= 5) show("Mismatch", input, a, b);
+    }
+  }
+
+  printf("differential: %u inputs, %u agree, %u rejected only by the fast "
+         "parser, %u mismatched\n", rounds, same, stricter, mismatched);
+
+  return mismatched == 0;
+}
+
+static int count_done(http_parser* p) {
+  (*(size_t*)p->data)++;
+  return 0;
+}
+
+static int ignore_data(http_parser*, const char*, size_t) {
+  return 0;
+}
+
+static int ignore(http_parser*) {
+  return 0;
+}
+
+static double now() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static const char* cBrowserRequest =
+  "GET /api/v2/users/12345/timeline?since=1699999999&limit=50 HTTP/1.1\r\n"
+  "Host: api.example.com\r\n"
+  "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 "
+  "(KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36\r\n"
+  "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,"
+  "image/avif,image/webp,*/*;q=0.8\r\n"
+  "Accept-Language: en-US,en;q=0.9\r\n"
+  "Accept-Encoding: gzip, deflate, br\r\n"
+  "Referer: https://www.example.com/home\r\n"
+  "Cookie: session=4f3c2b1a0e9d8c7b6a5f4e3d2c1b0a99; theme=dark; "
+  "_ga=GA1.2.1234567890.1699999999\r\n"
+  "Sec-Fetch-Dest: document\r\n"
+  "Sec-Fetch-Mode: navigate\r\n"
+  "Sec-Fetch-Site: same-origin\r\n"
+  "Sec-Fetch-User: ?1\r\n"
+  "Upgrade-Insecure-Requests: 1\r\n"
+  "Cache-Control: max-age=0\r\n"
+  "X-Request-Id: 0b6f2d1e-3c4a-4f5b-8e9d-7a6b5c4d3e2f\r\n"
+  "Connection: keep-alive\r\n"
+  "\r\n";
+
+static const char* cApiRequest =
+  "POST /orders HTTP/1.1\r\n"
+  "Host: api.example.com\r\n"
+  "Content-Type: application/json\r\n"
+  "Content-Length: 26\r\n"
+  "\r\n"
+  "{\"item\":42,\"quantity\":3}\r\n";
+
+typedef size_t (*Execute)(http_parser*, const http_parser_settings*,
+                          const char*, size_t);
+
+static size_t reference_execute(http_parser* p,
+                                const http_parser_settings* s,
+                                const char* data, size_t size) {
+  return http_parser_execute(p, s, data, size);
+}
+
+static void bench(const char* name, const char* request) {
+  std::string stream;
+  while(stream.size() < (1 << 20)) stream += request;
+
+  http_parser_settings s;
+  memset(&s, 0, sizeof(s));
+  s.on_message_begin = ignore;
+  s.on_url = ignore_data;
+  s.on_header_field = ignore_data;
+  s.on_header_value = ignore_data;
+  s.on_headers_complete = ignore;
+  s.on_body = ignore_data;
+  s.on_message_complete = count_done;
+
+  const char* engines[] = { "http_parser", "fast_parser" };
+  Execute execute[] = { reference_execute, fast_parser_execute };
+  double rate[2];
+
+  for(int e = 0; e < 2; e++) {
+    size_t done = 0;
+    size_t bytes = 0;
+    double start = now();
+
+    while(now() - start < 1.0) {
+      http_parser parser;
+
+      if(e == 0) {
+        http_parser_init(&parser, HTTP_REQUEST);
+      } else {
+        fast_parser_init(&parser);
+      }
+
+      parser.data = &done;
+
+      bytes += execute[e](&parser, &s, stream.data(), stream.size());
+    }
+
+    double took = now() - start;
+    rate[e] = bytes / took / (1 << 20);
+
+    printf("%-8s %-12s %8.1f MB/s %10.0f requests/s\n", name, engines[e],
+           rate[e], done / took);
+  }
+
+  printf("%-8s speedup      %8.2fx\n", name, rate[1] / rate[0]);
+}
+
+int main(int argc, char** argv) {
+  srand(argc > 1 ? atoi(argv[1]) : 1);
+
+  bool ok = differential(200000);
+
+  bench("browser", cBrowserRequest);
+  bench("api", cApiRequest);
+
+  return ok ? 0 : 1;
+}
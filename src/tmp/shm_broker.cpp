@@ -0,0 +1,178 @@
+// A stand-in broker for exercising the shared memory link (shm_ring.hpp)
+// without a real broker. It accepts one harq-http at a time on a unix
+// socket, attaches to the rings it's handed and answers every request
+// sent to /harq-http with a canned 200 echoing the URL.
+//
+//   ./shm-broker /tmp/harq.sock &
+//   ./harq-http -q shm:/tmp/harq.sock
+
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "shm_ring.hpp"
+
+#include "wire.pb.h"
+#include "http.pb.h"
+
+static int listen_on(const char* path) {
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+
+  unlink(path);
+
+  int s = socket(AF_UNIX, SOCK_STREAM, 0);
+  if(s < 0 || bind(s, (struct sockaddr*)&addr, sizeof(addr)) < 0 ||
+     listen(s, 4) < 0) {
+    perror("listen");
+    exit(1);
+  }
+
+  return s;
+}
+
+static void answer(wire::Message& in, ShmRing& out) {
+  if(in.destination() != "/harq-http") return;
+
+  http::Request req;
+  if(!req.ParseFromString(in.payload())) {
+    std::cerr << "Malformed request\n";
+    return;
+  }
+
+  http::Response rep;
+  rep.set_stream_id(req.stream_id());
+  rep.set_status(200);
+  rep.set_body("Hello from shm-broker: " + req.url() + "\n");
+
+  http::Header* h = rep.add_headers();
+  h->set_custom_key("Content-Type");
+  h->set_value("text/plain");
+
+  wire::Message msg;
+  msg.set_destination("/harq-http/reply");
+  msg.set_payload(rep.SerializeAsString());
+
+  std::string frame = msg.SerializeAsString();
+
+  // The gateway always drains, so waiting for room is fine here.
+  while(!out.write(frame)) {
+    usleep(100);
+  }
+}
+
+static void serve(int ctl) {
+  int fds[3];
+
+  if(!shm_recv_fds(ctl, fds, 3)) {
+    std::cerr << "Bad handshake\n";
+    return;
+  }
+
+  int mem_fd = fds[0], to_broker_fd = fds[1], to_gateway_fd = fds[2];
+
+  ShmHeader* hdr = (ShmHeader*)mmap(NULL, sizeof(ShmHeader),
+                                    PROT_READ, MAP_SHARED, mem_fd, 0);
+  if(hdr == MAP_FAILED || hdr->magic != cShmMagic ||
+     hdr->version != cShmVersion) {
+    std::cerr << "Bad shared memory header\n";
+    return;
+  }
+
+  uint64_t ring_size = hdr->ring_size;
+  munmap(hdr, sizeof(ShmHeader));
+
+  size_t map_size = shm_map_size(ring_size);
+  void* map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                   mem_fd, 0);
+  if(map == MAP_FAILED) {
+    perror("mmap");
+    return;
+  }
+
+  hdr = (ShmHeader*)map;
+  uint8_t* data = (uint8_t*)map + (map_size - 2 * ring_size);
+
+  ShmRing rx, tx;
+  rx.attach(&hdr->to_broker, data, ring_size, to_broker_fd, to_gateway_fd);
+  tx.attach(&hdr->to_gateway, data + ring_size, ring_size,
+            to_gateway_fd, to_broker_fd);
+
+  std::cout << "Gateway attached, " << ring_size << " byte rings\n";
+
+  std::vector<uint8_t> buf;
+  unsigned long served = 0;
+
+  for(;;) {
+    int len;
+
+    while((len = rx.next_size()) >= 0) {
+      buf.resize(len);
+      rx.read(&buf[0], len);
+
+      wire::Message msg;
+      if(!msg.ParseFromArray(&buf[0], len)) {
+        std::cerr << "Malformed frame\n";
+        continue;
+      }
+
+      answer(msg, tx);
+      served++;
+    }
+
+    rx.release();
+
+    if(!rx.prepare_sleep()) continue;
+
+    struct pollfd pfd[2];
+    pfd[0].fd = to_broker_fd;
+    pfd[0].events = POLLIN;
+    pfd[1].fd = ctl;
+    pfd[1].events = POLLIN;
+
+    if(poll(pfd, 2, -1) < 0 && errno != EINTR) break;
+
+    if(pfd[1].revents) break;
+    if(pfd[0].revents) shm_clear(to_broker_fd);
+  }
+
+  std::cout << "Gateway detached after " << served << " frames\n";
+
+  munmap(map, map_size);
+  close(mem_fd);
+  close(to_broker_fd);
+  close(to_gateway_fd);
+}
+
+int main(int argc, char** argv) {
+  if(argc < 2) {
+    printf("Usage: shm-broker <socket path>\n");
+    return 1;
+  }
+
+  int s = listen_on(argv[1]);
+
+  for(;;) {
+    int ctl = accept(s, NULL, NULL);
+    if(ctl < 0) {
+      if(errno == EINTR) continue;
+      perror("accept");
+      return 1;
+    }
+
+    serve(ctl);
+    close(ctl);
+  }
+}
@@ -9,10 +9,19 @@
 #include <signal.h>
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <stddef.h>
 #include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
 
 #include "util.hpp"
 #include "server.hpp"
+#include "action.hpp"
+#include "deflate.hpp"
+
+#include "wire.pb.h"
 
 void set_nonblock(int fd) {
     int flags = fcntl(fd, F_GETFL, 0);
@@ -53,3 +62,185 @@ void sig_term(int signo) {
     }
 }
 
+
+int connect_to(std::string host, int c_port) {
+  int s, rv;
+  char port[6];  /* strlen("65535"); */
+  struct addrinfo hints, *servinfo, *p;
+
+  snprintf(port, 6, "%d", c_port);
+  memset(&hints,0,sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+
+  if ((rv = getaddrinfo(host.c_str(), port, &hints, &servinfo)) != 0) {
+    printf("Error: %s\n", gai_strerror(rv));
+    return -1;
+  }
+
+  for (p = servinfo; p != NULL; p = p->ai_next) {
+    if ((s = socket(p->ai_family,p->ai_socktype,p->ai_protocol)) == -1)
+      continue;
+
+    if (::connect(s,p->ai_addr,p->ai_addrlen) == -1) {
+      close(s);
+      continue;
+    }
+
+    break;
+  }
+
+  if (p == NULL) {
+    printf("Can't create socket: %s\n",strerror(errno));
+    freeaddrinfo(servinfo);
+    return -1;
+  }
+
+  freeaddrinfo(servinfo);
+
+  // Frames are written whole, so there's nothing for Nagle to coalesce;
+  // it only adds a delayed-ACK round trip to small requests.
+  int flags = 1;
+  setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (void *)&flags, sizeof(flags));
+
+  return s;
+}
+
+// A path starting with '@' names a Linux abstract-namespace socket, which
+// has no filesystem entry to create, clean up or get permissions wrong on.
+// Returns the address's length, or 0 for a bad path.
+static socklen_t unix_address(const std::string& path,
+                              struct sockaddr_un& addr) {
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+
+  if(path.empty() || path.size() >= sizeof(addr.sun_path)) {
+    printf("Bad unix socket path: '%s'\n", path.c_str());
+    return 0;
+  }
+
+  socklen_t len = offsetof(struct sockaddr_un, sun_path) + path.size();
+
+  if(path[0] == '@') {
+#ifdef __linux
+    memcpy(addr.sun_path + 1, path.data() + 1, path.size() - 1);
+#else
+    printf("Abstract unix sockets are only supported on Linux\n");
+    return 0;
+#endif
+  } else {
+    memcpy(addr.sun_path, path.data(), path.size());
+    len++;
+  }
+
+  return len;
+}
+
+int connect_unix(std::string path) {
+  struct sockaddr_un addr;
+
+  socklen_t len = unix_address(path, addr);
+  if(len == 0) return -1;
+
+  int s = socket(AF_UNIX, SOCK_STREAM, 0);
+  if(s == -1) {
+    printf("Can't create socket: %s\n",strerror(errno));
+    return -1;
+  }
+
+  if(::connect(s, (struct sockaddr*)&addr, len) == -1) {
+    printf("Can't connect to %s: %s\n", path.c_str(), strerror(errno));
+    close(s);
+    return -1;
+  }
+
+  return s;
+}
+
+// Replaces whatever socket file is already at path.
+int listen_unix(std::string path) {
+  struct sockaddr_un addr;
+
+  socklen_t len = unix_address(path, addr);
+  if(len == 0) return -1;
+
+  if(path[0] != '@') unlink(path.c_str());
+
+  int s = socket(AF_UNIX, SOCK_STREAM, 0);
+  if(s == -1) {
+    printf("Can't create socket: %s\n",strerror(errno));
+    return -1;
+  }
+
+  if(bind(s, (struct sockaddr*)&addr, len) == -1 || listen(s, 4) == -1) {
+    printf("Can't listen on %s: %s\n", path.c_str(), strerror(errno));
+    close(s);
+    return -1;
+  }
+
+  return s;
+}
+
+// Broker addresses are either "host:port" or "unix:/path/to/socket"
+// ("unix:@name" for an abstract socket).
+int connect_address(std::string addr) {
+  if(addr.compare(0, 5, "unix:") == 0) {
+    return connect_unix(addr.substr(5));
+  }
+
+  std::string::size_type colon = addr.rfind(':');
+  if(colon == std::string::npos) {
+    printf("Bad broker address: '%s'\n", addr.c_str());
+    return -1;
+  }
+
+  int port = (int)strtol(addr.c_str() + colon + 1, (char **)NULL, 10);
+  if(!port) {
+    printf("Bad broker port in '%s'\n", addr.c_str());
+    return -1;
+  }
+
+  return connect_to(addr.substr(0, colon), port);
+}
+
+void add_action(std::vector<wire::Message>& msgs,
+                int type, std::string payload) {
+  wire::Action act;
+  act.set_type(type);
+  act.set_payload(payload);
+
+  wire::Message msg;
+  msg.set_destination("+");
+  msg.set_payload(act.SerializeAsString());
+
+  msgs.push_back(msg);
+}
+
+// The actions every broker link sends before it carries any traffic:
+// announce that payloads may be compressed, declare our request and reply
+// queues and subscribe to the replies. The announcement is one-way, since
+// nothing comes back to say it was understood, so -z is only for brokers
+// and workers known to take eDeflate.
+void link_setup_messages(std::vector<wire::Message>& msgs,
+                         std::string reply_queue, Deflate& deflate) {
+  if(deflate.enabled_p()) {
+    wire::ConnectionConfigure cfg;
+    cfg.set_deflate(true);
+    cfg.set_dictionary_id(deflate.dictionary_id());
+
+    add_action(msgs, eConfigure, cfg.SerializeAsString());
+  }
+
+  add_action(msgs, eMakeTransientQueue, "/harq-http");
+  add_action(msgs, eMakeTransientQueue, reply_queue);
+  add_action(msgs, eSubscribe, reply_queue);
+}
+
+std::string instance_queue(const char* queue, int pid) {
+  if(!pid) return queue;
+
+  char suffix[32];
+  snprintf(suffix, sizeof(suffix), "/%d", pid);
+
+  return std::string(queue) + suffix;
+}
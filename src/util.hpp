@@ -1,8 +1,39 @@
 #ifndef UTIL_HPP
 #define UTIL_HPP
 
+#include <string>
+#include <vector>
+
+namespace wire {
+  class Message;
+}
+
+class Deflate;
+
 void set_nonblock(int fd);
 
+int connect_to(std::string host, int port);
+int connect_unix(std::string path);
+int listen_unix(std::string path);
+int connect_address(std::string addr);
+
+// Appends a wire::Action for the broker itself to msgs.
+void add_action(std::vector<wire::Message>& msgs,
+                int type, std::string payload);
+
+void link_setup_messages(std::vector<wire::Message>& msgs,
+                         std::string reply_queue, Deflate& deflate);
+
+// queue, or with pid when it's non-zero, a queue of the process's own
+// (see Server::set_instance).
+std::string instance_queue(const char* queue, int pid);
+
+// The http::Header_Key for a header name in any case, or -1 if it has
+// none, and the canonical name of one. Both are in header_keys.cpp, which
+// is generated (see make header_keys).
+int header_key(const char* name, size_t size);
+const char* header_key_name(int key);
+
 int daemon_init(void);
 
 void sig_term(int signo);
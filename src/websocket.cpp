@@ -0,0 +1,451 @@
+#include "websocket.hpp"
+#include "server.hpp"
+#include "connection.hpp"
+#include "reply.hpp"
+#include "flags.hpp"
+#include "harq.hpp"
+#include "debugs.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#include <vector>
+
+#include "http.pb.h"
+
+static const char cGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+enum Opcode {
+  eContinuation = 0x0,
+  eText = 0x1,
+  eBinary = 0x2,
+  eClose = 0x8,
+  ePing = 0x9,
+  ePong = 0xa
+};
+
+static const uint8_t cFin = 0x80;
+static const uint8_t cMasked = 0x80;
+
+// Close codes.
+static const uint16_t cNormal = 1000;
+static const uint16_t cProtocolError = 1002;
+static const uint16_t cTooBig = 1009;
+
+static uint32_t rotl(uint32_t v, int n) {
+  return (v << n) | (v >> (32 - n));
+}
+
+// SHA-1, which the handshake needs and nothing else does.
+static void sha1(const std::string& in, uint8_t out[20]) {
+  uint32_t h[5] = {
+    0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+  };
+
+  std::string msg(in);
+  uint64_t bits = (uint64_t)in.size() * 8;
+
+  msg.push_back((char)0x80);
+  while(msg.size() % 64 != 56) msg.push_back(0);
+  for(int i = 7; i >= 0; i--) msg.push_back(bits >> (i * 8));
+
+  for(size_t block = 0; block < msg.size(); block += 64) {
+    const uint8_t* p = (const uint8_t*)msg.data() + block;
+    uint32_t w[80];
+
+    for(int i = 0; i < 16; i++) {
+      w[i] = ((uint32_t)p[i * 4] << 24) | ((uint32_t)p[i * 4 + 1] << 16) |
+             ((uint32_t)p[i * 4 + 2] << 8) | p[i * 4 + 3];
+    }
+
+    for(int i = 16; i < 80; i++) {
+      w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    uint32_t a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+
+    for(int i = 0; i < 80; i++) {
+      uint32_t f, k;
+
+      if(i < 20) {
+        f = (b & c) | (~b & d);
+        k = 0x5a827999;
+      } else if(i < 40) {
+        f = b ^ c ^ d;
+        k = 0x6ed9eba1;
+      } else if(i < 60) {
+        f = (b & c) | (b & d) | (c & d);
+        k = 0x8f1bbcdc;
+      } else {
+        f = b ^ c ^ d;
+        k = 0xca62c1d6;
+      }
+
+      uint32_t t = rotl(a, 5) + f + e + k + w[i];
+      e = d;
+      d = c;
+      c = rotl(b, 30);
+      b = a;
+      a = t;
+    }
+
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+  }
+
+  for(int i = 0; i < 5; i++) {
+    out[i * 4] = h[i] >> 24;
+    out[i * 4 + 1] = h[i] >> 16;
+    out[i * 4 + 2] = h[i] >> 8;
+    out[i * 4 + 3] = h[i];
+  }
+}
+
+static std::string base64(const uint8_t* p, size_t size) {
+  static const char cAlphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+  std::string out;
+
+  for(size_t i = 0; i < size; i += 3) {
+    uint32_t v = (uint32_t)p[i] << 16;
+    if(i + 1 < size) v |= (uint32_t)p[i + 1] << 8;
+    if(i + 2 < size) v |= p[i + 2];
+
+    out.push_back(cAlphabet[(v >> 18) & 63]);
+    out.push_back(cAlphabet[(v >> 12) & 63]);
+    out.push_back(i + 1 < size ? cAlphabet[(v >> 6) & 63] : '=');
+    out.push_back(i + 2 < size ? cAlphabet[v & 63] : '=');
+  }
+
+  return out;
+}
+
+// XORs the mask key over data in place, eight bytes at a time while it
+// can. The key repeats every four bytes, so it lines up with any offset
+// that's a multiple of eight.
+static void unmask(uint8_t* data, uint64_t size, const uint8_t* key) {
+  uint32_t k32;
+  memcpy(&k32, key, 4);
+
+  uint64_t k64 = ((uint64_t)k32 << 32) | k32;
+  uint64_t i = 0;
+
+  for(; i + 8 <= size; i += 8) {
+    uint64_t w;
+    memcpy(&w, data + i, 8);
+    w ^= k64;
+    memcpy(data + i, &w, 8);
+  }
+
+  for(; i < size; i++) {
+    data[i] ^= key[i & 3];
+  }
+}
+
+static void frame_head(std::string& out, uint8_t opcode, uint64_t size) {
+  out.push_back(cFin | opcode);
+
+  if(size < 126) {
+    out.push_back(size);
+  } else if(size <= 0xffff) {
+    out.push_back(126);
+    out.push_back(size >> 8);
+    out.push_back(size);
+  } else {
+    out.push_back(127);
+    for(int i = 7; i >= 0; i--) out.push_back(size >> (i * 8));
+  }
+}
+
+static const std::string* header(const http::Request& req,
+                                 http::Header_Key key) {
+  for(int i = 0; i < req.headers_size(); i++) {
+    const http::Header& h = req.headers(i);
+    if(h.has_key() && h.key() == key) return &h.value();
+  }
+
+  return 0;
+}
+
+WebSocket::WebSocket(Server& server, Connection& con, uint64_t stream,
+                     const std::string& destination, int cls)
+  : server_(server)
+  , con_(con)
+  , stream_(stream)
+  , destination_(destination)
+  , cls_(cls)
+  , fragmented_(false)
+  , binary_(false)
+  , message_()
+  , paused_(false)
+  , closed_(false)
+  , ended_(false)
+{}
+
+bool WebSocket::upgrade_p(const http::Request& req) {
+  if(!req.has_method() || req.method() != http::Request_Method_GET) {
+    return false;
+  }
+
+  const std::string* upgrade = header(req, http::Header_Key_UPGRADE);
+
+  return upgrade && strcasecmp(upgrade->c_str(), "websocket") == 0;
+}
+
+std::string WebSocket::queue() {
+  char id[32];
+  snprintf(id, sizeof(id), "%llu", (unsigned long long)stream_);
+
+  return server_.socket_queue() + "/" + id;
+}
+
+// Subprotocols and extensions aren't negotiated; a client asking for
+// either gets neither, which is for it to accept or not.
+bool WebSocket::handshake(const http::Request& req) {
+  const std::string* key = header(req, http::Header_Key_SEC_WEBSOCKET_KEY);
+  const std::string* version =
+    header(req, http::Header_Key_SEC_WEBSOCKET_VERSION);
+
+  if(!key || key->empty() || !version || *version != "13") {
+    static std::string sBadRequest(
+        "HTTP/1.1 400 Bad Request\r\n"
+        "Sec-WebSocket-Version: 13\r\n"
+        "Content-Length: 0\r\n\r\n");
+
+    con_.write(sBadRequest);
+    return false;
+  }
+
+  uint8_t digest[20];
+  sha1(*key + cGuid, digest);
+
+  con_.write("HTTP/1.1 101 Switching Protocols\r\n"
+             "Upgrade: websocket\r\n"
+             "Connection: Upgrade\r\n"
+             "Sec-WebSocket-Accept: " + base64(digest, sizeof(digest)) +
+             "\r\n\r\n");
+
+  return true;
+}
+
+void WebSocket::open(http::Request& req) {
+  req.set_stream_id(stream_);
+
+  http::SocketMessage msg;
+  msg.set_stream_id(stream_);
+  msg.set_reply_to(queue());
+  msg.mutable_request()->Swap(&req);
+
+  std::string payload = msg.SerializeAsString();
+  std::vector<uint64_t> none;
+
+  server_.send_payload(destination_, payload, eSocket, none, cls_, false);
+}
+
+size_t WebSocket::execute(uint8_t* data, size_t size) {
+  size_t done = 0;
+
+  while(!ended_) {
+    uint8_t* p = data + done;
+    size_t left = size - done;
+
+    if(left < 2) break;
+
+    bool fin = p[0] & cFin;
+    uint8_t opcode = p[0] & 0x0f;
+
+    // No extensions were agreed to, so no reserved bits, and every frame
+    // from a client has to be masked.
+    if((p[0] & 0x70) || !(p[1] & cMasked)) {
+      fail(cProtocolError);
+      return size;
+    }
+
+    uint64_t length = p[1] & 0x7f;
+    size_t head = 2;
+
+    if(length == 126) {
+      if(left < 4) break;
+      length = ((uint64_t)p[2] << 8) | p[3];
+      head = 4;
+    } else if(length == 127) {
+      if(left < 10) break;
+
+      length = 0;
+      for(int i = 0; i < 8; i++) length = (length << 8) | p[2 + i];
+      head = 10;
+    }
+
+    if(length > cMaxMessage ||
+       (opcode == eContinuation && message_.size() + length > cMaxMessage)) {
+      fail(cTooBig);
+      return size;
+    }
+
+    if(left < head + 4 + length) break;
+
+    uint8_t* payload = p + head + 4;
+    unmask(payload, length, p + head);
+
+    done += head + 4 + length;
+
+    if(opcode & 0x8) {
+      if(!fin || length > 125) {
+        fail(cProtocolError);
+        return size;
+      }
+
+      control(opcode, payload, length);
+      continue;
+    }
+
+    switch(opcode) {
+    case eContinuation:
+      if(!fragmented_) {
+        fail(cProtocolError);
+        return size;
+      }
+
+      message_.append((const char*)payload, length);
+
+      if(fin) {
+        forward(binary_, (const uint8_t*)message_.data(), message_.size());
+        message_.clear();
+        fragmented_ = false;
+      }
+      break;
+    case eText:
+    case eBinary:
+      if(fragmented_) {
+        fail(cProtocolError);
+        return size;
+      }
+
+      if(fin) {
+        forward(opcode == eBinary, payload, length);
+      } else {
+        fragmented_ = true;
+        binary_ = opcode == eBinary;
+        message_.assign((const char*)payload, length);
+      }
+      break;
+    default:
+      fail(cProtocolError);
+      return size;
+    }
+  }
+
+  return ended_ ? size : done;
+}
+
+void WebSocket::forward(bool binary, const uint8_t* data, size_t size) {
+  http::SocketMessage msg;
+  msg.set_stream_id(stream_);
+  if(binary) msg.set_binary(true);
+  msg.set_body(data, size);
+
+  std::string payload = msg.SerializeAsString();
+  std::vector<uint64_t> none;
+
+  server_.send_payload(destination_, payload, eSocket, none, cls_, false);
+  server_.stats().socket_messages_in++;
+}
+
+// Lets the destination know the socket is gone, once.
+void WebSocket::end() {
+  if(ended_) return;
+  ended_ = true;
+
+  http::SocketMessage msg;
+  msg.set_stream_id(stream_);
+  msg.set_end(true);
+
+  std::string payload = msg.SerializeAsString();
+  std::vector<uint64_t> none;
+
+  server_.send_payload(destination_, payload, eSocket, none, cls_, false);
+}
+
+void WebSocket::control(uint8_t opcode, const uint8_t* data, size_t size) {
+  std::string out;
+
+  switch(opcode) {
+  case ePing:
+    frame_head(out, ePong, size);
+    out.append((const char*)data, size);
+    con_.write(out);
+    break;
+  case eClose:
+    // Echo the client's status code back, unless we've already closed.
+    if(!closed_) {
+      closed_ = true;
+
+      frame_head(out, eClose, size >= 2 ? 2 : 0);
+      out.append((const char*)data, size >= 2 ? 2 : 0);
+      con_.write(out);
+    }
+
+    end();
+    con_.close_when_drained();
+    break;
+  }
+}
+
+void WebSocket::fail(uint16_t code) {
+  debugs << "Failing websocket " << stream_ << " with " << code << "\n";
+
+  if(!closed_) {
+    closed_ = true;
+
+    std::string out;
+    frame_head(out, eClose, 2);
+    out.push_back(code >> 8);
+    out.push_back(code);
+    con_.write(out);
+  }
+
+  end();
+  con_.close_when_drained();
+}
+
+// A message with end set closes the socket after its body, if it has
+// one, goes out.
+void WebSocket::send(Reply& rep) {
+  if(closed_) return;
+
+  if(rep.body_size() > 0 || rep.more_p()) {
+    std::string head;
+    frame_head(head, rep.binary_p() ? eBinary : eText, rep.body_size());
+
+    if(rep.body_size() > 0) {
+      con_.write(head, rep.segment(), rep.body(), rep.body_size());
+    } else {
+      con_.write(head);
+    }
+
+    server_.stats().socket_messages_out++;
+  }
+
+  if(!rep.more_p()) {
+    ended_ = true;
+    closed_ = true;
+
+    std::string out;
+    frame_head(out, eClose, 2);
+    out.push_back(cNormal >> 8);
+    out.push_back(cNormal & 0xff);
+    con_.write(out);
+
+    con_.close_when_drained();
+  }
+}
+
+void WebSocket::close() {
+  end();
+  server_.close_socket(stream_);
+}
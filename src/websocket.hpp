@@ -0,0 +1,112 @@
+#ifndef WEBSOCKET_HPP
+#define WEBSOCKET_HPP
+
+#include <stdint.h>
+
+#include <string>
+
+class Server;
+class Connection;
+class Reply;
+
+namespace http {
+  class Request;
+}
+
+// A client connection upgraded to a WebSocket (RFC 6455) on a route with
+// the websocket option, bridged to the route's destination.
+//
+// Each message the client sends goes to the destination as an
+// http::SocketMessage on the socket's stream. Client frames are unmasked
+// where they sit in the read buffer, and a message in a single frame is
+// forwarded without being gathered anywhere first. Messages for the
+// client arrive on an ephemeral queue of the socket's own (see
+// Server::open_socket) and are framed straight out of the segment they
+// were read into; server frames aren't masked, so there's nothing to
+// copy.
+class WebSocket {
+  Server& server_;
+  Connection& con_;
+
+  uint64_t stream_;
+  std::string destination_;
+  int cls_;
+
+  // A message split over several frames, waiting on its last one.
+  bool fragmented_;
+  bool binary_;
+  std::string message_;
+
+  // The destination was sent a Flow pausing the socket's stream.
+  bool paused_;
+
+  bool closed_;   // a close frame has gone out
+  bool ended_;    // the destination was told the socket is gone
+
+public:
+  // The most a client may send in one message, over however many frames,
+  // and so the biggest frame, header and mask included, it can send.
+  static const uint64_t cMaxMessage = 1 << 20;
+  static const uint64_t cMaxFrame = cMaxMessage + 14;
+
+  WebSocket(Server& server, Connection& con, uint64_t stream,
+            const std::string& destination, int cls);
+
+  // Whether req asks to upgrade to a WebSocket.
+  static bool upgrade_p(const http::Request& req);
+
+  uint64_t stream() {
+    return stream_;
+  }
+
+  const std::string& destination() {
+    return destination_;
+  }
+
+  int cls() {
+    return cls_;
+  }
+
+  Connection& connection() {
+    return con_;
+  }
+
+  bool paused_p() {
+    return paused_;
+  }
+
+  void set_paused(bool paused) {
+    paused_ = paused;
+  }
+
+  // The ephemeral queue for messages to the client.
+  std::string queue();
+
+  // Answers the handshake in req, with a 101 or, when it's not one we
+  // can take, a 400.
+  bool handshake(const http::Request& req);
+
+  // Tells the destination the socket is open, handing it req.
+  void open(http::Request& req);
+
+  // Reads whole frames, leaving any partial one for next time.
+  size_t execute(uint8_t* data, size_t size);
+
+  // A message from the socket's queue.
+  void send(Reply& rep);
+
+  // con_ was closed.
+  void close();
+
+private:
+  WebSocket(const WebSocket&);
+  WebSocket& operator=(const WebSocket&);
+
+  void forward(bool binary, const uint8_t* data, size_t size);
+  void end();
+
+  void control(uint8_t opcode, const uint8_t* data, size_t size);
+  void fail(uint16_t code);
+};
+
+#endif
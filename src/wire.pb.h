@@ -1,1488 +1,2572 @@
 // Generated by the protocol buffer compiler.  DO NOT EDIT!
 // source: wire.proto
 
-#ifndef PROTOBUF_wire_2eproto__INCLUDED
-#define PROTOBUF_wire_2eproto__INCLUDED
+#ifndef GOOGLE_PROTOBUF_INCLUDED_wire_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_wire_2eproto
 
+#include <limits>
 #include <string>
 
-#include <google/protobuf/stubs/common.h>
-
-#if GOOGLE_PROTOBUF_VERSION < 2005000
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please update
+#error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 2005000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
-#error incompatible with your Protocol Buffer headers.  Please
+#error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
 #endif
 
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
 #include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/message.h>
-#include <google/protobuf/repeated_field.h>
-#include <google/protobuf/extension_set.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 // @@protoc_insertion_point(includes)
-
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_wire_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_wire_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_wire_2eproto;
 namespace wire {
-
-// Internal implementation detail -- do not call these.
-void  protobuf_AddDesc_wire_2eproto();
-void protobuf_AssignDesc_wire_2eproto();
-void protobuf_ShutdownFile_wire_2eproto();
-
-class Message;
 class Action;
+struct ActionDefaultTypeInternal;
+extern ActionDefaultTypeInternal _Action_default_instance_;
 class BondRequest;
+struct BondRequestDefaultTypeInternal;
+extern BondRequestDefaultTypeInternal _BondRequest_default_instance_;
 class ConnectionConfigure;
+struct ConnectionConfigureDefaultTypeInternal;
+extern ConnectionConfigureDefaultTypeInternal _ConnectionConfigure_default_instance_;
+class Message;
+struct MessageDefaultTypeInternal;
+extern MessageDefaultTypeInternal _Message_default_instance_;
 class MessageRange;
+struct MessageRangeDefaultTypeInternal;
+extern MessageRangeDefaultTypeInternal _MessageRange_default_instance_;
 class Queue;
-class Stat;
-class ReplicaAction;
-class QueueError;
-class QueueDeclaration;
+struct QueueDefaultTypeInternal;
+extern QueueDefaultTypeInternal _Queue_default_instance_;
 class QueueConfiguration;
+struct QueueConfigurationDefaultTypeInternal;
+extern QueueConfigurationDefaultTypeInternal _QueueConfiguration_default_instance_;
+class QueueDeclaration;
+struct QueueDeclarationDefaultTypeInternal;
+extern QueueDeclarationDefaultTypeInternal _QueueDeclaration_default_instance_;
+class QueueError;
+struct QueueErrorDefaultTypeInternal;
+extern QueueErrorDefaultTypeInternal _QueueError_default_instance_;
+class ReplicaAction;
+struct ReplicaActionDefaultTypeInternal;
+extern ReplicaActionDefaultTypeInternal _ReplicaAction_default_instance_;
+class Stat;
+struct StatDefaultTypeInternal;
+extern StatDefaultTypeInternal _Stat_default_instance_;
+}  // namespace wire
+PROTOBUF_NAMESPACE_OPEN
+template<> ::wire::Action* Arena::CreateMaybeMessage<::wire::Action>(Arena*);
+template<> ::wire::BondRequest* Arena::CreateMaybeMessage<::wire::BondRequest>(Arena*);
+template<> ::wire::ConnectionConfigure* Arena::CreateMaybeMessage<::wire::ConnectionConfigure>(Arena*);
+template<> ::wire::Message* Arena::CreateMaybeMessage<::wire::Message>(Arena*);
+template<> ::wire::MessageRange* Arena::CreateMaybeMessage<::wire::MessageRange>(Arena*);
+template<> ::wire::Queue* Arena::CreateMaybeMessage<::wire::Queue>(Arena*);
+template<> ::wire::QueueConfiguration* Arena::CreateMaybeMessage<::wire::QueueConfiguration>(Arena*);
+template<> ::wire::QueueDeclaration* Arena::CreateMaybeMessage<::wire::QueueDeclaration>(Arena*);
+template<> ::wire::QueueError* Arena::CreateMaybeMessage<::wire::QueueError>(Arena*);
+template<> ::wire::ReplicaAction* Arena::CreateMaybeMessage<::wire::ReplicaAction>(Arena*);
+template<> ::wire::Stat* Arena::CreateMaybeMessage<::wire::Stat>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace wire {
 
-enum ReplicaAction_Type {
+enum ReplicaAction_Type : int {
   ReplicaAction_Type_eStart = 0,
   ReplicaAction_Type_eReserve = 1
 };
 bool ReplicaAction_Type_IsValid(int value);
-const ReplicaAction_Type ReplicaAction_Type_Type_MIN = ReplicaAction_Type_eStart;
-const ReplicaAction_Type ReplicaAction_Type_Type_MAX = ReplicaAction_Type_eReserve;
-const int ReplicaAction_Type_Type_ARRAYSIZE = ReplicaAction_Type_Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* ReplicaAction_Type_descriptor();
-inline const ::std::string& ReplicaAction_Type_Name(ReplicaAction_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    ReplicaAction_Type_descriptor(), value);
+constexpr ReplicaAction_Type ReplicaAction_Type_Type_MIN = ReplicaAction_Type_eStart;
+constexpr ReplicaAction_Type ReplicaAction_Type_Type_MAX = ReplicaAction_Type_eReserve;
+constexpr int ReplicaAction_Type_Type_ARRAYSIZE = ReplicaAction_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* ReplicaAction_Type_descriptor();
+template<typename T>
+inline const std::string& ReplicaAction_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, ReplicaAction_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function ReplicaAction_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    ReplicaAction_Type_descriptor(), enum_t_value);
 }
 inline bool ReplicaAction_Type_Parse(
-    const ::std::string& name, ReplicaAction_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<ReplicaAction_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, ReplicaAction_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<ReplicaAction_Type>(
     ReplicaAction_Type_descriptor(), name, value);
 }
-enum QueueDeclaration_Type {
+enum QueueDeclaration_Type : int {
   QueueDeclaration_Type_eBroadcast = 0,
   QueueDeclaration_Type_eTransient = 1,
   QueueDeclaration_Type_eDurable = 2
 };
 bool QueueDeclaration_Type_IsValid(int value);
-const QueueDeclaration_Type QueueDeclaration_Type_Type_MIN = QueueDeclaration_Type_eBroadcast;
-const QueueDeclaration_Type QueueDeclaration_Type_Type_MAX = QueueDeclaration_Type_eDurable;
-const int QueueDeclaration_Type_Type_ARRAYSIZE = QueueDeclaration_Type_Type_MAX + 1;
-
-const ::google::protobuf::EnumDescriptor* QueueDeclaration_Type_descriptor();
-inline const ::std::string& QueueDeclaration_Type_Name(QueueDeclaration_Type value) {
-  return ::google::protobuf::internal::NameOfEnum(
-    QueueDeclaration_Type_descriptor(), value);
+constexpr QueueDeclaration_Type QueueDeclaration_Type_Type_MIN = QueueDeclaration_Type_eBroadcast;
+constexpr QueueDeclaration_Type QueueDeclaration_Type_Type_MAX = QueueDeclaration_Type_eDurable;
+constexpr int QueueDeclaration_Type_Type_ARRAYSIZE = QueueDeclaration_Type_Type_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* QueueDeclaration_Type_descriptor();
+template<typename T>
+inline const std::string& QueueDeclaration_Type_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, QueueDeclaration_Type>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function QueueDeclaration_Type_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    QueueDeclaration_Type_descriptor(), enum_t_value);
 }
 inline bool QueueDeclaration_Type_Parse(
-    const ::std::string& name, QueueDeclaration_Type* value) {
-  return ::google::protobuf::internal::ParseNamedEnum<QueueDeclaration_Type>(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, QueueDeclaration_Type* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<QueueDeclaration_Type>(
     QueueDeclaration_Type_descriptor(), name, value);
 }
 // ===================================================================
 
-class Message : public ::google::protobuf::Message {
+class Message final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Message) */ {
  public:
-  Message();
-  virtual ~Message();
+  inline Message() : Message(nullptr) {}
+  ~Message() override;
+  explicit PROTOBUF_CONSTEXPR Message(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Message(const Message& from);
+  Message(Message&& from) noexcept
+    : Message() {
+    *this = ::std::move(from);
+  }
 
   inline Message& operator=(const Message& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Message& operator=(Message&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Message& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Message& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Message* internal_default_instance() {
+    return reinterpret_cast<const Message*>(
+               &_Message_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
 
-  void Swap(Message* other);
+  friend void swap(Message& a, Message& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Message* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Message* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Message* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Message* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Message>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Message& from);
-  void MergeFrom(const Message& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Message& from) {
+    Message::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Message* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Message";
+  }
+  protected:
+  explicit Message(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kDestinationFieldNumber = 1,
+    kPayloadFieldNumber = 2,
+    kIdFieldNumber = 3,
+    kConfirmIdFieldNumber = 5,
+    kFlagsFieldNumber = 4,
+  };
   // required string destination = 1;
-  inline bool has_destination() const;
-  inline void clear_destination();
-  static const int kDestinationFieldNumber = 1;
-  inline const ::std::string& destination() const;
-  inline void set_destination(const ::std::string& value);
-  inline void set_destination(const char* value);
-  inline void set_destination(const char* value, size_t size);
-  inline ::std::string* mutable_destination();
-  inline ::std::string* release_destination();
-  inline void set_allocated_destination(::std::string* destination);
+  bool has_destination() const;
+  private:
+  bool _internal_has_destination() const;
+  public:
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
 
   // required bytes payload = 2;
-  inline bool has_payload() const;
-  inline void clear_payload();
-  static const int kPayloadFieldNumber = 2;
-  inline const ::std::string& payload() const;
-  inline void set_payload(const ::std::string& value);
-  inline void set_payload(const char* value);
-  inline void set_payload(const void* value, size_t size);
-  inline ::std::string* mutable_payload();
-  inline ::std::string* release_payload();
-  inline void set_allocated_payload(::std::string* payload);
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
 
   // optional uint64 id = 3;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 3;
-  inline ::google::protobuf::uint64 id() const;
-  inline void set_id(::google::protobuf::uint64 value);
-
-  // optional uint32 flags = 4;
-  inline bool has_flags() const;
-  inline void clear_flags();
-  static const int kFlagsFieldNumber = 4;
-  inline ::google::protobuf::uint32 flags() const;
-  inline void set_flags(::google::protobuf::uint32 value);
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
 
   // optional uint64 confirm_id = 5;
-  inline bool has_confirm_id() const;
-  inline void clear_confirm_id();
-  static const int kConfirmIdFieldNumber = 5;
-  inline ::google::protobuf::uint64 confirm_id() const;
-  inline void set_confirm_id(::google::protobuf::uint64 value);
+  bool has_confirm_id() const;
+  private:
+  bool _internal_has_confirm_id() const;
+  public:
+  void clear_confirm_id();
+  uint64_t confirm_id() const;
+  void set_confirm_id(uint64_t value);
+  private:
+  uint64_t _internal_confirm_id() const;
+  void _internal_set_confirm_id(uint64_t value);
+  public:
+
+  // optional uint32 flags = 4;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  uint32_t flags() const;
+  void set_flags(uint32_t value);
+  private:
+  uint32_t _internal_flags() const;
+  void _internal_set_flags(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.Message)
  private:
-  inline void set_has_destination();
-  inline void clear_has_destination();
-  inline void set_has_payload();
-  inline void clear_has_payload();
-  inline void set_has_id();
-  inline void clear_has_id();
-  inline void set_has_flags();
-  inline void clear_has_flags();
-  inline void set_has_confirm_id();
-  inline void clear_has_confirm_id();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* destination_;
-  ::std::string* payload_;
-  ::google::protobuf::uint64 id_;
-  ::google::protobuf::uint64 confirm_id_;
-  ::google::protobuf::uint32 flags_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(5 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Message* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint64_t id_;
+    uint64_t confirm_id_;
+    uint32_t flags_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Action : public ::google::protobuf::Message {
+class Action final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Action) */ {
  public:
-  Action();
-  virtual ~Action();
+  inline Action() : Action(nullptr) {}
+  ~Action() override;
+  explicit PROTOBUF_CONSTEXPR Action(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Action(const Action& from);
+  Action(Action&& from) noexcept
+    : Action() {
+    *this = ::std::move(from);
+  }
 
   inline Action& operator=(const Action& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Action& operator=(Action&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Action& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Action& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Action* internal_default_instance() {
+    return reinterpret_cast<const Action*>(
+               &_Action_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
 
-  void Swap(Action* other);
+  friend void swap(Action& a, Action& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Action* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Action* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Action* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Action* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Action>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Action& from);
-  void MergeFrom(const Action& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Action& from) {
+    Action::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Action* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Action";
+  }
+  protected:
+  explicit Action(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::google::protobuf::int32 type() const;
-  inline void set_type(::google::protobuf::int32 value);
-
-  // optional string payload = 2;
-  inline bool has_payload() const;
-  inline void clear_payload();
-  static const int kPayloadFieldNumber = 2;
-  inline const ::std::string& payload() const;
-  inline void set_payload(const ::std::string& value);
-  inline void set_payload(const char* value);
-  inline void set_payload(const char* value, size_t size);
-  inline ::std::string* mutable_payload();
-  inline ::std::string* release_payload();
-  inline void set_allocated_payload(::std::string* payload);
+  enum : int {
+    kPayloadFieldNumber = 2,
+    kIdFieldNumber = 3,
+    kTypeFieldNumber = 1,
+  };
+  // optional bytes payload = 2;
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
 
   // optional uint64 id = 3;
-  inline bool has_id() const;
-  inline void clear_id();
-  static const int kIdFieldNumber = 3;
-  inline ::google::protobuf::uint64 id() const;
-  inline void set_id(::google::protobuf::uint64 value);
+  bool has_id() const;
+  private:
+  bool _internal_has_id() const;
+  public:
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // required int32 type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  int32_t type() const;
+  void set_type(int32_t value);
+  private:
+  int32_t _internal_type() const;
+  void _internal_set_type(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.Action)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_payload();
-  inline void clear_has_payload();
-  inline void set_has_id();
-  inline void clear_has_id();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* payload_;
-  ::google::protobuf::uint64 id_;
-  ::google::protobuf::int32 type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(3 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Action* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    uint64_t id_;
+    int32_t type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class BondRequest : public ::google::protobuf::Message {
+class BondRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.BondRequest) */ {
  public:
-  BondRequest();
-  virtual ~BondRequest();
+  inline BondRequest() : BondRequest(nullptr) {}
+  ~BondRequest() override;
+  explicit PROTOBUF_CONSTEXPR BondRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   BondRequest(const BondRequest& from);
+  BondRequest(BondRequest&& from) noexcept
+    : BondRequest() {
+    *this = ::std::move(from);
+  }
 
   inline BondRequest& operator=(const BondRequest& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline BondRequest& operator=(BondRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const BondRequest& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BondRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BondRequest* internal_default_instance() {
+    return reinterpret_cast<const BondRequest*>(
+               &_BondRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
 
-  void Swap(BondRequest* other);
+  friend void swap(BondRequest& a, BondRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BondRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BondRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  BondRequest* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  BondRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BondRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const BondRequest& from);
-  void MergeFrom(const BondRequest& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BondRequest& from) {
+    BondRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BondRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.BondRequest";
+  }
+  protected:
+  explicit BondRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kQueueFieldNumber = 1,
+    kDestinationFieldNumber = 2,
+  };
   // required string queue = 1;
-  inline bool has_queue() const;
-  inline void clear_queue();
-  static const int kQueueFieldNumber = 1;
-  inline const ::std::string& queue() const;
-  inline void set_queue(const ::std::string& value);
-  inline void set_queue(const char* value);
-  inline void set_queue(const char* value, size_t size);
-  inline ::std::string* mutable_queue();
-  inline ::std::string* release_queue();
-  inline void set_allocated_queue(::std::string* queue);
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
 
   // required string destination = 2;
-  inline bool has_destination() const;
-  inline void clear_destination();
-  static const int kDestinationFieldNumber = 2;
-  inline const ::std::string& destination() const;
-  inline void set_destination(const ::std::string& value);
-  inline void set_destination(const char* value);
-  inline void set_destination(const char* value, size_t size);
-  inline ::std::string* mutable_destination();
-  inline ::std::string* release_destination();
-  inline void set_allocated_destination(::std::string* destination);
+  bool has_destination() const;
+  private:
+  bool _internal_has_destination() const;
+  public:
+  void clear_destination();
+  const std::string& destination() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_destination(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_destination();
+  PROTOBUF_NODISCARD std::string* release_destination();
+  void set_allocated_destination(std::string* destination);
+  private:
+  const std::string& _internal_destination() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_destination(const std::string& value);
+  std::string* _internal_mutable_destination();
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.BondRequest)
  private:
-  inline void set_has_queue();
-  inline void clear_has_queue();
-  inline void set_has_destination();
-  inline void clear_has_destination();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* queue_;
-  ::std::string* destination_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static BondRequest* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr destination_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ConnectionConfigure : public ::google::protobuf::Message {
+class ConnectionConfigure final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ConnectionConfigure) */ {
  public:
-  ConnectionConfigure();
-  virtual ~ConnectionConfigure();
+  inline ConnectionConfigure() : ConnectionConfigure(nullptr) {}
+  ~ConnectionConfigure() override;
+  explicit PROTOBUF_CONSTEXPR ConnectionConfigure(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ConnectionConfigure(const ConnectionConfigure& from);
+  ConnectionConfigure(ConnectionConfigure&& from) noexcept
+    : ConnectionConfigure() {
+    *this = ::std::move(from);
+  }
 
   inline ConnectionConfigure& operator=(const ConnectionConfigure& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ConnectionConfigure& operator=(ConnectionConfigure&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ConnectionConfigure& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ConnectionConfigure& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConnectionConfigure* internal_default_instance() {
+    return reinterpret_cast<const ConnectionConfigure*>(
+               &_ConnectionConfigure_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
 
-  void Swap(ConnectionConfigure* other);
+  friend void swap(ConnectionConfigure& a, ConnectionConfigure& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConnectionConfigure* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConnectionConfigure* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ConnectionConfigure* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ConnectionConfigure* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConnectionConfigure>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ConnectionConfigure& from);
-  void MergeFrom(const ConnectionConfigure& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ConnectionConfigure& from) {
+    ConnectionConfigure::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ConnectionConfigure* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ConnectionConfigure";
+  }
+  protected:
+  explicit ConnectionConfigure(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kTapFieldNumber = 1,
+    kAckFieldNumber = 2,
+    kConfirmFieldNumber = 3,
+    kDeflateFieldNumber = 5,
+    kInflightFieldNumber = 4,
+    kDictionaryIdFieldNumber = 6,
+  };
   // optional bool tap = 1;
-  inline bool has_tap() const;
-  inline void clear_tap();
-  static const int kTapFieldNumber = 1;
-  inline bool tap() const;
-  inline void set_tap(bool value);
+  bool has_tap() const;
+  private:
+  bool _internal_has_tap() const;
+  public:
+  void clear_tap();
+  bool tap() const;
+  void set_tap(bool value);
+  private:
+  bool _internal_tap() const;
+  void _internal_set_tap(bool value);
+  public:
 
   // optional bool ack = 2;
-  inline bool has_ack() const;
-  inline void clear_ack();
-  static const int kAckFieldNumber = 2;
-  inline bool ack() const;
-  inline void set_ack(bool value);
+  bool has_ack() const;
+  private:
+  bool _internal_has_ack() const;
+  public:
+  void clear_ack();
+  bool ack() const;
+  void set_ack(bool value);
+  private:
+  bool _internal_ack() const;
+  void _internal_set_ack(bool value);
+  public:
 
   // optional bool confirm = 3;
-  inline bool has_confirm() const;
-  inline void clear_confirm();
-  static const int kConfirmFieldNumber = 3;
-  inline bool confirm() const;
-  inline void set_confirm(bool value);
+  bool has_confirm() const;
+  private:
+  bool _internal_has_confirm() const;
+  public:
+  void clear_confirm();
+  bool confirm() const;
+  void set_confirm(bool value);
+  private:
+  bool _internal_confirm() const;
+  void _internal_set_confirm(bool value);
+  public:
+
+  // optional bool deflate = 5;
+  bool has_deflate() const;
+  private:
+  bool _internal_has_deflate() const;
+  public:
+  void clear_deflate();
+  bool deflate() const;
+  void set_deflate(bool value);
+  private:
+  bool _internal_deflate() const;
+  void _internal_set_deflate(bool value);
+  public:
 
   // optional uint32 inflight = 4;
-  inline bool has_inflight() const;
-  inline void clear_inflight();
-  static const int kInflightFieldNumber = 4;
-  inline ::google::protobuf::uint32 inflight() const;
-  inline void set_inflight(::google::protobuf::uint32 value);
+  bool has_inflight() const;
+  private:
+  bool _internal_has_inflight() const;
+  public:
+  void clear_inflight();
+  uint32_t inflight() const;
+  void set_inflight(uint32_t value);
+  private:
+  uint32_t _internal_inflight() const;
+  void _internal_set_inflight(uint32_t value);
+  public:
+
+  // optional uint32 dictionary_id = 6;
+  bool has_dictionary_id() const;
+  private:
+  bool _internal_has_dictionary_id() const;
+  public:
+  void clear_dictionary_id();
+  uint32_t dictionary_id() const;
+  void set_dictionary_id(uint32_t value);
+  private:
+  uint32_t _internal_dictionary_id() const;
+  void _internal_set_dictionary_id(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.ConnectionConfigure)
  private:
-  inline void set_has_tap();
-  inline void clear_has_tap();
-  inline void set_has_ack();
-  inline void clear_has_ack();
-  inline void set_has_confirm();
-  inline void clear_has_confirm();
-  inline void set_has_inflight();
-  inline void clear_has_inflight();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  bool tap_;
-  bool ack_;
-  bool confirm_;
-  ::google::protobuf::uint32 inflight_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static ConnectionConfigure* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool tap_;
+    bool ack_;
+    bool confirm_;
+    bool deflate_;
+    uint32_t inflight_;
+    uint32_t dictionary_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class MessageRange : public ::google::protobuf::Message {
+class MessageRange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.MessageRange) */ {
  public:
-  MessageRange();
-  virtual ~MessageRange();
+  inline MessageRange() : MessageRange(nullptr) {}
+  ~MessageRange() override;
+  explicit PROTOBUF_CONSTEXPR MessageRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   MessageRange(const MessageRange& from);
+  MessageRange(MessageRange&& from) noexcept
+    : MessageRange() {
+    *this = ::std::move(from);
+  }
 
   inline MessageRange& operator=(const MessageRange& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline MessageRange& operator=(MessageRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const MessageRange& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const MessageRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const MessageRange* internal_default_instance() {
+    return reinterpret_cast<const MessageRange*>(
+               &_MessageRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
 
-  void Swap(MessageRange* other);
+  friend void swap(MessageRange& a, MessageRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(MessageRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(MessageRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  MessageRange* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  MessageRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MessageRange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const MessageRange& from);
-  void MergeFrom(const MessageRange& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const MessageRange& from) {
+    MessageRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(MessageRange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.MessageRange";
+  }
+  protected:
+  explicit MessageRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kStartFieldNumber = 1,
+    kCountFieldNumber = 2,
+  };
   // required int32 start = 1;
-  inline bool has_start() const;
-  inline void clear_start();
-  static const int kStartFieldNumber = 1;
-  inline ::google::protobuf::int32 start() const;
-  inline void set_start(::google::protobuf::int32 value);
+  bool has_start() const;
+  private:
+  bool _internal_has_start() const;
+  public:
+  void clear_start();
+  int32_t start() const;
+  void set_start(int32_t value);
+  private:
+  int32_t _internal_start() const;
+  void _internal_set_start(int32_t value);
+  public:
 
   // required int32 count = 2;
-  inline bool has_count() const;
-  inline void clear_count();
-  static const int kCountFieldNumber = 2;
-  inline ::google::protobuf::int32 count() const;
-  inline void set_count(::google::protobuf::int32 value);
+  bool has_count() const;
+  private:
+  bool _internal_has_count() const;
+  public:
+  void clear_count();
+  int32_t count() const;
+  void set_count(int32_t value);
+  private:
+  int32_t _internal_count() const;
+  void _internal_set_count(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.MessageRange)
  private:
-  inline void set_has_start();
-  inline void clear_has_start();
-  inline void set_has_count();
-  inline void clear_has_count();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::int32 start_;
-  ::google::protobuf::int32 count_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static MessageRange* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t start_;
+    int32_t count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Queue : public ::google::protobuf::Message {
+class Queue final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Queue) */ {
  public:
-  Queue();
-  virtual ~Queue();
+  inline Queue() : Queue(nullptr) {}
+  ~Queue() override;
+  explicit PROTOBUF_CONSTEXPR Queue(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Queue(const Queue& from);
+  Queue(Queue&& from) noexcept
+    : Queue() {
+    *this = ::std::move(from);
+  }
 
   inline Queue& operator=(const Queue& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Queue& operator=(Queue&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Queue& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Queue& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Queue* internal_default_instance() {
+    return reinterpret_cast<const Queue*>(
+               &_Queue_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
 
-  void Swap(Queue* other);
+  friend void swap(Queue& a, Queue& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Queue* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Queue* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Queue* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Queue* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Queue>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Queue& from);
-  void MergeFrom(const Queue& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Queue& from) {
+    Queue::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Queue* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Queue";
+  }
+  protected:
+  explicit Queue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
-  // required int32 size = 1;
-  inline bool has_size() const;
-  inline void clear_size();
-  static const int kSizeFieldNumber = 1;
-  inline ::google::protobuf::int32 size() const;
-  inline void set_size(::google::protobuf::int32 value);
-
+  enum : int {
+    kRangesFieldNumber = 2,
+    kSizeFieldNumber = 1,
+  };
   // repeated .wire.MessageRange ranges = 2;
-  inline int ranges_size() const;
-  inline void clear_ranges();
-  static const int kRangesFieldNumber = 2;
-  inline const ::wire::MessageRange& ranges(int index) const;
-  inline ::wire::MessageRange* mutable_ranges(int index);
-  inline ::wire::MessageRange* add_ranges();
-  inline const ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >&
-      ranges() const;
-  inline ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >*
+  int ranges_size() const;
+  private:
+  int _internal_ranges_size() const;
+  public:
+  void clear_ranges();
+  ::wire::MessageRange* mutable_ranges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >*
       mutable_ranges();
+  private:
+  const ::wire::MessageRange& _internal_ranges(int index) const;
+  ::wire::MessageRange* _internal_add_ranges();
+  public:
+  const ::wire::MessageRange& ranges(int index) const;
+  ::wire::MessageRange* add_ranges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >&
+      ranges() const;
+
+  // required int32 size = 1;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  int32_t size() const;
+  void set_size(int32_t value);
+  private:
+  int32_t _internal_size() const;
+  void _internal_set_size(int32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.Queue)
  private:
-  inline void set_has_size();
-  inline void clear_has_size();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::wire::MessageRange > ranges_;
-  ::google::protobuf::int32 size_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Queue* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange > ranges_;
+    int32_t size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Stat : public ::google::protobuf::Message {
+class Stat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.Stat) */ {
  public:
-  Stat();
-  virtual ~Stat();
+  inline Stat() : Stat(nullptr) {}
+  ~Stat() override;
+  explicit PROTOBUF_CONSTEXPR Stat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   Stat(const Stat& from);
+  Stat(Stat&& from) noexcept
+    : Stat() {
+    *this = ::std::move(from);
+  }
 
   inline Stat& operator=(const Stat& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline Stat& operator=(Stat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const Stat& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stat* internal_default_instance() {
+    return reinterpret_cast<const Stat*>(
+               &_Stat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
 
-  void Swap(Stat* other);
+  friend void swap(Stat& a, Stat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  Stat* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  Stat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const Stat& from);
-  void MergeFrom(const Stat& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stat& from) {
+    Stat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.Stat";
+  }
+  protected:
+  explicit Stat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kExistsFieldNumber = 2,
+    kTransientSizeFieldNumber = 3,
+    kDurableSizeFieldNumber = 4,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // required bool exists = 2;
-  inline bool has_exists() const;
-  inline void clear_exists();
-  static const int kExistsFieldNumber = 2;
-  inline bool exists() const;
-  inline void set_exists(bool value);
+  bool has_exists() const;
+  private:
+  bool _internal_has_exists() const;
+  public:
+  void clear_exists();
+  bool exists() const;
+  void set_exists(bool value);
+  private:
+  bool _internal_exists() const;
+  void _internal_set_exists(bool value);
+  public:
 
   // optional uint32 transient_size = 3;
-  inline bool has_transient_size() const;
-  inline void clear_transient_size();
-  static const int kTransientSizeFieldNumber = 3;
-  inline ::google::protobuf::uint32 transient_size() const;
-  inline void set_transient_size(::google::protobuf::uint32 value);
+  bool has_transient_size() const;
+  private:
+  bool _internal_has_transient_size() const;
+  public:
+  void clear_transient_size();
+  uint32_t transient_size() const;
+  void set_transient_size(uint32_t value);
+  private:
+  uint32_t _internal_transient_size() const;
+  void _internal_set_transient_size(uint32_t value);
+  public:
 
   // optional uint32 durable_size = 4;
-  inline bool has_durable_size() const;
-  inline void clear_durable_size();
-  static const int kDurableSizeFieldNumber = 4;
-  inline ::google::protobuf::uint32 durable_size() const;
-  inline void set_durable_size(::google::protobuf::uint32 value);
+  bool has_durable_size() const;
+  private:
+  bool _internal_has_durable_size() const;
+  public:
+  void clear_durable_size();
+  uint32_t durable_size() const;
+  void set_durable_size(uint32_t value);
+  private:
+  uint32_t _internal_durable_size() const;
+  void _internal_set_durable_size(uint32_t value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.Stat)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_exists();
-  inline void clear_has_exists();
-  inline void set_has_transient_size();
-  inline void clear_has_transient_size();
-  inline void set_has_durable_size();
-  inline void clear_has_durable_size();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  bool exists_;
-  ::google::protobuf::uint32 transient_size_;
-  ::google::protobuf::uint32 durable_size_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(4 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static Stat* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool exists_;
+    uint32_t transient_size_;
+    uint32_t durable_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ReplicaAction : public ::google::protobuf::Message {
+class ReplicaAction final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.ReplicaAction) */ {
  public:
-  ReplicaAction();
-  virtual ~ReplicaAction();
+  inline ReplicaAction() : ReplicaAction(nullptr) {}
+  ~ReplicaAction() override;
+  explicit PROTOBUF_CONSTEXPR ReplicaAction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ReplicaAction(const ReplicaAction& from);
+  ReplicaAction(ReplicaAction&& from) noexcept
+    : ReplicaAction() {
+    *this = ::std::move(from);
+  }
 
   inline ReplicaAction& operator=(const ReplicaAction& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline ReplicaAction& operator=(ReplicaAction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const ReplicaAction& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReplicaAction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReplicaAction* internal_default_instance() {
+    return reinterpret_cast<const ReplicaAction*>(
+               &_ReplicaAction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
 
-  void Swap(ReplicaAction* other);
+  friend void swap(ReplicaAction& a, ReplicaAction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReplicaAction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReplicaAction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  ReplicaAction* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  ReplicaAction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReplicaAction>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const ReplicaAction& from);
-  void MergeFrom(const ReplicaAction& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReplicaAction& from) {
+    ReplicaAction::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReplicaAction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.ReplicaAction";
+  }
+  protected:
+  explicit ReplicaAction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef ReplicaAction_Type Type;
-  static const Type eStart = ReplicaAction_Type_eStart;
-  static const Type eReserve = ReplicaAction_Type_eReserve;
+  static constexpr Type eStart =
+    ReplicaAction_Type_eStart;
+  static constexpr Type eReserve =
+    ReplicaAction_Type_eReserve;
   static inline bool Type_IsValid(int value) {
     return ReplicaAction_Type_IsValid(value);
   }
-  static const Type Type_MIN =
+  static constexpr Type Type_MIN =
     ReplicaAction_Type_Type_MIN;
-  static const Type Type_MAX =
+  static constexpr Type Type_MAX =
     ReplicaAction_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
+  static constexpr int Type_ARRAYSIZE =
     ReplicaAction_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Type_descriptor() {
     return ReplicaAction_Type_descriptor();
   }
-  static inline const ::std::string& Type_Name(Type value) {
-    return ReplicaAction_Type_Name(value);
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return ReplicaAction_Type_Name(enum_t_value);
   }
-  static inline bool Type_Parse(const ::std::string& name,
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Type* value) {
     return ReplicaAction_Type_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
-  // required .wire.ReplicaAction.Type type = 1;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 1;
-  inline ::wire::ReplicaAction_Type type() const;
-  inline void set_type(::wire::ReplicaAction_Type value);
-
+  enum : int {
+    kPayloadFieldNumber = 2,
+    kTypeFieldNumber = 1,
+  };
   // optional bytes payload = 2;
-  inline bool has_payload() const;
-  inline void clear_payload();
-  static const int kPayloadFieldNumber = 2;
-  inline const ::std::string& payload() const;
-  inline void set_payload(const ::std::string& value);
-  inline void set_payload(const char* value);
-  inline void set_payload(const void* value, size_t size);
-  inline ::std::string* mutable_payload();
-  inline ::std::string* release_payload();
-  inline void set_allocated_payload(::std::string* payload);
+  bool has_payload() const;
+  private:
+  bool _internal_has_payload() const;
+  public:
+  void clear_payload();
+  const std::string& payload() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_payload(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_payload();
+  PROTOBUF_NODISCARD std::string* release_payload();
+  void set_allocated_payload(std::string* payload);
+  private:
+  const std::string& _internal_payload() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_payload(const std::string& value);
+  std::string* _internal_mutable_payload();
+  public:
+
+  // required .wire.ReplicaAction.Type type = 1;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::wire::ReplicaAction_Type type() const;
+  void set_type(::wire::ReplicaAction_Type value);
+  private:
+  ::wire::ReplicaAction_Type _internal_type() const;
+  void _internal_set_type(::wire::ReplicaAction_Type value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.ReplicaAction)
  private:
-  inline void set_has_type();
-  inline void clear_has_type();
-  inline void set_has_payload();
-  inline void clear_has_payload();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* payload_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static ReplicaAction* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr payload_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueError : public ::google::protobuf::Message {
+class QueueError final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueError) */ {
  public:
-  QueueError();
-  virtual ~QueueError();
+  inline QueueError() : QueueError(nullptr) {}
+  ~QueueError() override;
+  explicit PROTOBUF_CONSTEXPR QueueError(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   QueueError(const QueueError& from);
+  QueueError(QueueError&& from) noexcept
+    : QueueError() {
+    *this = ::std::move(from);
+  }
 
   inline QueueError& operator=(const QueueError& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline QueueError& operator=(QueueError&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QueueError& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueError& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueError* internal_default_instance() {
+    return reinterpret_cast<const QueueError*>(
+               &_QueueError_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
 
-  void Swap(QueueError* other);
+  friend void swap(QueueError& a, QueueError& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueError* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueError* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  QueueError* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  QueueError* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueError>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const QueueError& from);
-  void MergeFrom(const QueueError& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueError& from) {
+    QueueError::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueError* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueError";
+  }
+  protected:
+  explicit QueueError(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kQueueFieldNumber = 1,
+    kErrorFieldNumber = 2,
+  };
   // required string queue = 1;
-  inline bool has_queue() const;
-  inline void clear_queue();
-  static const int kQueueFieldNumber = 1;
-  inline const ::std::string& queue() const;
-  inline void set_queue(const ::std::string& value);
-  inline void set_queue(const char* value);
-  inline void set_queue(const char* value, size_t size);
-  inline ::std::string* mutable_queue();
-  inline ::std::string* release_queue();
-  inline void set_allocated_queue(::std::string* queue);
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
 
   // optional string error = 2;
-  inline bool has_error() const;
-  inline void clear_error();
-  static const int kErrorFieldNumber = 2;
-  inline const ::std::string& error() const;
-  inline void set_error(const ::std::string& value);
-  inline void set_error(const char* value);
-  inline void set_error(const char* value, size_t size);
-  inline ::std::string* mutable_error();
-  inline ::std::string* release_error();
-  inline void set_allocated_error(::std::string* error);
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.QueueError)
  private:
-  inline void set_has_queue();
-  inline void clear_has_queue();
-  inline void set_has_error();
-  inline void clear_has_error();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* queue_;
-  ::std::string* error_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static QueueError* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueDeclaration : public ::google::protobuf::Message {
+class QueueDeclaration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueDeclaration) */ {
  public:
-  QueueDeclaration();
-  virtual ~QueueDeclaration();
+  inline QueueDeclaration() : QueueDeclaration(nullptr) {}
+  ~QueueDeclaration() override;
+  explicit PROTOBUF_CONSTEXPR QueueDeclaration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   QueueDeclaration(const QueueDeclaration& from);
+  QueueDeclaration(QueueDeclaration&& from) noexcept
+    : QueueDeclaration() {
+    *this = ::std::move(from);
+  }
 
   inline QueueDeclaration& operator=(const QueueDeclaration& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline QueueDeclaration& operator=(QueueDeclaration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QueueDeclaration& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueDeclaration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueDeclaration* internal_default_instance() {
+    return reinterpret_cast<const QueueDeclaration*>(
+               &_QueueDeclaration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
 
-  void Swap(QueueDeclaration* other);
+  friend void swap(QueueDeclaration& a, QueueDeclaration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueDeclaration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueDeclaration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  QueueDeclaration* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  QueueDeclaration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueDeclaration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const QueueDeclaration& from);
-  void MergeFrom(const QueueDeclaration& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueDeclaration& from) {
+    QueueDeclaration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueDeclaration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueDeclaration";
+  }
+  protected:
+  explicit QueueDeclaration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   typedef QueueDeclaration_Type Type;
-  static const Type eBroadcast = QueueDeclaration_Type_eBroadcast;
-  static const Type eTransient = QueueDeclaration_Type_eTransient;
-  static const Type eDurable = QueueDeclaration_Type_eDurable;
+  static constexpr Type eBroadcast =
+    QueueDeclaration_Type_eBroadcast;
+  static constexpr Type eTransient =
+    QueueDeclaration_Type_eTransient;
+  static constexpr Type eDurable =
+    QueueDeclaration_Type_eDurable;
   static inline bool Type_IsValid(int value) {
     return QueueDeclaration_Type_IsValid(value);
   }
-  static const Type Type_MIN =
+  static constexpr Type Type_MIN =
     QueueDeclaration_Type_Type_MIN;
-  static const Type Type_MAX =
+  static constexpr Type Type_MAX =
     QueueDeclaration_Type_Type_MAX;
-  static const int Type_ARRAYSIZE =
+  static constexpr int Type_ARRAYSIZE =
     QueueDeclaration_Type_Type_ARRAYSIZE;
-  static inline const ::google::protobuf::EnumDescriptor*
+  static inline const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor*
   Type_descriptor() {
     return QueueDeclaration_Type_descriptor();
   }
-  static inline const ::std::string& Type_Name(Type value) {
-    return QueueDeclaration_Type_Name(value);
+  template<typename T>
+  static inline const std::string& Type_Name(T enum_t_value) {
+    static_assert(::std::is_same<T, Type>::value ||
+      ::std::is_integral<T>::value,
+      "Incorrect type passed to function Type_Name.");
+    return QueueDeclaration_Type_Name(enum_t_value);
   }
-  static inline bool Type_Parse(const ::std::string& name,
+  static inline bool Type_Parse(::PROTOBUF_NAMESPACE_ID::ConstStringParam name,
       Type* value) {
     return QueueDeclaration_Type_Parse(name, value);
   }
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kNameFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
   // required string name = 1;
-  inline bool has_name() const;
-  inline void clear_name();
-  static const int kNameFieldNumber = 1;
-  inline const ::std::string& name() const;
-  inline void set_name(const ::std::string& value);
-  inline void set_name(const char* value);
-  inline void set_name(const char* value, size_t size);
-  inline ::std::string* mutable_name();
-  inline ::std::string* release_name();
-  inline void set_allocated_name(::std::string* name);
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
 
   // required .wire.QueueDeclaration.Type type = 2;
-  inline bool has_type() const;
-  inline void clear_type();
-  static const int kTypeFieldNumber = 2;
-  inline ::wire::QueueDeclaration_Type type() const;
-  inline void set_type(::wire::QueueDeclaration_Type value);
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  ::wire::QueueDeclaration_Type type() const;
+  void set_type(::wire::QueueDeclaration_Type value);
+  private:
+  ::wire::QueueDeclaration_Type _internal_type() const;
+  void _internal_set_type(::wire::QueueDeclaration_Type value);
+  public:
 
   // @@protoc_insertion_point(class_scope:wire.QueueDeclaration)
  private:
-  inline void set_has_name();
-  inline void clear_has_name();
-  inline void set_has_type();
-  inline void clear_has_type();
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::std::string* name_;
-  int type_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(2 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static QueueDeclaration* default_instance_;
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    int type_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // -------------------------------------------------------------------
 
-class QueueConfiguration : public ::google::protobuf::Message {
+class QueueConfiguration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:wire.QueueConfiguration) */ {
  public:
-  QueueConfiguration();
-  virtual ~QueueConfiguration();
+  inline QueueConfiguration() : QueueConfiguration(nullptr) {}
+  ~QueueConfiguration() override;
+  explicit PROTOBUF_CONSTEXPR QueueConfiguration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   QueueConfiguration(const QueueConfiguration& from);
+  QueueConfiguration(QueueConfiguration&& from) noexcept
+    : QueueConfiguration() {
+    *this = ::std::move(from);
+  }
 
   inline QueueConfiguration& operator=(const QueueConfiguration& from) {
     CopyFrom(from);
     return *this;
   }
-
-  inline const ::google::protobuf::UnknownFieldSet& unknown_fields() const {
-    return _unknown_fields_;
+  inline QueueConfiguration& operator=(QueueConfiguration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
 
-  inline ::google::protobuf::UnknownFieldSet* mutable_unknown_fields() {
-    return &_unknown_fields_;
+  inline const ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance);
+  }
+  inline ::PROTOBUF_NAMESPACE_ID::UnknownFieldSet* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
   }
 
-  static const ::google::protobuf::Descriptor* descriptor();
-  static const QueueConfiguration& default_instance();
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const QueueConfiguration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const QueueConfiguration* internal_default_instance() {
+    return reinterpret_cast<const QueueConfiguration*>(
+               &_QueueConfiguration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
 
-  void Swap(QueueConfiguration* other);
+  friend void swap(QueueConfiguration& a, QueueConfiguration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(QueueConfiguration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(QueueConfiguration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
 
   // implements Message ----------------------------------------------
 
-  QueueConfiguration* New() const;
-  void CopyFrom(const ::google::protobuf::Message& from);
-  void MergeFrom(const ::google::protobuf::Message& from);
+  QueueConfiguration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueueConfiguration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
   void CopyFrom(const QueueConfiguration& from);
-  void MergeFrom(const QueueConfiguration& from);
-  void Clear();
-  bool IsInitialized() const;
-
-  int ByteSize() const;
-  bool MergePartialFromCodedStream(
-      ::google::protobuf::io::CodedInputStream* input);
-  void SerializeWithCachedSizes(
-      ::google::protobuf::io::CodedOutputStream* output) const;
-  ::google::protobuf::uint8* SerializeWithCachedSizesToArray(::google::protobuf::uint8* output) const;
-  int GetCachedSize() const { return _cached_size_; }
-  private:
-  void SharedCtor();
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueueConfiguration& from) {
+    QueueConfiguration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
-  void SetCachedSize(int size) const;
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueueConfiguration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "wire.QueueConfiguration";
+  }
+  protected:
+  explicit QueueConfiguration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  ::google::protobuf::Metadata GetMetadata() const;
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
 
   // nested types ----------------------------------------------------
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kQueuesFieldNumber = 1,
+  };
   // repeated .wire.QueueDeclaration queues = 1;
-  inline int queues_size() const;
-  inline void clear_queues();
-  static const int kQueuesFieldNumber = 1;
-  inline const ::wire::QueueDeclaration& queues(int index) const;
-  inline ::wire::QueueDeclaration* mutable_queues(int index);
-  inline ::wire::QueueDeclaration* add_queues();
-  inline const ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >&
-      queues() const;
-  inline ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >*
+  int queues_size() const;
+  private:
+  int _internal_queues_size() const;
+  public:
+  void clear_queues();
+  ::wire::QueueDeclaration* mutable_queues(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >*
       mutable_queues();
+  private:
+  const ::wire::QueueDeclaration& _internal_queues(int index) const;
+  ::wire::QueueDeclaration* _internal_add_queues();
+  public:
+  const ::wire::QueueDeclaration& queues(int index) const;
+  ::wire::QueueDeclaration* add_queues();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >&
+      queues() const;
 
   // @@protoc_insertion_point(class_scope:wire.QueueConfiguration)
  private:
-
-  ::google::protobuf::UnknownFieldSet _unknown_fields_;
-
-  ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration > queues_;
-
-  mutable int _cached_size_;
-  ::google::protobuf::uint32 _has_bits_[(1 + 31) / 32];
-
-  friend void  protobuf_AddDesc_wire_2eproto();
-  friend void protobuf_AssignDesc_wire_2eproto();
-  friend void protobuf_ShutdownFile_wire_2eproto();
-
-  void InitAsDefaultInstance();
-  static QueueConfiguration* default_instance_;
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration > queues_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_wire_2eproto;
 };
 // ===================================================================
 
 
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // Message
 
 // required string destination = 1;
-inline bool Message::has_destination() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Message::_internal_has_destination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Message::set_has_destination() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Message::clear_has_destination() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Message::has_destination() const {
+  return _internal_has_destination();
 }
 inline void Message::clear_destination() {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    destination_->clear();
-  }
-  clear_has_destination();
-}
-inline const ::std::string& Message::destination() const {
-  return *destination_;
-}
-inline void Message::set_destination(const ::std::string& value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(value);
-}
-inline void Message::set_destination(const char* value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(value);
-}
-inline void Message::set_destination(const char* value, size_t size) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Message::mutable_destination() {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  return destination_;
-}
-inline ::std::string* Message::release_destination() {
-  clear_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.destination_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Message::destination() const {
+  // @@protoc_insertion_point(field_get:wire.Message.destination)
+  return _internal_destination();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_destination(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Message.destination)
+}
+inline std::string* Message::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:wire.Message.destination)
+  return _s;
+}
+inline const std::string& Message::_internal_destination() const {
+  return _impl_.destination_.Get();
+}
+inline void Message::_internal_set_destination(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.destination_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_destination() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_destination() {
+  // @@protoc_insertion_point(field_release:wire.Message.destination)
+  if (!_internal_has_destination()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.destination_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = destination_;
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-}
-inline void Message::set_allocated_destination(::std::string* destination) {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    delete destination_;
-  }
-  if (destination) {
-    set_has_destination();
-    destination_ = destination;
-  } else {
-    clear_has_destination();
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Message.destination)
 }
 
 // required bytes payload = 2;
-inline bool Message::has_payload() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+inline bool Message::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Message::set_has_payload() {
-  _has_bits_[0] |= 0x00000002u;
-}
-inline void Message::clear_has_payload() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Message::has_payload() const {
+  return _internal_has_payload();
 }
 inline void Message::clear_payload() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    payload_->clear();
-  }
-  clear_has_payload();
-}
-inline const ::std::string& Message::payload() const {
-  return *payload_;
-}
-inline void Message::set_payload(const ::std::string& value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
-}
-inline void Message::set_payload(const char* value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
-}
-inline void Message::set_payload(const void* value, size_t size) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Message::mutable_payload() {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  return payload_;
-}
-inline ::std::string* Message::release_payload() {
-  clear_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Message::payload() const {
+  // @@protoc_insertion_point(field_get:wire.Message.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Message::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Message.payload)
+}
+inline std::string* Message::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:wire.Message.payload)
+  return _s;
+}
+inline const std::string& Message::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void Message::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Message::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Message::release_payload() {
+  // @@protoc_insertion_point(field_release:wire.Message.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Message::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = payload_;
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-}
-inline void Message::set_allocated_payload(::std::string* payload) {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
-  }
-  if (payload) {
-    set_has_payload();
-    payload_ = payload;
-  } else {
-    clear_has_payload();
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Message.payload)
 }
 
 // optional uint64 id = 3;
+inline bool Message::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool Message::has_id() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_id();
 }
-inline void Message::set_has_id() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Message::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Message::clear_has_id() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint64_t Message::_internal_id() const {
+  return _impl_.id_;
 }
-inline void Message::clear_id() {
-  id_ = GOOGLE_ULONGLONG(0);
-  clear_has_id();
+inline uint64_t Message::id() const {
+  // @@protoc_insertion_point(field_get:wire.Message.id)
+  return _internal_id();
 }
-inline ::google::protobuf::uint64 Message::id() const {
-  return id_;
+inline void Message::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.id_ = value;
 }
-inline void Message::set_id(::google::protobuf::uint64 value) {
-  set_has_id();
-  id_ = value;
+inline void Message::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:wire.Message.id)
 }
 
 // optional uint32 flags = 4;
+inline bool Message::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool Message::has_flags() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_flags();
 }
-inline void Message::set_has_flags() {
-  _has_bits_[0] |= 0x00000008u;
+inline void Message::clear_flags() {
+  _impl_.flags_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void Message::clear_has_flags() {
-  _has_bits_[0] &= ~0x00000008u;
+inline uint32_t Message::_internal_flags() const {
+  return _impl_.flags_;
 }
-inline void Message::clear_flags() {
-  flags_ = 0u;
-  clear_has_flags();
+inline uint32_t Message::flags() const {
+  // @@protoc_insertion_point(field_get:wire.Message.flags)
+  return _internal_flags();
 }
-inline ::google::protobuf::uint32 Message::flags() const {
-  return flags_;
+inline void Message::_internal_set_flags(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.flags_ = value;
 }
-inline void Message::set_flags(::google::protobuf::uint32 value) {
-  set_has_flags();
-  flags_ = value;
+inline void Message::set_flags(uint32_t value) {
+  _internal_set_flags(value);
+  // @@protoc_insertion_point(field_set:wire.Message.flags)
 }
 
 // optional uint64 confirm_id = 5;
+inline bool Message::_internal_has_confirm_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool Message::has_confirm_id() const {
-  return (_has_bits_[0] & 0x00000010u) != 0;
+  return _internal_has_confirm_id();
 }
-inline void Message::set_has_confirm_id() {
-  _has_bits_[0] |= 0x00000010u;
+inline void Message::clear_confirm_id() {
+  _impl_.confirm_id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Message::clear_has_confirm_id() {
-  _has_bits_[0] &= ~0x00000010u;
+inline uint64_t Message::_internal_confirm_id() const {
+  return _impl_.confirm_id_;
 }
-inline void Message::clear_confirm_id() {
-  confirm_id_ = GOOGLE_ULONGLONG(0);
-  clear_has_confirm_id();
+inline uint64_t Message::confirm_id() const {
+  // @@protoc_insertion_point(field_get:wire.Message.confirm_id)
+  return _internal_confirm_id();
 }
-inline ::google::protobuf::uint64 Message::confirm_id() const {
-  return confirm_id_;
+inline void Message::_internal_set_confirm_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.confirm_id_ = value;
 }
-inline void Message::set_confirm_id(::google::protobuf::uint64 value) {
-  set_has_confirm_id();
-  confirm_id_ = value;
+inline void Message::set_confirm_id(uint64_t value) {
+  _internal_set_confirm_id(value);
+  // @@protoc_insertion_point(field_set:wire.Message.confirm_id)
 }
 
 // -------------------------------------------------------------------
@@ -1490,117 +2574,127 @@ inline void Message::set_confirm_id(::google::protobuf::uint64 value) {
 // Action
 
 // required int32 type = 1;
+inline bool Action::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool Action::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_type();
 }
-inline void Action::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
+inline void Action::clear_type() {
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Action::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t Action::_internal_type() const {
+  return _impl_.type_;
 }
-inline void Action::clear_type() {
-  type_ = 0;
-  clear_has_type();
+inline int32_t Action::type() const {
+  // @@protoc_insertion_point(field_get:wire.Action.type)
+  return _internal_type();
 }
-inline ::google::protobuf::int32 Action::type() const {
-  return type_;
+inline void Action::_internal_set_type(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.type_ = value;
 }
-inline void Action::set_type(::google::protobuf::int32 value) {
-  set_has_type();
-  type_ = value;
+inline void Action::set_type(int32_t value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.Action.type)
 }
 
-// optional string payload = 2;
-inline bool Action::has_payload() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Action::set_has_payload() {
-  _has_bits_[0] |= 0x00000002u;
+// optional bytes payload = 2;
+inline bool Action::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Action::clear_has_payload() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Action::has_payload() const {
+  return _internal_has_payload();
 }
 inline void Action::clear_payload() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    payload_->clear();
-  }
-  clear_has_payload();
-}
-inline const ::std::string& Action::payload() const {
-  return *payload_;
-}
-inline void Action::set_payload(const ::std::string& value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
-}
-inline void Action::set_payload(const char* value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
-}
-inline void Action::set_payload(const char* value, size_t size) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Action::mutable_payload() {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  return payload_;
-}
-inline ::std::string* Action::release_payload() {
-  clear_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Action::payload() const {
+  // @@protoc_insertion_point(field_get:wire.Action.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Action::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Action.payload)
+}
+inline std::string* Action::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:wire.Action.payload)
+  return _s;
+}
+inline const std::string& Action::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void Action::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Action::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Action::release_payload() {
+  // @@protoc_insertion_point(field_release:wire.Action.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Action::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = payload_;
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Action::set_allocated_payload(::std::string* payload) {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (payload) {
-    set_has_payload();
-    payload_ = payload;
-  } else {
-    clear_has_payload();
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Action.payload)
 }
 
 // optional uint64 id = 3;
+inline bool Action::_internal_has_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool Action::has_id() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_id();
 }
-inline void Action::set_has_id() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Action::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void Action::clear_has_id() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint64_t Action::_internal_id() const {
+  return _impl_.id_;
 }
-inline void Action::clear_id() {
-  id_ = GOOGLE_ULONGLONG(0);
-  clear_has_id();
+inline uint64_t Action::id() const {
+  // @@protoc_insertion_point(field_get:wire.Action.id)
+  return _internal_id();
 }
-inline ::google::protobuf::uint64 Action::id() const {
-  return id_;
+inline void Action::_internal_set_id(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.id_ = value;
 }
-inline void Action::set_id(::google::protobuf::uint64 value) {
-  set_has_id();
-  id_ = value;
+inline void Action::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:wire.Action.id)
 }
 
 // -------------------------------------------------------------------
@@ -1608,143 +2702,139 @@ inline void Action::set_id(::google::protobuf::uint64 value) {
 // BondRequest
 
 // required string queue = 1;
-inline bool BondRequest::has_queue() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool BondRequest::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void BondRequest::set_has_queue() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void BondRequest::clear_has_queue() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool BondRequest::has_queue() const {
+  return _internal_has_queue();
 }
 inline void BondRequest::clear_queue() {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    queue_->clear();
-  }
-  clear_has_queue();
-}
-inline const ::std::string& BondRequest::queue() const {
-  return *queue_;
-}
-inline void BondRequest::set_queue(const ::std::string& value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
-}
-inline void BondRequest::set_queue(const char* value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
-}
-inline void BondRequest::set_queue(const char* value, size_t size) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* BondRequest::mutable_queue() {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  return queue_;
-}
-inline ::std::string* BondRequest::release_queue() {
-  clear_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& BondRequest::queue() const {
+  // @@protoc_insertion_point(field_get:wire.BondRequest.queue)
+  return _internal_queue();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BondRequest::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.BondRequest.queue)
+}
+inline std::string* BondRequest::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.BondRequest.queue)
+  return _s;
+}
+inline const std::string& BondRequest::_internal_queue() const {
+  return _impl_.queue_.Get();
+}
+inline void BondRequest::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BondRequest::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BondRequest::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.BondRequest.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BondRequest::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = queue_;
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void BondRequest::set_allocated_queue(::std::string* queue) {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    delete queue_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (queue) {
-    set_has_queue();
-    queue_ = queue;
-  } else {
-    clear_has_queue();
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.BondRequest.queue)
 }
 
 // required string destination = 2;
-inline bool BondRequest::has_destination() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void BondRequest::set_has_destination() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool BondRequest::_internal_has_destination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void BondRequest::clear_has_destination() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool BondRequest::has_destination() const {
+  return _internal_has_destination();
 }
 inline void BondRequest::clear_destination() {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    destination_->clear();
-  }
-  clear_has_destination();
-}
-inline const ::std::string& BondRequest::destination() const {
-  return *destination_;
-}
-inline void BondRequest::set_destination(const ::std::string& value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(value);
-}
-inline void BondRequest::set_destination(const char* value) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(value);
-}
-inline void BondRequest::set_destination(const char* value, size_t size) {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  destination_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* BondRequest::mutable_destination() {
-  set_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    destination_ = new ::std::string;
-  }
-  return destination_;
-}
-inline ::std::string* BondRequest::release_destination() {
-  clear_has_destination();
-  if (destination_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.destination_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& BondRequest::destination() const {
+  // @@protoc_insertion_point(field_get:wire.BondRequest.destination)
+  return _internal_destination();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void BondRequest::set_destination(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.destination_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.BondRequest.destination)
+}
+inline std::string* BondRequest::mutable_destination() {
+  std::string* _s = _internal_mutable_destination();
+  // @@protoc_insertion_point(field_mutable:wire.BondRequest.destination)
+  return _s;
+}
+inline const std::string& BondRequest::_internal_destination() const {
+  return _impl_.destination_.Get();
+}
+inline void BondRequest::_internal_set_destination(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.destination_.Set(value, GetArenaForAllocation());
+}
+inline std::string* BondRequest::_internal_mutable_destination() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.destination_.Mutable(GetArenaForAllocation());
+}
+inline std::string* BondRequest::release_destination() {
+  // @@protoc_insertion_point(field_release:wire.BondRequest.destination)
+  if (!_internal_has_destination()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.destination_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void BondRequest::set_allocated_destination(std::string* destination) {
+  if (destination != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = destination_;
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void BondRequest::set_allocated_destination(::std::string* destination) {
-  if (destination_ != &::google::protobuf::internal::kEmptyString) {
-    delete destination_;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  if (destination) {
-    set_has_destination();
-    destination_ = destination;
-  } else {
-    clear_has_destination();
-    destination_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.destination_.SetAllocated(destination, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.destination_.IsDefault()) {
+    _impl_.destination_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.BondRequest.destination)
 }
 
 // -------------------------------------------------------------------
@@ -1752,91 +2842,171 @@ inline void BondRequest::set_allocated_destination(::std::string* destination) {
 // ConnectionConfigure
 
 // optional bool tap = 1;
-inline bool ConnectionConfigure::has_tap() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool ConnectionConfigure::_internal_has_tap() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void ConnectionConfigure::set_has_tap() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ConnectionConfigure::clear_has_tap() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool ConnectionConfigure::has_tap() const {
+  return _internal_has_tap();
 }
 inline void ConnectionConfigure::clear_tap() {
-  tap_ = false;
-  clear_has_tap();
+  _impl_.tap_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool ConnectionConfigure::_internal_tap() const {
+  return _impl_.tap_;
 }
 inline bool ConnectionConfigure::tap() const {
-  return tap_;
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.tap)
+  return _internal_tap();
+}
+inline void ConnectionConfigure::_internal_set_tap(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.tap_ = value;
 }
 inline void ConnectionConfigure::set_tap(bool value) {
-  set_has_tap();
-  tap_ = value;
+  _internal_set_tap(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.tap)
 }
 
 // optional bool ack = 2;
-inline bool ConnectionConfigure::has_ack() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ConnectionConfigure::set_has_ack() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ConnectionConfigure::_internal_has_ack() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void ConnectionConfigure::clear_has_ack() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool ConnectionConfigure::has_ack() const {
+  return _internal_has_ack();
 }
 inline void ConnectionConfigure::clear_ack() {
-  ack_ = false;
-  clear_has_ack();
+  _impl_.ack_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool ConnectionConfigure::_internal_ack() const {
+  return _impl_.ack_;
 }
 inline bool ConnectionConfigure::ack() const {
-  return ack_;
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.ack)
+  return _internal_ack();
+}
+inline void ConnectionConfigure::_internal_set_ack(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.ack_ = value;
 }
 inline void ConnectionConfigure::set_ack(bool value) {
-  set_has_ack();
-  ack_ = value;
+  _internal_set_ack(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.ack)
 }
 
 // optional bool confirm = 3;
-inline bool ConnectionConfigure::has_confirm() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+inline bool ConnectionConfigure::_internal_has_confirm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void ConnectionConfigure::set_has_confirm() {
-  _has_bits_[0] |= 0x00000004u;
-}
-inline void ConnectionConfigure::clear_has_confirm() {
-  _has_bits_[0] &= ~0x00000004u;
+inline bool ConnectionConfigure::has_confirm() const {
+  return _internal_has_confirm();
 }
 inline void ConnectionConfigure::clear_confirm() {
-  confirm_ = false;
-  clear_has_confirm();
+  _impl_.confirm_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool ConnectionConfigure::_internal_confirm() const {
+  return _impl_.confirm_;
 }
 inline bool ConnectionConfigure::confirm() const {
-  return confirm_;
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.confirm)
+  return _internal_confirm();
+}
+inline void ConnectionConfigure::_internal_set_confirm(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.confirm_ = value;
 }
 inline void ConnectionConfigure::set_confirm(bool value) {
-  set_has_confirm();
-  confirm_ = value;
+  _internal_set_confirm(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.confirm)
 }
 
 // optional uint32 inflight = 4;
+inline bool ConnectionConfigure::_internal_has_inflight() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
 inline bool ConnectionConfigure::has_inflight() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_inflight();
+}
+inline void ConnectionConfigure::clear_inflight() {
+  _impl_.inflight_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
 }
-inline void ConnectionConfigure::set_has_inflight() {
-  _has_bits_[0] |= 0x00000008u;
+inline uint32_t ConnectionConfigure::_internal_inflight() const {
+  return _impl_.inflight_;
 }
-inline void ConnectionConfigure::clear_has_inflight() {
-  _has_bits_[0] &= ~0x00000008u;
+inline uint32_t ConnectionConfigure::inflight() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.inflight)
+  return _internal_inflight();
 }
-inline void ConnectionConfigure::clear_inflight() {
-  inflight_ = 0u;
-  clear_has_inflight();
+inline void ConnectionConfigure::_internal_set_inflight(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.inflight_ = value;
+}
+inline void ConnectionConfigure::set_inflight(uint32_t value) {
+  _internal_set_inflight(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.inflight)
+}
+
+// optional bool deflate = 5;
+inline bool ConnectionConfigure::_internal_has_deflate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_deflate() const {
+  return _internal_has_deflate();
+}
+inline void ConnectionConfigure::clear_deflate() {
+  _impl_.deflate_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool ConnectionConfigure::_internal_deflate() const {
+  return _impl_.deflate_;
+}
+inline bool ConnectionConfigure::deflate() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.deflate)
+  return _internal_deflate();
+}
+inline void ConnectionConfigure::_internal_set_deflate(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.deflate_ = value;
+}
+inline void ConnectionConfigure::set_deflate(bool value) {
+  _internal_set_deflate(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.deflate)
+}
+
+// optional uint32 dictionary_id = 6;
+inline bool ConnectionConfigure::_internal_has_dictionary_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool ConnectionConfigure::has_dictionary_id() const {
+  return _internal_has_dictionary_id();
 }
-inline ::google::protobuf::uint32 ConnectionConfigure::inflight() const {
-  return inflight_;
+inline void ConnectionConfigure::clear_dictionary_id() {
+  _impl_.dictionary_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
 }
-inline void ConnectionConfigure::set_inflight(::google::protobuf::uint32 value) {
-  set_has_inflight();
-  inflight_ = value;
+inline uint32_t ConnectionConfigure::_internal_dictionary_id() const {
+  return _impl_.dictionary_id_;
+}
+inline uint32_t ConnectionConfigure::dictionary_id() const {
+  // @@protoc_insertion_point(field_get:wire.ConnectionConfigure.dictionary_id)
+  return _internal_dictionary_id();
+}
+inline void ConnectionConfigure::_internal_set_dictionary_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.dictionary_id_ = value;
+}
+inline void ConnectionConfigure::set_dictionary_id(uint32_t value) {
+  _internal_set_dictionary_id(value);
+  // @@protoc_insertion_point(field_set:wire.ConnectionConfigure.dictionary_id)
 }
 
 // -------------------------------------------------------------------
@@ -1844,47 +3014,59 @@ inline void ConnectionConfigure::set_inflight(::google::protobuf::uint32 value)
 // MessageRange
 
 // required int32 start = 1;
+inline bool MessageRange::_internal_has_start() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool MessageRange::has_start() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_start();
 }
-inline void MessageRange::set_has_start() {
-  _has_bits_[0] |= 0x00000001u;
+inline void MessageRange::clear_start() {
+  _impl_.start_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void MessageRange::clear_has_start() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t MessageRange::_internal_start() const {
+  return _impl_.start_;
 }
-inline void MessageRange::clear_start() {
-  start_ = 0;
-  clear_has_start();
+inline int32_t MessageRange::start() const {
+  // @@protoc_insertion_point(field_get:wire.MessageRange.start)
+  return _internal_start();
 }
-inline ::google::protobuf::int32 MessageRange::start() const {
-  return start_;
+inline void MessageRange::_internal_set_start(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_ = value;
 }
-inline void MessageRange::set_start(::google::protobuf::int32 value) {
-  set_has_start();
-  start_ = value;
+inline void MessageRange::set_start(int32_t value) {
+  _internal_set_start(value);
+  // @@protoc_insertion_point(field_set:wire.MessageRange.start)
 }
 
 // required int32 count = 2;
+inline bool MessageRange::_internal_has_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
 inline bool MessageRange::has_count() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
+  return _internal_has_count();
 }
-inline void MessageRange::set_has_count() {
-  _has_bits_[0] |= 0x00000002u;
+inline void MessageRange::clear_count() {
+  _impl_.count_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline void MessageRange::clear_has_count() {
-  _has_bits_[0] &= ~0x00000002u;
+inline int32_t MessageRange::_internal_count() const {
+  return _impl_.count_;
 }
-inline void MessageRange::clear_count() {
-  count_ = 0;
-  clear_has_count();
+inline int32_t MessageRange::count() const {
+  // @@protoc_insertion_point(field_get:wire.MessageRange.count)
+  return _internal_count();
 }
-inline ::google::protobuf::int32 MessageRange::count() const {
-  return count_;
+inline void MessageRange::_internal_set_count(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.count_ = value;
 }
-inline void MessageRange::set_count(::google::protobuf::int32 value) {
-  set_has_count();
-  count_ = value;
+inline void MessageRange::set_count(int32_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:wire.MessageRange.count)
 }
 
 // -------------------------------------------------------------------
@@ -1892,50 +3074,71 @@ inline void MessageRange::set_count(::google::protobuf::int32 value) {
 // Queue
 
 // required int32 size = 1;
+inline bool Queue::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
 inline bool Queue::has_size() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+  return _internal_has_size();
 }
-inline void Queue::set_has_size() {
-  _has_bits_[0] |= 0x00000001u;
+inline void Queue::clear_size() {
+  _impl_.size_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Queue::clear_has_size() {
-  _has_bits_[0] &= ~0x00000001u;
+inline int32_t Queue::_internal_size() const {
+  return _impl_.size_;
 }
-inline void Queue::clear_size() {
-  size_ = 0;
-  clear_has_size();
+inline int32_t Queue::size() const {
+  // @@protoc_insertion_point(field_get:wire.Queue.size)
+  return _internal_size();
 }
-inline ::google::protobuf::int32 Queue::size() const {
-  return size_;
+inline void Queue::_internal_set_size(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.size_ = value;
 }
-inline void Queue::set_size(::google::protobuf::int32 value) {
-  set_has_size();
-  size_ = value;
+inline void Queue::set_size(int32_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:wire.Queue.size)
 }
 
 // repeated .wire.MessageRange ranges = 2;
+inline int Queue::_internal_ranges_size() const {
+  return _impl_.ranges_.size();
+}
 inline int Queue::ranges_size() const {
-  return ranges_.size();
+  return _internal_ranges_size();
 }
 inline void Queue::clear_ranges() {
-  ranges_.Clear();
+  _impl_.ranges_.Clear();
+}
+inline ::wire::MessageRange* Queue::mutable_ranges(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.Queue.ranges)
+  return _impl_.ranges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >*
+Queue::mutable_ranges() {
+  // @@protoc_insertion_point(field_mutable_list:wire.Queue.ranges)
+  return &_impl_.ranges_;
+}
+inline const ::wire::MessageRange& Queue::_internal_ranges(int index) const {
+  return _impl_.ranges_.Get(index);
 }
 inline const ::wire::MessageRange& Queue::ranges(int index) const {
-  return ranges_.Get(index);
+  // @@protoc_insertion_point(field_get:wire.Queue.ranges)
+  return _internal_ranges(index);
 }
-inline ::wire::MessageRange* Queue::mutable_ranges(int index) {
-  return ranges_.Mutable(index);
+inline ::wire::MessageRange* Queue::_internal_add_ranges() {
+  return _impl_.ranges_.Add();
 }
 inline ::wire::MessageRange* Queue::add_ranges() {
-  return ranges_.Add();
+  ::wire::MessageRange* _add = _internal_add_ranges();
+  // @@protoc_insertion_point(field_add:wire.Queue.ranges)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::MessageRange >&
 Queue::ranges() const {
-  return ranges_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::wire::MessageRange >*
-Queue::mutable_ranges() {
-  return &ranges_;
+  // @@protoc_insertion_point(field_list:wire.Queue.ranges)
+  return _impl_.ranges_;
 }
 
 // -------------------------------------------------------------------
@@ -1943,139 +3146,155 @@ Queue::mutable_ranges() {
 // Stat
 
 // required string name = 1;
-inline bool Stat::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool Stat::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void Stat::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void Stat::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool Stat::has_name() const {
+  return _internal_has_name();
 }
 inline void Stat::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& Stat::name() const {
-  return *name_;
-}
-inline void Stat::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void Stat::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void Stat::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* Stat::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
-}
-inline ::std::string* Stat::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Stat::name() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stat::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.Stat.name)
+}
+inline std::string* Stat::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:wire.Stat.name)
+  return _s;
+}
+inline const std::string& Stat::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Stat::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stat::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stat::release_name() {
+  // @@protoc_insertion_point(field_release:wire.Stat.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Stat::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void Stat::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.Stat.name)
 }
 
 // required bool exists = 2;
-inline bool Stat::has_exists() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void Stat::set_has_exists() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool Stat::_internal_has_exists() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void Stat::clear_has_exists() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool Stat::has_exists() const {
+  return _internal_has_exists();
 }
 inline void Stat::clear_exists() {
-  exists_ = false;
-  clear_has_exists();
+  _impl_.exists_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool Stat::_internal_exists() const {
+  return _impl_.exists_;
 }
 inline bool Stat::exists() const {
-  return exists_;
+  // @@protoc_insertion_point(field_get:wire.Stat.exists)
+  return _internal_exists();
+}
+inline void Stat::_internal_set_exists(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.exists_ = value;
 }
 inline void Stat::set_exists(bool value) {
-  set_has_exists();
-  exists_ = value;
+  _internal_set_exists(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.exists)
 }
 
 // optional uint32 transient_size = 3;
+inline bool Stat::_internal_has_transient_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
 inline bool Stat::has_transient_size() const {
-  return (_has_bits_[0] & 0x00000004u) != 0;
+  return _internal_has_transient_size();
 }
-inline void Stat::set_has_transient_size() {
-  _has_bits_[0] |= 0x00000004u;
+inline void Stat::clear_transient_size() {
+  _impl_.transient_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline void Stat::clear_has_transient_size() {
-  _has_bits_[0] &= ~0x00000004u;
+inline uint32_t Stat::_internal_transient_size() const {
+  return _impl_.transient_size_;
 }
-inline void Stat::clear_transient_size() {
-  transient_size_ = 0u;
-  clear_has_transient_size();
+inline uint32_t Stat::transient_size() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.transient_size)
+  return _internal_transient_size();
 }
-inline ::google::protobuf::uint32 Stat::transient_size() const {
-  return transient_size_;
+inline void Stat::_internal_set_transient_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.transient_size_ = value;
 }
-inline void Stat::set_transient_size(::google::protobuf::uint32 value) {
-  set_has_transient_size();
-  transient_size_ = value;
+inline void Stat::set_transient_size(uint32_t value) {
+  _internal_set_transient_size(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.transient_size)
 }
 
 // optional uint32 durable_size = 4;
+inline bool Stat::_internal_has_durable_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
 inline bool Stat::has_durable_size() const {
-  return (_has_bits_[0] & 0x00000008u) != 0;
+  return _internal_has_durable_size();
 }
-inline void Stat::set_has_durable_size() {
-  _has_bits_[0] |= 0x00000008u;
+inline void Stat::clear_durable_size() {
+  _impl_.durable_size_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
 }
-inline void Stat::clear_has_durable_size() {
-  _has_bits_[0] &= ~0x00000008u;
+inline uint32_t Stat::_internal_durable_size() const {
+  return _impl_.durable_size_;
 }
-inline void Stat::clear_durable_size() {
-  durable_size_ = 0u;
-  clear_has_durable_size();
+inline uint32_t Stat::durable_size() const {
+  // @@protoc_insertion_point(field_get:wire.Stat.durable_size)
+  return _internal_durable_size();
 }
-inline ::google::protobuf::uint32 Stat::durable_size() const {
-  return durable_size_;
+inline void Stat::_internal_set_durable_size(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.durable_size_ = value;
 }
-inline void Stat::set_durable_size(::google::protobuf::uint32 value) {
-  set_has_durable_size();
-  durable_size_ = value;
+inline void Stat::set_durable_size(uint32_t value) {
+  _internal_set_durable_size(value);
+  // @@protoc_insertion_point(field_set:wire.Stat.durable_size)
 }
 
 // -------------------------------------------------------------------
@@ -2083,96 +3302,100 @@ inline void Stat::set_durable_size(::google::protobuf::uint32 value) {
 // ReplicaAction
 
 // required .wire.ReplicaAction.Type type = 1;
-inline bool ReplicaAction::has_type() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool ReplicaAction::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void ReplicaAction::set_has_type() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void ReplicaAction::clear_has_type() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool ReplicaAction::has_type() const {
+  return _internal_has_type();
 }
 inline void ReplicaAction::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::wire::ReplicaAction_Type ReplicaAction::_internal_type() const {
+  return static_cast< ::wire::ReplicaAction_Type >(_impl_.type_);
 }
 inline ::wire::ReplicaAction_Type ReplicaAction::type() const {
-  return static_cast< ::wire::ReplicaAction_Type >(type_);
+  // @@protoc_insertion_point(field_get:wire.ReplicaAction.type)
+  return _internal_type();
 }
-inline void ReplicaAction::set_type(::wire::ReplicaAction_Type value) {
+inline void ReplicaAction::_internal_set_type(::wire::ReplicaAction_Type value) {
   assert(::wire::ReplicaAction_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void ReplicaAction::set_type(::wire::ReplicaAction_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.ReplicaAction.type)
 }
 
 // optional bytes payload = 2;
-inline bool ReplicaAction::has_payload() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void ReplicaAction::set_has_payload() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool ReplicaAction::_internal_has_payload() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void ReplicaAction::clear_has_payload() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool ReplicaAction::has_payload() const {
+  return _internal_has_payload();
 }
 inline void ReplicaAction::clear_payload() {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    payload_->clear();
-  }
-  clear_has_payload();
-}
-inline const ::std::string& ReplicaAction::payload() const {
-  return *payload_;
-}
-inline void ReplicaAction::set_payload(const ::std::string& value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
-}
-inline void ReplicaAction::set_payload(const char* value) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(value);
-}
-inline void ReplicaAction::set_payload(const void* value, size_t size) {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  payload_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* ReplicaAction::mutable_payload() {
-  set_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    payload_ = new ::std::string;
-  }
-  return payload_;
-}
-inline ::std::string* ReplicaAction::release_payload() {
-  clear_has_payload();
-  if (payload_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.payload_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ReplicaAction::payload() const {
+  // @@protoc_insertion_point(field_get:wire.ReplicaAction.payload)
+  return _internal_payload();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicaAction::set_payload(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.payload_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.ReplicaAction.payload)
+}
+inline std::string* ReplicaAction::mutable_payload() {
+  std::string* _s = _internal_mutable_payload();
+  // @@protoc_insertion_point(field_mutable:wire.ReplicaAction.payload)
+  return _s;
+}
+inline const std::string& ReplicaAction::_internal_payload() const {
+  return _impl_.payload_.Get();
+}
+inline void ReplicaAction::_internal_set_payload(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.payload_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplicaAction::_internal_mutable_payload() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.payload_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplicaAction::release_payload() {
+  // @@protoc_insertion_point(field_release:wire.ReplicaAction.payload)
+  if (!_internal_has_payload()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.payload_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ReplicaAction::set_allocated_payload(std::string* payload) {
+  if (payload != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = payload_;
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void ReplicaAction::set_allocated_payload(::std::string* payload) {
-  if (payload_ != &::google::protobuf::internal::kEmptyString) {
-    delete payload_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (payload) {
-    set_has_payload();
-    payload_ = payload;
-  } else {
-    clear_has_payload();
-    payload_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.payload_.SetAllocated(payload, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.payload_.IsDefault()) {
+    _impl_.payload_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.ReplicaAction.payload)
 }
 
 // -------------------------------------------------------------------
@@ -2180,143 +3403,139 @@ inline void ReplicaAction::set_allocated_payload(::std::string* payload) {
 // QueueError
 
 // required string queue = 1;
-inline bool QueueError::has_queue() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool QueueError::_internal_has_queue() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void QueueError::set_has_queue() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void QueueError::clear_has_queue() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool QueueError::has_queue() const {
+  return _internal_has_queue();
 }
 inline void QueueError::clear_queue() {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    queue_->clear();
-  }
-  clear_has_queue();
-}
-inline const ::std::string& QueueError::queue() const {
-  return *queue_;
-}
-inline void QueueError::set_queue(const ::std::string& value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
-}
-inline void QueueError::set_queue(const char* value) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(value);
-}
-inline void QueueError::set_queue(const char* value, size_t size) {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  queue_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* QueueError::mutable_queue() {
-  set_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    queue_ = new ::std::string;
-  }
-  return queue_;
-}
-inline ::std::string* QueueError::release_queue() {
-  clear_has_queue();
-  if (queue_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.queue_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& QueueError::queue() const {
+  // @@protoc_insertion_point(field_get:wire.QueueError.queue)
+  return _internal_queue();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueError::set_queue(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueError.queue)
+}
+inline std::string* QueueError::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:wire.QueueError.queue)
+  return _s;
+}
+inline const std::string& QueueError::_internal_queue() const {
+  return _impl_.queue_.Get();
+}
+inline void QueueError::_internal_set_queue(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.queue_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueError::_internal_mutable_queue() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueError::release_queue() {
+  // @@protoc_insertion_point(field_release:wire.QueueError.queue)
+  if (!_internal_has_queue()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.queue_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void QueueError::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = queue_;
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void QueueError::set_allocated_queue(::std::string* queue) {
-  if (queue_ != &::google::protobuf::internal::kEmptyString) {
-    delete queue_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (queue) {
-    set_has_queue();
-    queue_ = queue;
-  } else {
-    clear_has_queue();
-    queue_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueError.queue)
 }
 
 // optional string error = 2;
-inline bool QueueError::has_error() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void QueueError::set_has_error() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool QueueError::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void QueueError::clear_has_error() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool QueueError::has_error() const {
+  return _internal_has_error();
 }
 inline void QueueError::clear_error() {
-  if (error_ != &::google::protobuf::internal::kEmptyString) {
-    error_->clear();
-  }
-  clear_has_error();
-}
-inline const ::std::string& QueueError::error() const {
-  return *error_;
-}
-inline void QueueError::set_error(const ::std::string& value) {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
-  }
-  error_->assign(value);
-}
-inline void QueueError::set_error(const char* value) {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
-  }
-  error_->assign(value);
-}
-inline void QueueError::set_error(const char* value, size_t size) {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
-  }
-  error_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* QueueError::mutable_error() {
-  set_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    error_ = new ::std::string;
-  }
-  return error_;
-}
-inline ::std::string* QueueError::release_error() {
-  clear_has_error();
-  if (error_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& QueueError::error() const {
+  // @@protoc_insertion_point(field_get:wire.QueueError.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueError::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueError.error)
+}
+inline std::string* QueueError::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:wire.QueueError.error)
+  return _s;
+}
+inline const std::string& QueueError::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void QueueError::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueError::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueError::release_error() {
+  // @@protoc_insertion_point(field_release:wire.QueueError.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void QueueError::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    ::std::string* temp = error_;
-    error_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-}
-inline void QueueError::set_allocated_error(::std::string* error) {
-  if (error_ != &::google::protobuf::internal::kEmptyString) {
-    delete error_;
-  }
-  if (error) {
-    set_has_error();
-    error_ = error;
-  } else {
-    clear_has_error();
-    error_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueError.error)
 }
 
 // -------------------------------------------------------------------
@@ -2324,96 +3543,100 @@ inline void QueueError::set_allocated_error(::std::string* error) {
 // QueueDeclaration
 
 // required string name = 1;
-inline bool QueueDeclaration::has_name() const {
-  return (_has_bits_[0] & 0x00000001u) != 0;
+inline bool QueueDeclaration::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline void QueueDeclaration::set_has_name() {
-  _has_bits_[0] |= 0x00000001u;
-}
-inline void QueueDeclaration::clear_has_name() {
-  _has_bits_[0] &= ~0x00000001u;
+inline bool QueueDeclaration::has_name() const {
+  return _internal_has_name();
 }
 inline void QueueDeclaration::clear_name() {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    name_->clear();
-  }
-  clear_has_name();
-}
-inline const ::std::string& QueueDeclaration::name() const {
-  return *name_;
-}
-inline void QueueDeclaration::set_name(const ::std::string& value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void QueueDeclaration::set_name(const char* value) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(value);
-}
-inline void QueueDeclaration::set_name(const char* value, size_t size) {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  name_->assign(reinterpret_cast<const char*>(value), size);
-}
-inline ::std::string* QueueDeclaration::mutable_name() {
-  set_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    name_ = new ::std::string;
-  }
-  return name_;
-}
-inline ::std::string* QueueDeclaration::release_name() {
-  clear_has_name();
-  if (name_ == &::google::protobuf::internal::kEmptyString) {
-    return NULL;
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& QueueDeclaration::name() const {
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueueDeclaration::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.name)
+}
+inline std::string* QueueDeclaration::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:wire.QueueDeclaration.name)
+  return _s;
+}
+inline const std::string& QueueDeclaration::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void QueueDeclaration::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueueDeclaration::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueueDeclaration::release_name() {
+  // @@protoc_insertion_point(field_release:wire.QueueDeclaration.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void QueueDeclaration::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    ::std::string* temp = name_;
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-    return temp;
-  }
-}
-inline void QueueDeclaration::set_allocated_name(::std::string* name) {
-  if (name_ != &::google::protobuf::internal::kEmptyString) {
-    delete name_;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  if (name) {
-    set_has_name();
-    name_ = name;
-  } else {
-    clear_has_name();
-    name_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:wire.QueueDeclaration.name)
 }
 
 // required .wire.QueueDeclaration.Type type = 2;
-inline bool QueueDeclaration::has_type() const {
-  return (_has_bits_[0] & 0x00000002u) != 0;
-}
-inline void QueueDeclaration::set_has_type() {
-  _has_bits_[0] |= 0x00000002u;
+inline bool QueueDeclaration::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline void QueueDeclaration::clear_has_type() {
-  _has_bits_[0] &= ~0x00000002u;
+inline bool QueueDeclaration::has_type() const {
+  return _internal_has_type();
 }
 inline void QueueDeclaration::clear_type() {
-  type_ = 0;
-  clear_has_type();
+  _impl_.type_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline ::wire::QueueDeclaration_Type QueueDeclaration::_internal_type() const {
+  return static_cast< ::wire::QueueDeclaration_Type >(_impl_.type_);
 }
 inline ::wire::QueueDeclaration_Type QueueDeclaration::type() const {
-  return static_cast< ::wire::QueueDeclaration_Type >(type_);
+  // @@protoc_insertion_point(field_get:wire.QueueDeclaration.type)
+  return _internal_type();
 }
-inline void QueueDeclaration::set_type(::wire::QueueDeclaration_Type value) {
+inline void QueueDeclaration::_internal_set_type(::wire::QueueDeclaration_Type value) {
   assert(::wire::QueueDeclaration_Type_IsValid(value));
-  set_has_type();
-  type_ = value;
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.type_ = value;
+}
+inline void QueueDeclaration::set_type(::wire::QueueDeclaration_Type value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:wire.QueueDeclaration.type)
 }
 
 // -------------------------------------------------------------------
@@ -2421,52 +3644,89 @@ inline void QueueDeclaration::set_type(::wire::QueueDeclaration_Type value) {
 // QueueConfiguration
 
 // repeated .wire.QueueDeclaration queues = 1;
+inline int QueueConfiguration::_internal_queues_size() const {
+  return _impl_.queues_.size();
+}
 inline int QueueConfiguration::queues_size() const {
-  return queues_.size();
+  return _internal_queues_size();
 }
 inline void QueueConfiguration::clear_queues() {
-  queues_.Clear();
+  _impl_.queues_.Clear();
+}
+inline ::wire::QueueDeclaration* QueueConfiguration::mutable_queues(int index) {
+  // @@protoc_insertion_point(field_mutable:wire.QueueConfiguration.queues)
+  return _impl_.queues_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >*
+QueueConfiguration::mutable_queues() {
+  // @@protoc_insertion_point(field_mutable_list:wire.QueueConfiguration.queues)
+  return &_impl_.queues_;
+}
+inline const ::wire::QueueDeclaration& QueueConfiguration::_internal_queues(int index) const {
+  return _impl_.queues_.Get(index);
 }
 inline const ::wire::QueueDeclaration& QueueConfiguration::queues(int index) const {
-  return queues_.Get(index);
+  // @@protoc_insertion_point(field_get:wire.QueueConfiguration.queues)
+  return _internal_queues(index);
 }
-inline ::wire::QueueDeclaration* QueueConfiguration::mutable_queues(int index) {
-  return queues_.Mutable(index);
+inline ::wire::QueueDeclaration* QueueConfiguration::_internal_add_queues() {
+  return _impl_.queues_.Add();
 }
 inline ::wire::QueueDeclaration* QueueConfiguration::add_queues() {
-  return queues_.Add();
+  ::wire::QueueDeclaration* _add = _internal_add_queues();
+  // @@protoc_insertion_point(field_add:wire.QueueConfiguration.queues)
+  return _add;
 }
-inline const ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::wire::QueueDeclaration >&
 QueueConfiguration::queues() const {
-  return queues_;
-}
-inline ::google::protobuf::RepeatedPtrField< ::wire::QueueDeclaration >*
-QueueConfiguration::mutable_queues() {
-  return &queues_;
+  // @@protoc_insertion_point(field_list:wire.QueueConfiguration.queues)
+  return _impl_.queues_;
 }
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace wire
 
-#ifndef SWIG
-namespace google {
-namespace protobuf {
+PROTOBUF_NAMESPACE_OPEN
 
+template <> struct is_proto_enum< ::wire::ReplicaAction_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::wire::ReplicaAction_Type>() {
   return ::wire::ReplicaAction_Type_descriptor();
 }
+template <> struct is_proto_enum< ::wire::QueueDeclaration_Type> : ::std::true_type {};
 template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::wire::QueueDeclaration_Type>() {
   return ::wire::QueueDeclaration_Type_descriptor();
 }
 
-}  // namespace google
-}  // namespace protobuf
-#endif  // SWIG
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
 
-#endif  // PROTOBUF_wire_2eproto__INCLUDED
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_wire_2eproto
@@ -2,41 +2,69 @@
 #include "write_set.hpp"
 
 #include <errno.h>
+#include <unistd.h>
+#include <sys/uio.h>
 
 #include <iostream>
 
+// Most replies are a header slice plus a body slice, so gathering a few
+// slices per syscall covers the common case in one write.
+static const int cMaxIov = 16;
+
+WriteSet::~WriteSet() {
+  for(Slices::iterator i = slices_.begin(); i != slices_.end(); ++i) {
+    delete *i;
+  }
+}
+
 WriteStatus WriteSet::flush(int fd) {
   while(slices_.size() > 0) {
-    Slice* sl = slices_.front();
+    struct iovec iov[cMaxIov];
+    int cnt = 0;
 
-    uint8_t* buf = (uint8_t*)sl->buf.c_str();
-    ssize_t left = sl->buf.size() - sl->start;
+    for(Slices::iterator i = slices_.begin();
+        i != slices_.end() && cnt < cMaxIov;
+        ++i, ++cnt) {
+      Slice* sl = *i;
+      iov[cnt].iov_base = (void*)(sl->data + sl->start);
+      iov[cnt].iov_len = sl->size - sl->start;
+    }
 
-    while(left > 0) {
 #ifdef SIMULATE_BAD_NETWORK
-      ssize_t r = ::write(fd, buf + sl->start, left > 2 ? 2 : left);
+    if(iov[0].iov_len > 2) iov[0].iov_len = 2;
+    ssize_t r = ::writev(fd, iov, 1);
 #else
-      ssize_t r = ::write(fd, buf + sl->start, left);
+    ssize_t r = ::writev(fd, iov, cnt);
 #endif
 
-      if(r == -1) {
-        if(errno == EAGAIN || errno == EWOULDBLOCK) return eWouldBlock;
-        if(errno == EINTR) continue;
-        return eFailure;
-      }
+    if(r == -1) {
+      if(errno == EAGAIN || errno == EWOULDBLOCK) return eWouldBlock;
+      if(errno == EINTR) continue;
+      return eFailure;
+    }
 
-      if(r == 0) return eWouldBlock;
+    if(r == 0) return eWouldBlock;
 
-      sl->start += r;
-      left -= r;
+    bytes_ -= r;
 
-#ifdef SIMULATE_BAD_NETWORK
-      return eWouldBlock;
-#endif
+    // Retire whatever was fully written and advance into the rest.
+    while(r > 0) {
+      Slice* sl = slices_.front();
+      size_t left = sl->size - sl->start;
+
+      if((size_t)r < left) {
+        sl->start += r;
+        break;
+      }
+
+      r -= left;
+      slices_.pop_front();
+      delete sl;
     }
 
-    slices_.pop_front();
-    delete sl;
+#ifdef SIMULATE_BAD_NETWORK
+    return eWouldBlock;
+#endif
   }
 
   return eOk;
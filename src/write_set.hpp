@@ -4,6 +4,10 @@
 #include <list>
 #include <string>
 
+#include <stdint.h>
+
+#include "segment.hpp"
+
 enum WriteStatus {
   eOk,
   eWouldBlock,
@@ -11,27 +15,76 @@ enum WriteStatus {
 };
 
 class WriteSet {
+  // A slice either owns its bytes in buf or points into seg, which it
+  // holds a reference to until the bytes are written.
   struct Slice {
     std::string buf;
-    int start;
+    Segment seg;
+    const uint8_t* data;
+    size_t size;
+    size_t start;
 
-    Slice(std::string buf, int s)
-      : buf(buf)
+    Slice(std::string b, int s)
+      : buf(b)
+      , seg()
+      , data((const uint8_t*)buf.data())
+      , size(buf.size())
       , start(s)
     {}
+
+    Slice(const Segment& g, const uint8_t* d, size_t sz)
+      : buf()
+      , seg(g)
+      , data(d)
+      , size(sz)
+      , start(0)
+    {}
+
+  private:
+    Slice(const Slice&);
+    Slice& operator=(const Slice&);
   };
 
   typedef std::list<Slice*> Slices;
 
   Slices slices_;
+  size_t bytes_;
 
 public:
 
+  WriteSet()
+    : slices_()
+    , bytes_(0)
+  {}
+
+  ~WriteSet();
+
   void add(std::string val, int s=0) {
+    if(val.empty()) return;
     slices_.push_back(new Slice(val, 0));
+    bytes_ += val.size();
+  }
+
+  void add(const Segment& seg, const uint8_t* data, size_t size) {
+    if(size == 0) return;
+    slices_.push_back(new Slice(seg, data, size));
+    bytes_ += size;
+  }
+
+  bool empty_p() {
+    return slices_.empty();
+  }
+
+  // Bytes queued and not yet written.
+  size_t bytes() {
+    return bytes_;
   }
 
   WriteStatus flush(int fd);
+
+private:
+  WriteSet(const WriteSet&);
+  WriteSet& operator=(const WriteSet&);
 };
 
 #endif